@@ -27,6 +27,7 @@
 #include <ArduinoLog.h>
 #include <Servo.h>
 #include "core/Platform.h"
+#include "core/ServoOutput.h"
 #include "core/Config.h"
 
 using namespace stewy::core;
@@ -40,29 +41,19 @@ Servo servos[6];
 // Servo setpoints in degrees
 float servoValues[6];
 
-// Function to convert angle to microseconds
-float toMicroseconds(int angle)
-{
-  return map(angle, SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, SERVO_MIN_US, SERVO_MAX_US);
-}
+// Servo angle to pulse width mapping, with reversal and trim
+ServoOutput servoOutput(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, SERVO_MIN_US, SERVO_MAX_US, SERVO_REVERSE, SERVO_TRIM);
 
 // Update servo positions
 void updateServos()
 {
   for (int i = 0; i < 6; i++)
   {
-    // Apply reverse if needed
-    float val = servoValues[i];
-    if (SERVO_REVERSE[i])
+    // Write to servo, only when the pulse width changes
+    if (servoOutput.update(i, servoValues[i]))
     {
-      val = SERVO_MIN_ANGLE + (SERVO_MAX_ANGLE - val);
+      servos[i].writeMicroseconds(servoOutput.getMicroseconds(i));
     }
-
-    // Convert to microseconds and apply trim
-    val = toMicroseconds(val) + SERVO_TRIM[i];
-
-    // Write to servo
-    servos[i].writeMicroseconds(constrain(val, SERVO_MIN_US, SERVO_MAX_US));
   }
 }
 
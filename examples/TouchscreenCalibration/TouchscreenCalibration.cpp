@@ -27,6 +27,8 @@
 #include <ArduinoLog.h>
 #include <Servo.h>
 #include "core/Platform.h"
+#include "core/PoseArbiter.h"
+#include "core/ServoOutput.h"
 #include "core/Config.h"
 #include "drivers/TouchScreen.h"
 
@@ -36,6 +38,9 @@ using namespace stewy::drivers;
 // Create platform object
 Platform platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
 
+// Solves the touchscreen's pose requests on the platform
+PoseArbiter arbiter(platform);
+
 // Create touchscreen driver
 TouchScreenDriver touchscreen(XP, YP, XM, YM, TS_OHMS);
 
@@ -45,29 +50,19 @@ Servo servos[6];
 // Servo setpoints in degrees
 float servoValues[6];
 
-// Function to convert angle to microseconds
-float toMicroseconds(int angle)
-{
-  return map(angle, SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, SERVO_MIN_US, SERVO_MAX_US);
-}
+// Servo angle to pulse width mapping, with reversal and trim
+ServoOutput servoOutput(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, SERVO_MIN_US, SERVO_MAX_US, SERVO_REVERSE, SERVO_TRIM);
 
 // Update servo positions
 void updateServos()
 {
   for (int i = 0; i < 6; i++)
   {
-    // Apply reverse if needed
-    float val = servoValues[i];
-    if (SERVO_REVERSE[i])
+    // Write to servo, only when the pulse width changes
+    if (servoOutput.update(i, servoValues[i]))
     {
-      val = SERVO_MIN_ANGLE + (SERVO_MAX_ANGLE - val);
+      servos[i].writeMicroseconds(servoOutput.getMicroseconds(i));
     }
-
-    // Convert to microseconds and apply trim
-    val = toMicroseconds(val) + SERVO_TRIM[i];
-
-    // Write to servo
-    servos[i].writeMicroseconds(constrain(val, SERVO_MIN_US, SERVO_MAX_US));
   }
 }
 
@@ -103,7 +98,8 @@ void loop()
   if (touchscreen.isCalibrationInProgress())
   {
     // During calibration, just process the touchscreen
-    touchscreen.process(0, 0, servoValues);
+    touchscreen.process(0, 0, arbiter);
+    arbiter.update(servoValues);
     updateServos();
   }
   else
@@ -126,7 +122,8 @@ void loop()
       float setpoint_x = 0.5 * sin(angle);
       float setpoint_y = 0.5 * cos(angle);
 
-      touchscreen.process(setpoint_x, setpoint_y, servoValues);
+      touchscreen.process(setpoint_x, setpoint_y, arbiter);
+      arbiter.update(servoValues);
       updateServos();
 
       Log.trace("Setpoint: (%.2f, %.2f)", setpoint_x, setpoint_y);
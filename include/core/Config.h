@@ -49,13 +49,49 @@ namespace stewy
 // Logging configuration
 #define LOG_LEVEL LOG_LEVEL_TRACE
 
-// Main loop timing configuration
-#define MAIN_LOOP_INTERVAL_MS 20 // Target time in milliseconds for each main loop iteration
+// Task scheduling: each subsystem at its own rate, on micros() (see Scheduler.h)
+#define CONTROL_INTERVAL_US 10000      // Pose solve and servo setpoints (100 Hz)
+#define TOUCH_SAMPLE_INTERVAL_US 5000  // Touchscreen sampling (200 Hz)
+#define BALL_CONTROL_INTERVAL_US 10000 // Ball controller (100 Hz), no faster than ROLL_PID_SAMPLE_TIME and PITCH_PID_SAMPLE_TIME
+#define NUNCHUCK_INTERVAL_US 20000     // Nunchuck (50 Hz)
+#define ESTIMATE_INTERVAL_US 20000     // Pose estimate from the servo positions (50 Hz), with FK_ENABLED
+#define SCHEDULER_IDLE_WFI             // Comment out, to busy-wait for the next task instead of sleeping until shortly before it
+
+// Per-stage timing of the loop on the DWT cycle counter, shown by the stats command (see Profiler.h)
+#define PROFILER_ENABLED // Comment out, to skip the timing
+
+// Record of the sensor inputs and task runs, for the record command and tools/Replay (see Recorder.h)
+#define RECORDER_ENABLED                   // Comment out, to free the buffer and skip the recording
+#define RECORDER_ENTRIES 1536              // Entries kept, 8 bytes each (about 2.5 s of the loop, with its keyframes)
+#define RECORDER_KEYFRAME_INTERVAL_MS 1000 // Time between keyframes of the loop state, which the replay starts from
 
 // Servo movement configuration
-#define SERVO_ACCELERATION_ENABLED // Enable/disable servo acceleration/deceleration
-#define SERVO_MAX_SPEED 10.0f      // Maximum speed in degrees per loop iteration
-#define SERVO_ACCELERATION 0.3f    // Acceleration/deceleration rate in degrees per loop iteration squared
+// #define SERVO_ACCELERATION_ENABLED // Enable/disable servo acceleration/deceleration of each servo on its own (see ServoProfile.h)
+#define SERVO_MAX_SPEED_DEG 500.0f    // Maximum speed in degrees/s
+#define SERVO_MAX_ACCEL_DEG 750.0f    // Maximum acceleration/deceleration in degrees/s^2
+#define SERVO_MAX_JERK_DEG 15000.0f   // Maximum jerk in degrees/s^3 (full acceleration in 50 ms)
+
+// Pose-space interpolation: the platform moves to the requested pose in a straight line, all legs in step (see PoseInterpolator.h)
+#define POSE_INTERPOLATION_ENABLED // Comment out, to solve the requested pose at once
+#define POSE_MAX_SPEED_MM 100.0f   // Largest translation speed (mm/s)
+#define POSE_MAX_ACCEL_MM 500.0f   // Largest translation acceleration (mm/s^2)
+#define POSE_MAX_SPEED_DEG 120.0f  // Largest rotation speed (degrees/s)
+#define POSE_MAX_ACCEL_DEG 1200.0f // Largest rotation acceleration (degrees/s^2)
+
+#if defined(SERVO_ACCELERATION_ENABLED) && defined(POSE_INTERPOLATION_ENABLED)
+#error "SERVO_ACCELERATION_ENABLED and POSE_INTERPOLATION_ENABLED cannot both be defined"
+#endif
+
+// Servo updates from a timer interrupt, so that a stalled loop does not freeze the servos (see ServoController.h)
+#define SERVO_CONTROLLER_ENABLED      // Comment out, to move and write the servos at the end of each loop instead
+#define SERVO_UPDATE_INTERVAL_US 2000 // Period of the servo update interrupt, in microseconds (500 Hz)
+
+// Servo pulses from the FTM0 hardware PWM rather than the Servo library, with faster frames for digital servos (see FtmServoPwm.h)
+// #define SERVO_PWM_ENABLED    // Uncomment, to use the FTM0 PWM. SERVO_PINS must then be FTM0 pins: 5, 6, 9, 10, 20, 21, 22 or 23
+#define SERVO_PWM_FRAME_HZ 333 // Servo frame rate, 50-333 Hz (50 Hz for analog servos)
+
+// EEPROM address of the saved platform geometry (see GeometryProfile.h), clear of the touchscreen calibration
+#define GEOMETRY_EEPROM_ADDR 64
 
 // Servo configuration
 #define SERVO_MIN_ANGLE 0
@@ -142,6 +178,45 @@ namespace stewy
 #define MIN_HEAVE -22
 #define MAX_HEAVE 25
 
+// Polynomial approximations of sin, cos, atan2, asin and sqrt in the float IK kernel (see FastMath.h)
+#define USE_FAST_MATH // Comment out, to use libm
+
+// Pitch/roll IK lookup table, used by moveTo(servoValues, pitch, roll) (see PitchRollTable.h)
+#define IK_LUT_ENABLED         // Comment out, to always run the full IK solve
+#define IK_LUT_PITCH_STEPS 22  // Grid cells between MIN_PITCH and MAX_PITCH
+#define IK_LUT_ROLL_STEPS 22   // Grid cells between MIN_ROLL and MAX_ROLL
+#define IK_LUT_ROWS_PER_CALL 2 // Pitch rows solved per lookup while the table is being rebuilt
+
+// Jacobian-based incremental IK, used by moveTo() for small pose changes (see IncrementalIk.h)
+#define IK_JACOBIAN_ENABLED        // Comment out, to always run the full IK solve
+#define IK_JACOBIAN_MAX_DELTA 1.0f // Largest change from the previous pose that is linearized (mm or degrees)
+#define IK_JACOBIAN_MAX_DRIFT 2.0f // Largest distance from the last full solve that is linearized (mm or degrees)
+#define IK_JACOBIAN_MAX_ERROR 0.1f // Largest linearization error, checked on each update (degrees of servo angle, before AGGRO)
+#define IK_JACOBIAN_STEP 1.0f      // Central difference step of the Jacobian estimate (mm or degrees)
+
+// Forward kinematics, estimates the pose from the actual servo positions every loop (see ForwardKinematics.h)
+#define FK_ENABLED           // Comment out, to skip the pose estimate
+#define FK_MAX_ITERATIONS 2  // Newton-Raphson iterations per estimate
+#define FK_TOLERANCE 0.01f   // Servo angle residual that counts as converged (degrees, before AGGRO)
+#define FK_STEP 0.5f         // Forward difference step of the Jacobian estimate (mm or degrees)
+
+// Workspace reachability map, used by moveTo() to reject unreachable poses before the IK (see WorkspaceMap.h)
+#define WORKSPACE_MAP_ENABLED // Comment out, to run the IK on every pose
+
+// Move diagnostics: moveTo() counts its failures, and they are logged at most this often (see IkResult.h)
+#define IK_DIAGNOSTIC_INTERVAL_MS 1000
+
+// Priorities of the pose requests of each input source, higher wins (see PoseArbiter.h)
+#define PRIORITY_TOUCHSCREEN 1  // Ball balancing
+#define PRIORITY_NUNCHUCK 2     // Joystick CONTROL mode
+#define PRIORITY_COMMAND_LINE 3 // Shell commands
+
+// Cache of servo angles for recently solved poses, used by moveTo() (see PoseCache.h)
+#define POSE_CACHE_ENABLED           // Comment out, to solve every pose
+#define POSE_CACHE_CAPACITY 16       // Number of cached poses
+#define POSE_CACHE_QUANTUM_MM 1.0f   // Sway, surge and heave are rounded to this (mm)
+#define POSE_CACHE_QUANTUM_DEG 0.05f // Pitch, roll and yaw are rounded to this (degrees)
+
     /**
      * @struct xy_coordf
      * @brief 2D coordinate with floating point values
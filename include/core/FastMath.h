@@ -0,0 +1,304 @@
+#pragma once
+/**
+ * @file FastMath.h
+ * @brief Fast approximate math functions
+ *
+ * This file contains polynomial approximations of sin, cos, asin, atan,
+ * atan2 and sqrt in single precision, at selectable accuracy levels, for
+ * the float IK kernel. It has no Arduino dependencies, so it can be used
+ * in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+// Default accuracy level (see stewy::math::Accuracy). USE_FAST_MATH in Config.h selects these functions for the IK kernel
+#ifndef FAST_MATH_ACCURACY
+#define FAST_MATH_ACCURACY ACCURACY_MEDIUM
+#endif
+
+namespace stewy
+{
+  namespace math
+  {
+
+    /**
+     * @enum Accuracy
+     * @brief Accuracy levels of the approximations
+     *
+     * Maximum absolute errors, as verified by tools/FastMathBenchmark:
+     *
+     * | Level           | sin/cos | atan/atan2 | asin    | sqrt (relative) |
+     * |-----------------|---------|------------|---------|-----------------|
+     * | ACCURACY_LOW    | 7e-5    | 9e-5       | 1e-3    | 2e-3            |
+     * | ACCURACY_MEDIUM | 8e-7    | 2e-6       | 4e-6    | 5e-6            |
+     * | ACCURACY_HIGH   | 3e-7    | 4e-7       | 5e-7    | 3e-7            |
+     *
+     * ACCURACY_HIGH is limited by single precision rounding, not by the
+     * approximations.
+     */
+    enum Accuracy
+    {
+      ACCURACY_LOW,    ///< Fewest operations, about 4 significant digits
+      ACCURACY_MEDIUM, ///< About 6 significant digits
+      ACCURACY_HIGH    ///< Close to full single precision
+    };
+
+    const float PI_F = 3.14159265358979f;      ///< pi
+    const float HALF_PI_F = 1.57079632679490f; ///< pi / 2
+    const float TWO_PI_F = 6.28318530717959f;  ///< 2 * pi
+
+    // Minimax coefficients of odd polynomials c[0] x + c[1] x^3 + c[2] x^5 + ...
+    // SIN_* approximate sin(x) on [-pi/2, pi/2], ATAN_* approximate atan(x) on [-1, 1]
+    const float SIN_LOW[] = {9.9969677e-01f, -1.6567308e-01f, 7.5143774e-03f};
+    const float SIN_MEDIUM[] = {9.9999662e-01f, -1.6664828e-01f, 8.3063252e-03f, -1.8363654e-04f};
+    const float SIN_HIGH[] = {9.9999998e-01f, -1.6666648e-01f, 8.3328998e-03f, -1.9800898e-04f, 2.5904885e-06f};
+    const float ATAN_LOW[] = {9.9921381e-01f, -3.2117497e-01f, 1.4626446e-01f, -3.8986512e-02f};
+    const float ATAN_MEDIUM[] = {9.9997722e-01f, -3.3262283e-01f, 1.9354038e-01f, -1.1642648e-01f,
+                                 5.2647350e-02f, -1.1719135e-02f};
+    const float ATAN_HIGH[] = {9.9999934e-01f, -3.3329861e-01f, 1.9946566e-01f, -1.3908630e-01f,
+                               9.6421975e-02f, -5.5912329e-02f, 2.1862959e-02f, -4.0545675e-03f};
+
+    /**
+     * @struct Coefficients
+     * @brief Polynomial coefficients and iteration counts, per accuracy level
+     *
+     * SQRT_ITERATIONS is the number of Newton-Raphson refinements of the
+     * initial reciprocal square root estimate.
+     */
+    template <Accuracy A>
+    struct Coefficients;
+
+    template <>
+    struct Coefficients<ACCURACY_LOW>
+    {
+      static const int SIN_TERMS = 3;
+      static const int ATAN_TERMS = 4;
+      static const int SQRT_ITERATIONS = 1;
+      static const float *sin() { return SIN_LOW; }
+      static const float *atan() { return ATAN_LOW; }
+    };
+
+    template <>
+    struct Coefficients<ACCURACY_MEDIUM>
+    {
+      static const int SIN_TERMS = 4;
+      static const int ATAN_TERMS = 6;
+      static const int SQRT_ITERATIONS = 2;
+      static const float *sin() { return SIN_MEDIUM; }
+      static const float *atan() { return ATAN_MEDIUM; }
+    };
+
+    template <>
+    struct Coefficients<ACCURACY_HIGH>
+    {
+      static const int SIN_TERMS = 5;
+      static const int ATAN_TERMS = 8;
+      static const int SQRT_ITERATIONS = 3;
+      static const float *sin() { return SIN_HIGH; }
+      static const float *atan() { return ATAN_HIGH; }
+    };
+
+    /**
+     * @brief Evaluate an odd polynomial with Horner's method
+     *
+     * @param c Coefficients of x, x^3, x^5, ...
+     * @param terms Number of coefficients
+     * @param x Input value
+     * @return c[0] x + c[1] x^3 + ...
+     */
+    inline float oddPolynomial(const float *c, int terms, float x)
+    {
+      const float x2 = x * x;
+      float p = c[terms - 1];
+      for (int i = terms - 2; i >= 0; i--)
+      {
+        p = p * x2 + c[i];
+      }
+      return p * x;
+    }
+
+    /**
+     * @brief Sine and cosine of an angle
+     *
+     * @tparam A Accuracy level
+     * @param x Angle in radians
+     * @param s Receives sin(x)
+     * @param c Receives cos(x)
+     */
+    template <Accuracy A = FAST_MATH_ACCURACY>
+    inline void sinCos(float x, float &s, float &c)
+    {
+      typedef Coefficients<A> C;
+
+      // Reduce to [-pi, pi]
+      if (x > PI_F || x < -PI_F)
+      {
+        x -= TWO_PI_F * (float)(int32_t)(x / TWO_PI_F + (x >= 0 ? 0.5f : -0.5f));
+      }
+
+      // Fold into [-pi/2, pi/2]; cos changes sign in the outer quadrants
+      float sign = 1.0f;
+      if (x > HALF_PI_F)
+      {
+        x = PI_F - x;
+        sign = -1.0f;
+      }
+      else if (x < -HALF_PI_F)
+      {
+        x = -PI_F - x;
+        sign = -1.0f;
+      }
+
+      s = oddPolynomial(C::sin(), C::SIN_TERMS, x);
+      c = sign * oddPolynomial(C::sin(), C::SIN_TERMS, HALF_PI_F - (x < 0 ? -x : x));
+    }
+
+    /**
+     * @brief Sine
+     *
+     * @tparam A Accuracy level
+     * @param x Angle in radians
+     * @return sin(x)
+     */
+    template <Accuracy A = FAST_MATH_ACCURACY>
+    inline float sin(float x)
+    {
+      float s, c;
+      sinCos<A>(x, s, c);
+      return s;
+    }
+
+    /**
+     * @brief Cosine
+     *
+     * @tparam A Accuracy level
+     * @param x Angle in radians
+     * @return cos(x)
+     */
+    template <Accuracy A = FAST_MATH_ACCURACY>
+    inline float cos(float x)
+    {
+      float s, c;
+      sinCos<A>(x, s, c);
+      return c;
+    }
+
+    /**
+     * @brief Arctangent
+     *
+     * @tparam A Accuracy level
+     * @param x Input value (may be infinite)
+     * @return atan(x) in radians
+     */
+    template <Accuracy A = FAST_MATH_ACCURACY>
+    inline float atan(float x)
+    {
+      typedef Coefficients<A> C;
+
+      if (x > 1.0f)
+      {
+        return HALF_PI_F - oddPolynomial(C::atan(), C::ATAN_TERMS, 1.0f / x);
+      }
+      if (x < -1.0f)
+      {
+        return -HALF_PI_F - oddPolynomial(C::atan(), C::ATAN_TERMS, 1.0f / x);
+      }
+      return oddPolynomial(C::atan(), C::ATAN_TERMS, x);
+    }
+
+    /**
+     * @brief Four-quadrant arctangent
+     *
+     * @tparam A Accuracy level
+     * @param y Y component
+     * @param x X component
+     * @return atan2(y, x) in radians
+     */
+    template <Accuracy A = FAST_MATH_ACCURACY>
+    inline float atan2(float y, float x)
+    {
+      typedef Coefficients<A> C;
+
+      const float ax = x < 0 ? -x : x;
+      const float ay = y < 0 ? -y : y;
+      if (ax == 0 && ay == 0)
+      {
+        return 0;
+      }
+
+      // Evaluate in the first octant, then mirror
+      float a = (ay > ax) ? HALF_PI_F - oddPolynomial(C::atan(), C::ATAN_TERMS, ax / ay)
+                          : oddPolynomial(C::atan(), C::ATAN_TERMS, ay / ax);
+      if (x < 0)
+      {
+        a = PI_F - a;
+      }
+      return y < 0 ? -a : a;
+    }
+
+    /**
+     * @brief Square root
+     *
+     * Refines the classic bit-level reciprocal square root estimate with
+     * Newton-Raphson, then multiplies by x.
+     *
+     * @tparam A Accuracy level
+     * @param x Input value (zero or negative values return 0)
+     * @return sqrt(x)
+     */
+    template <Accuracy A = FAST_MATH_ACCURACY>
+    inline float sqrt(float x)
+    {
+      if (!(x > 0))
+      {
+        return 0;
+      }
+
+      uint32_t bits;
+      memcpy(&bits, &x, sizeof(bits));
+      bits = 0x5f3759df - (bits >> 1);
+      float r;
+      memcpy(&r, &bits, sizeof(r));
+
+      const float half = 0.5f * x;
+      for (int i = 0; i < Coefficients<A>::SQRT_ITERATIONS; i++)
+      {
+        r = r * (1.5f - half * r * r);
+      }
+      return x * r;
+    }
+
+    /**
+     * @brief Arcsine
+     *
+     * @tparam A Accuracy level
+     * @param x Input value, within [-1, 1]
+     * @return asin(x) in radians
+     */
+    template <Accuracy A = FAST_MATH_ACCURACY>
+    inline float asin(float x)
+    {
+      // (1 - x)(1 + x) keeps precision near |x| = 1, where 1 - x*x cancels
+      return atan2<A>(x, sqrt<A>((1.0f - x) * (1.0f + x)));
+    }
+
+  } // namespace math
+} // namespace stewy
@@ -0,0 +1,366 @@
+#pragma once
+/**
+ * @file FixedPoint.h
+ * @brief Q16.16 fixed-point arithmetic
+ *
+ * This file contains a small signed Q16.16 fixed-point type and the
+ * CORDIC-based math functions needed by the inverse kinematics kernel.
+ * It has no Arduino dependencies, so it can be used in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @class Fixed16
+     * @brief Signed Q16.16 fixed-point number
+     *
+     * Values are stored as a 32-bit integer with 16 fractional bits, giving a
+     * range of roughly +/-32768 with a resolution of 1/65536. Addition,
+     * subtraction, multiplication and division saturate instead of wrapping,
+     * so an out-of-range intermediate (e.g. a squared distance on an
+     * impossible pose) still compares as "too large".
+     */
+    class Fixed16
+    {
+    public:
+      static const int FRACTION_BITS = 16;           ///< Number of fractional bits
+      static const int32_t ONE = 1L << FRACTION_BITS; ///< Raw value of 1.0
+
+      int32_t raw; ///< Raw Q16.16 representation
+
+      /**
+       * @brief Construct a zero value
+       */
+      constexpr Fixed16() : raw(0) {}
+
+      /**
+       * @brief Construct from an integer
+       *
+       * @param value Integer value (must be within +/-32767)
+       */
+      constexpr Fixed16(int value) : raw(value * ONE) {}
+
+      /**
+       * @brief Construct from a floating point value, rounding to nearest
+       *
+       * @param value Floating point value (must be within +/-32767)
+       */
+      constexpr Fixed16(double value) : raw((int32_t)(value * ONE + (value >= 0 ? 0.5 : -0.5))) {}
+
+      /**
+       * @brief Construct from a raw Q16.16 value
+       *
+       * @param raw Raw value
+       * @return Fixed16 wrapping the raw value
+       */
+      static constexpr Fixed16 fromRaw(int32_t raw)
+      {
+        return Fixed16(raw, true);
+      }
+
+      /**
+       * @brief Convert to float
+       *
+       * @return Value as a float
+       */
+      float toFloat() const
+      {
+        return (float)raw / ONE;
+      }
+
+      Fixed16 operator-() const
+      {
+        return fromRaw(saturate(-(int64_t)raw));
+      }
+
+      Fixed16 operator+(Fixed16 other) const
+      {
+        return fromRaw(saturate((int64_t)raw + other.raw));
+      }
+
+      Fixed16 operator-(Fixed16 other) const
+      {
+        return fromRaw(saturate((int64_t)raw - other.raw));
+      }
+
+      Fixed16 operator*(Fixed16 other) const
+      {
+        return fromRaw(saturate(((int64_t)raw * other.raw) >> FRACTION_BITS));
+      }
+
+      Fixed16 operator/(Fixed16 other) const
+      {
+        if (other.raw == 0)
+        {
+          return fromRaw(raw >= 0 ? INT32_MAX : INT32_MIN);
+        }
+        return fromRaw(saturate(((int64_t)raw << FRACTION_BITS) / other.raw));
+      }
+
+      Fixed16 &operator+=(Fixed16 other) { return *this = *this + other; }
+      Fixed16 &operator-=(Fixed16 other) { return *this = *this - other; }
+      Fixed16 &operator*=(Fixed16 other) { return *this = *this * other; }
+
+      bool operator<(Fixed16 other) const { return raw < other.raw; }
+      bool operator>(Fixed16 other) const { return raw > other.raw; }
+      bool operator<=(Fixed16 other) const { return raw <= other.raw; }
+      bool operator>=(Fixed16 other) const { return raw >= other.raw; }
+      bool operator==(Fixed16 other) const { return raw == other.raw; }
+      bool operator!=(Fixed16 other) const { return raw != other.raw; }
+
+      /**
+       * @brief Clamp a 64-bit intermediate to the 32-bit raw range
+       *
+       * @param value Intermediate value
+       * @return Saturated raw value
+       */
+      static int32_t saturate(int64_t value)
+      {
+        return value > INT32_MAX ? INT32_MAX : (value < INT32_MIN ? INT32_MIN : (int32_t)value);
+      }
+
+    private:
+      constexpr Fixed16(int32_t raw, bool) : raw(raw) {}
+    };
+
+    namespace fixed
+    {
+      const int CORDIC_ITERATIONS = 16; ///< Residual angle error is below atan(2^-15)
+      const int ANGLE_BITS = 30;        ///< CORDIC angles are accumulated in Q2.30 to avoid table rounding drift
+
+      // atan(2^-i) in Q2.30 radians
+      const int32_t CORDIC_ATAN[CORDIC_ITERATIONS] = {
+          843314857, 497837829, 263043837, 133525159, 67021687, 33543516, 16775851, 8388437,
+          4194283, 2097149, 1048576, 524288, 262144, 131072, 65536, 32768};
+
+      const int32_t CORDIC_INV_GAIN = 39797;       ///< 1/K = 0.6072529 in Q16.16
+      const int32_t CORDIC_INV_GAIN_Q30 = 652032874; ///< 1/K in Q2.30
+      const int32_t HALF_PI_RAW = 102944;          ///< pi/2 in Q16.16
+      const int32_t PI_RAW = 205887;               ///< pi in Q16.16
+
+      /**
+       * @brief Integer square root of a 64-bit value
+       *
+       * @param value Value to take the root of
+       * @return floor(sqrt(value))
+       */
+      inline uint32_t isqrt64(uint64_t value)
+      {
+        uint64_t result = 0;
+        uint64_t bit = (uint64_t)1 << 62;
+
+        while (bit > value)
+        {
+          bit >>= 2;
+        }
+
+        while (bit != 0)
+        {
+          if (value >= result + bit)
+          {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+          }
+          else
+          {
+            result >>= 1;
+          }
+          bit >>= 2;
+        }
+
+        return (uint32_t)result;
+      }
+
+      /**
+       * @brief Square root
+       *
+       * @param x Input value (negative values return 0)
+       * @return sqrt(x)
+       */
+      inline Fixed16 sqrt(Fixed16 x)
+      {
+        if (x.raw <= 0)
+        {
+          return Fixed16();
+        }
+        return Fixed16::fromRaw((int32_t)isqrt64((uint64_t)x.raw << Fixed16::FRACTION_BITS));
+      }
+
+      /**
+       * @brief CORDIC vectoring: polar form of (x, y)
+       *
+       * Computes the magnitude and angle of the vector (x, y) in a single pass,
+       * without forming x*x + y*y (which would overflow Q16.16 for the lever
+       * lengths used by the IK). The vector is normalized first, so small
+       * inputs keep their full angular resolution.
+       *
+       * @param x X component
+       * @param y Y component
+       * @param magnitude Receives sqrt(x^2 + y^2)
+       * @param angle Receives atan2(y, x) in radians
+       */
+      inline void polar(Fixed16 x, Fixed16 y, Fixed16 &magnitude, Fixed16 &angle)
+      {
+        int64_t vx = x.raw;
+        int64_t vy = y.raw;
+        int32_t quadrant = 0;
+
+        // Rotate into the right half-plane, where CORDIC converges
+        if (vx < 0)
+        {
+          int64_t t = vx;
+          if (vy >= 0)
+          {
+            vx = vy;
+            vy = -t;
+            quadrant = HALF_PI_RAW;
+          }
+          else
+          {
+            vx = -vy;
+            vy = t;
+            quadrant = -HALF_PI_RAW;
+          }
+        }
+
+        uint64_t largest = (uint64_t)(vx > (vy < 0 ? -vy : vy) ? vx : (vy < 0 ? -vy : vy));
+        if (largest == 0)
+        {
+          magnitude = Fixed16();
+          angle = Fixed16::fromRaw(quadrant);
+          return;
+        }
+
+        // Normalize so the largest component has its top bit at bit 40
+        const int shift = __builtin_clzll(largest) - 23;
+        vx = shift >= 0 ? vx << shift : vx >> -shift;
+        vy = shift >= 0 ? vy << shift : vy >> -shift;
+
+        int32_t z = 0;
+        for (int i = 0; i < CORDIC_ITERATIONS; i++)
+        {
+          int64_t dx = vy >> i;
+          int64_t dy = vx >> i;
+          if (vy > 0)
+          {
+            vx += dx;
+            vy -= dy;
+            z += CORDIC_ATAN[i];
+          }
+          else
+          {
+            vx -= dx;
+            vy += dy;
+            z -= CORDIC_ATAN[i];
+          }
+        }
+
+        const int64_t scaled = shift >= 0 ? vx >> shift : vx << -shift;
+        magnitude = Fixed16::fromRaw(Fixed16::saturate((scaled * CORDIC_INV_GAIN) >> Fixed16::FRACTION_BITS));
+        angle = Fixed16::fromRaw(quadrant + ((z + (1 << (ANGLE_BITS - Fixed16::FRACTION_BITS - 1))) >> (ANGLE_BITS - Fixed16::FRACTION_BITS)));
+      }
+
+      /**
+       * @brief Four-quadrant arctangent
+       *
+       * @param y Y component
+       * @param x X component
+       * @return atan2(y, x) in radians
+       */
+      inline Fixed16 atan2(Fixed16 y, Fixed16 x)
+      {
+        Fixed16 magnitude, angle;
+        polar(x, y, magnitude, angle);
+        return angle;
+      }
+
+      /**
+       * @brief CORDIC rotation: sine and cosine of an angle
+       *
+       * @param angle Angle in radians, within [-pi, pi]
+       * @param s Receives sin(angle)
+       * @param c Receives cos(angle)
+       */
+      inline void sinCos(Fixed16 angle, Fixed16 &s, Fixed16 &c)
+      {
+        int32_t a = angle.raw;
+        int32_t sign = 1;
+
+        // Reduce to [-pi/2, pi/2]; both outputs change sign in the outer quadrants
+        if (a > HALF_PI_RAW)
+        {
+          a -= PI_RAW;
+          sign = -1;
+        }
+        else if (a < -HALF_PI_RAW)
+        {
+          a += PI_RAW;
+          sign = -1;
+        }
+
+        int32_t z = a << (ANGLE_BITS - Fixed16::FRACTION_BITS);
+        int32_t vx = CORDIC_INV_GAIN_Q30;
+        int32_t vy = 0;
+
+        for (int i = 0; i < CORDIC_ITERATIONS; i++)
+        {
+          int32_t dx = vy >> i;
+          int32_t dy = vx >> i;
+          if (z >= 0)
+          {
+            vx -= dx;
+            vy += dy;
+            z -= CORDIC_ATAN[i];
+          }
+          else
+          {
+            vx += dx;
+            vy -= dy;
+            z += CORDIC_ATAN[i];
+          }
+        }
+
+        const int round = 1 << (ANGLE_BITS - Fixed16::FRACTION_BITS - 1);
+        c = Fixed16::fromRaw(sign * ((vx + round) >> (ANGLE_BITS - Fixed16::FRACTION_BITS)));
+        s = Fixed16::fromRaw(sign * ((vy + round) >> (ANGLE_BITS - Fixed16::FRACTION_BITS)));
+      }
+
+      /**
+       * @brief Arcsine
+       *
+       * @param x Input value, within [-1, 1]
+       * @return asin(x) in radians
+       */
+      inline Fixed16 asin(Fixed16 x)
+      {
+        // sqrt((1 - x)(1 + x)), taken from the exact Q32 product to keep precision near |x| = 1
+        const int64_t q32 = (int64_t)(Fixed16::ONE - x.raw) * (Fixed16::ONE + x.raw);
+        return atan2(x, Fixed16::fromRaw(q32 > 0 ? (int32_t)isqrt64((uint64_t)q32) : 0));
+      }
+
+    } // namespace fixed
+
+  } // namespace core
+} // namespace stewy
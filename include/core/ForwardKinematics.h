@@ -0,0 +1,126 @@
+#pragma once
+/**
+ * @file ForwardKinematics.h
+ * @brief Newton-Raphson forward kinematics
+ *
+ * This file contains an estimator of the platform pose from the servo
+ * angles, by iteratively inverting the IK kernel. It has no Arduino
+ * dependencies, so it can be used in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/IkKernel.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @struct FkStats
+     * @brief Forward kinematics convergence statistics
+     */
+    struct FkStats
+    {
+      unsigned long estimates;  ///< Number of estimates
+      unsigned long converged;  ///< Number of estimates that reached the tolerance
+      unsigned long iterations; ///< Total Newton-Raphson iterations, over all estimates
+      unsigned long solves;     ///< Total IK kernel solves, over all estimates
+      int lastIterations;       ///< Iterations of the last estimate
+      float lastResidual;       ///< Largest servo angle residual of the last estimate, in degrees (before AGGRO)
+    };
+
+    /**
+     * @class ForwardKinematics
+     * @brief Estimates the platform pose that produces a set of servo angles
+     *
+     * There is no closed form for the forward kinematics of a Stewart
+     * platform, so the pose is found with Newton-Raphson on the IK:
+     * starting from the previous estimate, each iteration solves the IK at
+     * the current pose, estimates its Jacobian by forward differences (6
+     * more solves), and steps by the solution of the linearized 6x6 system.
+     * Steps that leave the workspace are halved until they do not.
+     *
+     * The servo angles change little between control ticks, so the warm
+     * start usually converges in one or two iterations. The iteration count
+     * is bounded: an estimate typically costs (7 * maxIterations + 1) solves,
+     * and at most (16 * maxIterations + 2), when it restarts from home, falls
+     * back to backward differences at the workspace boundary and halves
+     * every step.
+     *
+     * Poses are arrays of 6 floats: sway, surge, heave (mm), pitch, roll,
+     * yaw (degrees). Servo angles that were clamped to the servo range
+     * carry no information beyond the limit, so the estimate for them is
+     * the closest pose in the least-squares sense of the Newton step.
+     */
+    class ForwardKinematics
+    {
+    public:
+      /**
+       * @brief Construct a new ForwardKinematics
+       *
+       * @param maxIterations Largest number of Newton-Raphson iterations per estimate
+       * @param tolerance Largest servo angle residual that counts as converged, in degrees (before AGGRO)
+       * @param step Forward difference step of the Jacobian estimate, in mm or degrees
+       */
+      ForwardKinematics(int maxIterations, float tolerance, float step);
+
+      /**
+       * @brief Restart the next estimate from the home pose
+       */
+      void reset();
+
+      /**
+       * @brief Estimate the pose from servo angles
+       *
+       * @param kernel IK kernel to invert
+       * @param servoValues Array of 6 servo angles in degrees, as written to the servos
+       * @param pose Array of 6 floats that receives the estimated pose
+       * @return true if the estimate converged to within the tolerance
+       * @return false if it did not (pose still receives the best estimate)
+       */
+      bool estimate(const IkKernel<ik_scalar_t> &kernel, const float *servoValues, float *pose);
+
+      /**
+       * @brief Get the last estimate
+       *
+       * @return const float* Array of 6 floats: sway, surge, heave, pitch, roll, yaw (home before the first estimate)
+       */
+      const float *getPose() const;
+
+      /**
+       * @brief Get the convergence statistics
+       *
+       * @return const FkStats& Statistics since construction
+       */
+      const FkStats &getStats() const;
+
+    private:
+      int _maxIterations; ///< Largest number of iterations per estimate
+      float _tolerance;   ///< Convergence tolerance, in degrees
+      float _step;        ///< Forward difference step
+
+      float _pose[6]; ///< Last estimate, the warm start of the next one
+      FkStats _stats; ///< Convergence statistics
+
+      bool evaluate(const IkKernel<ik_scalar_t> &kernel, const float *pose, const float *target, float *residual);
+    };
+
+  } // namespace core
+} // namespace stewy
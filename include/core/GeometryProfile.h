@@ -0,0 +1,190 @@
+#pragma once
+/**
+ * @file GeometryProfile.h
+ * @brief Platform geometry that can be changed at runtime
+ *
+ * This file contains the runtime counterpart of the defines in
+ * PlatformGeometry.h: a geometry that can be set over the command line or
+ * restored from a stored record, together with the IK constants derived from
+ * it. It has no Arduino dependencies, so it can be used in host-side tools;
+ * storing the record (EEPROM) is up to the caller.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include "core/IkKernel.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @struct GeometryParam
+     * @brief A tunable field of GeometryDescription
+     */
+    struct GeometryParam
+    {
+      const char *name;                   ///< Name of the define in PlatformGeometry.h
+      double GeometryDescription::*field; ///< Field of the description
+    };
+
+    const int GEOMETRY_PARAM_COUNT = 9; ///< Number of tunable fields
+
+    /**
+     * @brief The tunable fields, in record order
+     *
+     * The axis and servo plane angles describe how the platform is built
+     * rather than how large it is, and stay those of DEFAULT_GEOMETRY.
+     */
+    extern const GeometryParam GEOMETRY_PARAMS[GEOMETRY_PARAM_COUNT];
+
+    const uint32_t GEOMETRY_RECORD_MAGIC = 0x4f454753; ///< "SGEO", little endian
+    const uint16_t GEOMETRY_RECORD_VERSION = 1;        ///< Bump when the record layout changes
+
+    /**
+     * @struct GeometryRecord
+     * @brief Stored form of a geometry, e.g. in EEPROM
+     */
+    struct GeometryRecord
+    {
+      uint32_t magic;                     ///< GEOMETRY_RECORD_MAGIC
+      uint16_t version;                   ///< GEOMETRY_RECORD_VERSION
+      uint16_t size;                      ///< sizeof(GeometryRecord)
+      float values[GEOMETRY_PARAM_COUNT]; ///< Tunable fields, in GEOMETRY_PARAMS order
+      uint32_t checksum;                  ///< FNV-1a of all the bytes above
+    };
+
+    /**
+     * @class GeometryProfile
+     * @brief The current platform geometry and its IK constants
+     *
+     * Every constant the IK derives from the geometry is computed once, when
+     * the geometry is set, into a flat IkGeometry block that kernels read
+     * directly (see IkKernel). The block is updated in place, so kernels
+     * built on it follow every change.
+     *
+     * Each change increments a revision number, so that anything cached
+     * from the previous geometry can tell that it is stale.
+     */
+    class GeometryProfile
+    {
+    public:
+      /**
+       * @brief Construct a profile with DEFAULT_GEOMETRY
+       *
+       * constexpr, so that a static profile is initialized before any
+       * constructor runs, and can be used by other static objects.
+       */
+      constexpr GeometryProfile()
+          : _description(DEFAULT_GEOMETRY), _ik(GeometryTables<ik_scalar_t>::ik), _revision(0)
+      {
+      }
+
+      /**
+       * @brief Check that a geometry is physically meaningful
+       *
+       * All lengths must be positive, the joint offsets within [0, 60)
+       * degrees of their axis, and the home height within reach of the
+       * arms and rods. In Q16.16 fixed point, ARM_LENGTH + ROD_LENGTH must
+       * also stay below 181 mm.
+       *
+       * @param g Geometry to check
+       * @return true if the IK can use it
+       */
+      static bool isValid(const GeometryDescription &g);
+
+      /**
+       * @brief Change the geometry
+       *
+       * @param g New geometry
+       * @return true if it was applied, false if it is not valid (nothing changes)
+       */
+      bool set(const GeometryDescription &g);
+
+      /**
+       * @brief Change one tunable field
+       *
+       * @param name Name of the field, as in GEOMETRY_PARAMS
+       * @param value New value
+       * @return true if it was applied, false if the name is unknown or the result is not valid
+       */
+      bool setParam(const char *name, double value);
+
+      /**
+       * @brief Go back to DEFAULT_GEOMETRY
+       */
+      void reset();
+
+      /**
+       * @brief Whether the geometry is DEFAULT_GEOMETRY
+       *
+       * Data generated offline (e.g. the WorkspaceMap) only holds for the
+       * default geometry.
+       *
+       * @return true if no tunable field differs from the defines
+       */
+      bool isDefault() const;
+
+      /**
+       * @brief Get the geometry
+       *
+       * @return Current geometry
+       */
+      const GeometryDescription &getDescription() const;
+
+      /**
+       * @brief Get the IK constants of the geometry
+       *
+       * @return Constant block, valid for the lifetime of the profile
+       */
+      const IkGeometry<ik_scalar_t> &getIk() const;
+
+      /**
+       * @brief Get the revision number
+       *
+       * @return Number of changes since construction
+       */
+      uint16_t getRevision() const;
+
+      /**
+       * @brief Write the geometry to a record
+       *
+       * @param record Receives the tunable fields, with magic, version and checksum
+       */
+      void toRecord(GeometryRecord &record) const;
+
+      /**
+       * @brief Apply the geometry of a record
+       *
+       * @param record Stored record
+       * @return true if it was applied, false if the record is blank, corrupt, of another version or not valid (nothing changes)
+       */
+      bool fromRecord(const GeometryRecord &record);
+
+    private:
+      GeometryDescription _description; ///< Current geometry
+      IkGeometry<ik_scalar_t> _ik;      ///< IK constants derived from it
+      uint16_t _revision;               ///< Number of changes
+
+      static uint32_t checksum(const GeometryRecord &record);
+    };
+
+  } // namespace core
+} // namespace stewy
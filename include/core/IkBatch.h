@@ -0,0 +1,130 @@
+#pragma once
+/**
+ * @file IkBatch.h
+ * @brief Output buffers of the batch IK
+ *
+ * This file contains the structure-of-arrays servo frame buffer and the
+ * feasibility bitmask filled by IkKernel::solveBatch. Both wrap storage
+ * supplied by the caller, so they can sit on static arrays on the device and
+ * on vectors on the host. It has no Arduino dependencies, so it can be used
+ * in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @struct ServoFrameSoA
+     * @brief Servo angles of a sequence of frames, one array per servo
+     *
+     * servo[i][k] is the angle of servo i in frame k, in degrees. Keeping
+     * each servo contiguous lets the batch solve write each leg in one
+     * sequential pass, and lets a player stream one servo at a time.
+     */
+    struct ServoFrameSoA
+    {
+      float *servo[6]; ///< Angles of each servo, capacity entries each
+      size_t capacity; ///< Number of frames the arrays can hold
+
+      /**
+       * @brief Wrap a contiguous buffer of 6 * frames floats
+       *
+       * @param storage Buffer of at least 6 * frames floats, owned by the caller
+       * @param frames Number of frames
+       */
+      ServoFrameSoA(float *storage, size_t frames) : capacity(frames)
+      {
+        for (int i = 0; i < 6; i++)
+        {
+          servo[i] = storage + i * frames;
+        }
+      }
+
+      /**
+       * @brief Copy the angles of one frame into a float[6]
+       *
+       * @param frame Frame index
+       * @param servoValues Array of 6 floats that receives the angles
+       */
+      void getFrame(size_t frame, float *servoValues) const
+      {
+        for (int i = 0; i < 6; i++)
+        {
+          servoValues[i] = servo[i][frame];
+        }
+      }
+    };
+
+    /**
+     * @struct FeasibilityMask
+     * @brief One bit per frame, set if the IK solved the pose
+     */
+    struct FeasibilityMask
+    {
+      uint32_t *words; ///< Bits, 32 frames per word
+      size_t capacity; ///< Number of frames the bits can hold
+
+      /**
+       * @brief Wrap a buffer of wordsFor(frames) words
+       *
+       * @param storage Buffer of at least wordsFor(frames) words, owned by the caller
+       * @param frames Number of frames
+       */
+      FeasibilityMask(uint32_t *storage, size_t frames) : words(storage), capacity(frames) {}
+
+      /**
+       * @brief Number of words needed for a number of frames
+       *
+       * @param frames Number of frames
+       * @return size_t Number of uint32_t words
+       */
+      static size_t wordsFor(size_t frames) { return (frames + 31) / 32; }
+
+      /**
+       * @brief Set or clear the bit of a frame
+       *
+       * @param frame Frame index
+       * @param feasible New value of the bit
+       */
+      void set(size_t frame, bool feasible)
+      {
+        const uint32_t bit = (uint32_t)1 << (frame & 31);
+        words[frame >> 5] = feasible ? (words[frame >> 5] | bit) : (words[frame >> 5] & ~bit);
+      }
+
+      /**
+       * @brief Test the bit of a frame
+       *
+       * @param frame Frame index
+       * @return true if the pose of the frame was solved
+       */
+      bool test(size_t frame) const
+      {
+        return (words[frame >> 5] >> (frame & 31)) & 1;
+      }
+    };
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,685 @@
+#pragma once
+/**
+ * @file IkKernel.h
+ * @brief Inverse kinematics kernel, templated on its scalar type
+ *
+ * This file contains the inner inverse kinematics solve used by
+ * Platform::moveTo. The kernel is a template over the scalar type, so the
+ * same code can run in double, single precision float or Q16.16 fixed point.
+ * It has no Arduino dependencies, so host-side tools can use it directly.
+ *
+ * Accuracy against the double precision kernel, measured over the full
+ * PITCH/ROLL/YAW/SWAY/SURGE/HEAVE envelope with tools/IkBenchmark:
+ * - float:  better than 0.002 degrees of servo angle with libm (0.0007
+ *           measured), 0.01 degrees with USE_FAST_MATH (0.0068 measured, see
+ *           Config.h)
+ * - Q16.16: better than 0.15 degrees of servo angle (0.126 measured)
+ * In both, poses within rounding distance of the reach limits may be
+ * accepted or rejected differently than in double precision. IkBenchmark
+ * fails if these bounds are exceeded.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include "core/PlatformGeometry.h"
+#include "core/FixedPoint.h"
+#include "core/FastMath.h"
+#include "core/Pose.h"
+#include "core/IkBatch.h"
+#include "core/Orientation.h"
+
+// The firmware takes USE_FAST_MATH from Config.h. Host tools build without the
+// Arduino libraries Config.h needs, and define it on the command line instead
+#if defined(ARDUINO) || defined(STEWY_NATIVE)
+#include "core/Config.h"
+#endif
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @enum IkStatus
+     * @brief Outcome of a single IK solve
+     */
+    enum IkStatus
+    {
+      IK_OK,                 ///< All six legs were solved
+      IK_DISTANCE_TOO_GREAT, ///< A platform joint is out of reach of its servo arm and rod
+      IK_ASYMPTOTIC          ///< No servo angle satisfies the leg equation (|k / sqrt(l^2 + m^2)| >= 1)
+    };
+
+    /**
+     * @struct ScalarOps
+     * @brief Math operations used by the IK kernel, per scalar type
+     *
+     * Each specialization provides conversions and the handful of math
+     * functions the kernel needs.
+     */
+    template <typename T>
+    struct ScalarOps;
+
+    template <>
+    struct ScalarOps<double>
+    {
+      static double fromFloat(float v) { return v; }
+      static float toFloat(double v) { return (float)v; }
+      static void sinCos(double a, double &s, double &c)
+      {
+        s = ::sin(a);
+        c = ::cos(a);
+      }
+      static void polar(double x, double y, double &magnitude, double &angle)
+      {
+        magnitude = ::sqrt(x * x + y * y);
+        angle = ::atan2(y, x);
+      }
+      static double asin(double v) { return ::asin(v); }
+    };
+
+    template <>
+    struct ScalarOps<float>
+    {
+      static float fromFloat(float v) { return v; }
+      static float toFloat(float v) { return v; }
+#ifdef USE_FAST_MATH
+      static void sinCos(float a, float &s, float &c) { math::sinCos(a, s, c); }
+      static void polar(float x, float y, float &magnitude, float &angle)
+      {
+        magnitude = math::sqrt(x * x + y * y);
+        angle = math::atan2(y, x);
+      }
+      static float asin(float v) { return math::asin(v); }
+#else
+      static void sinCos(float a, float &s, float &c)
+      {
+        s = ::sinf(a);
+        c = ::cosf(a);
+      }
+      static void polar(float x, float y, float &magnitude, float &angle)
+      {
+        magnitude = ::sqrtf(x * x + y * y);
+        angle = ::atan2f(y, x);
+      }
+      static float asin(float v) { return ::asinf(v); }
+#endif
+    };
+
+    template <>
+    struct ScalarOps<Fixed16>
+    {
+      static Fixed16 fromFloat(float v) { return Fixed16((double)v); }
+      static float toFloat(Fixed16 v) { return v.toFloat(); }
+      static void sinCos(Fixed16 a, Fixed16 &s, Fixed16 &c) { fixed::sinCos(a, s, c); }
+      static void polar(Fixed16 x, Fixed16 y, Fixed16 &magnitude, Fixed16 &angle) { fixed::polar(x, y, magnitude, angle); }
+      static Fixed16 asin(Fixed16 v) { return fixed::asin(v); }
+    };
+
+    /**
+     * @class IkKernel
+     * @brief Closed-form IK solve for all six legs
+     *
+     * All geometry-derived constants are read from one IkGeometry block,
+     * either the compile-time GeometryTables in flash or the block of a
+     * GeometryProfile loaded at runtime, and the servo range constants are
+     * computed once in the constructor, so a solve only evaluates the trig of
+     * the requested orientation plus one polar conversion and one arcsine per
+     * leg.
+     *
+     * The kernel keeps a reference to the block, so a geometry change made
+     * in place (GeometryProfile::set) applies to the next solve.
+     *
+     * @tparam T Scalar type: double, float or Fixed16
+     */
+    template <typename T>
+    class IkKernel
+    {
+    public:
+      /**
+       * @brief Construct a new IkKernel
+       *
+       * @param servo_min_angle Minimum servo angle in degrees
+       * @param servo_max_angle Maximum servo angle in degrees
+       * @param geometry IK constants of the platform; must outlive the kernel
+       */
+      IkKernel(int servo_min_angle, int servo_max_angle, const IkGeometry<T> &geometry = GeometryTables<T>::ik);
+
+      /**
+       * @brief Solve servo angles for a pose
+       *
+       * Angles are written to servoValues leg by leg, as in the original
+       * algorithm. On IK_OK, the AGGRO scaling has been applied to all six.
+       * On failure the content of servoValues is undefined (the caller is
+       * expected to restore it), except with SLAM defined, where the failing
+       * leg is slammed to its limit and AGGRO is applied as for IK_OK.
+       *
+       * @param servoValues Array of 6 floats that receives the servo angles in degrees
+       * @param sway Translation along X axis in mm
+       * @param surge Translation along Y axis in mm
+       * @param heave Translation along Z axis in mm
+       * @param pitch Rotation around X axis in degrees
+       * @param roll Rotation around Y axis in degrees
+       * @param yaw Rotation around Z axis in degrees
+       * @param failedLeg Receives the index of the failing leg, if any
+       * @param value Receives the offending value: the distance in mm for IK_DISTANCE_TOO_GREAT, the ratio for IK_ASYMPTOTIC
+       * @return IkStatus IK_OK on success, otherwise the reason for failure
+       */
+      IkStatus solve(float *servoValues, float sway, float surge, float heave,
+                     float pitch, float roll, float yaw, int &failedLeg, float &value) const;
+
+      /**
+       * @brief Solve servo angles for a pose given as a rotation matrix
+       *
+       * Same as solve(), without any trig for the orientation: the Euler
+       * overload builds this matrix from its angles, then solves the same way.
+       *
+       * @param servoValues Array of 6 floats that receives the servo angles in degrees
+       * @param sway Translation along X axis in mm
+       * @param surge Translation along Y axis in mm
+       * @param heave Translation along Z axis in mm
+       * @param rotation Orientation of the platform
+       * @param failedLeg Receives the index of the failing leg, if any
+       * @param value Receives the offending value, as for solve()
+       * @return IkStatus IK_OK on success, otherwise the reason for failure
+       */
+      IkStatus solve(float *servoValues, float sway, float surge, float heave,
+                     const RotationMatrix &rotation, int &failedLeg, float &value) const;
+
+      /**
+       * @brief Solve unshaped servo angles for a pose
+       *
+       * Same as solve(), but the angles are neither clamped to the servo range
+       * nor scaled by AGGRO. Both are kinks in the otherwise smooth IK, so
+       * anything that interpolates between solutions (e.g. PitchRollTable)
+       * should interpolate these angles and call shape() on the result.
+       *
+       * @param servoValues Array of 6 floats that receives the unshaped servo angles in degrees
+       * @param sway Translation along X axis in mm
+       * @param surge Translation along Y axis in mm
+       * @param heave Translation along Z axis in mm
+       * @param pitch Rotation around X axis in degrees
+       * @param roll Rotation around Y axis in degrees
+       * @param yaw Rotation around Z axis in degrees
+       * @param failedLeg Receives the index of the failing leg, if any
+       * @param value Receives the offending value, as for solve()
+       * @return IkStatus IK_OK on success, otherwise the reason for failure
+       */
+      IkStatus solveRaw(float *servoValues, float sway, float surge, float heave,
+                        float pitch, float roll, float yaw, int &failedLeg, float &value) const;
+
+      /**
+       * @brief Solve unshaped servo angles for a pose given as a rotation matrix
+       *
+       * Same as solveRaw(), without any trig for the orientation.
+       *
+       * @param servoValues Array of 6 floats that receives the unshaped servo angles in degrees
+       * @param sway Translation along X axis in mm
+       * @param surge Translation along Y axis in mm
+       * @param heave Translation along Z axis in mm
+       * @param rotation Orientation of the platform
+       * @param failedLeg Receives the index of the failing leg, if any
+       * @param value Receives the offending value, as for solve()
+       * @return IkStatus IK_OK on success, otherwise the reason for failure
+       */
+      IkStatus solveRaw(float *servoValues, float sway, float surge, float heave,
+                        const RotationMatrix &rotation, int &failedLeg, float &value) const;
+
+      /**
+       * @brief Check unshaped servo angles against a pose, without solving it
+       *
+       * Checks the reach of each leg as solveRaw() does, then estimates how
+       * far each angle is from the exact one with a Newton step on the leg
+       * closure equation. This takes the orientation trig and one sinCos per
+       * leg, but no square root or inverse trig, so it is cheaper than a
+       * solve. IncrementalIk uses it to vet its linear predictions.
+       *
+       * @param servoValues Array of 6 unshaped servo angles in degrees
+       * @param sway Translation along X axis in mm
+       * @param surge Translation along Y axis in mm
+       * @param heave Translation along Z axis in mm
+       * @param pitch Rotation around X axis in degrees
+       * @param roll Rotation around Y axis in degrees
+       * @param yaw Rotation around Z axis in degrees
+       * @param error Receives the largest estimated angle error, in degrees; HUGE_VALF if an angle is past the solution solveRaw() would pick
+       * @param failedLeg Receives the index of the failing leg, if any
+       * @param value Receives the offending value, as for solve()
+       * @return IkStatus IK_OK if every leg can be solved, otherwise the reason for failure
+       */
+      IkStatus check(const float *servoValues, float sway, float surge, float heave,
+                     float pitch, float roll, float yaw, float &error, int &failedLeg, float &value) const;
+
+      /**
+       * @brief Clamp unshaped angles to the servo range and apply AGGRO
+       *
+       * @param servoValues Array of 6 unshaped servo angles, shaped in place
+       */
+      void shape(float *servoValues) const;
+
+      /**
+       * @brief Undo the AGGRO scaling of shaped angles
+       *
+       * Inverse of shape() for angles that were not clamped to the servo
+       * range. Clamped angles map back to the servo limit, before AGGRO.
+       *
+       * @param servoValues Array of 6 shaped servo angles
+       * @param angles Array of 6 floats that receives the unshaped angles
+       */
+      void unshape(const float *servoValues, float *angles) const;
+
+      /**
+       * @brief Solve many poses in one pass
+       *
+       * Stateless: each pose is solved as by solve(), without SLAM, and the
+       * shaped angles of feasible poses are written to out. This is for the
+       * layout of the result, one array per servo, not for speed: it costs
+       * the same as calling solve() on each pose (see tools/IkBatchBenchmark).
+       *
+       * Angles of infeasible poses are undefined. Poses beyond the capacity
+       * of out or mask are not solved.
+       *
+       * @param poses Array of n poses
+       * @param n Number of poses
+       * @param out Receives the shaped servo angles of each pose
+       * @param mask Receives one bit per pose, set if all six legs were solved
+       * @return size_t Number of feasible poses
+       */
+      size_t solveBatch(const Pose *poses, size_t n, ServoFrameSoA &out, FeasibilityMask &mask) const;
+
+    private:
+      typedef ScalarOps<T> Ops;
+
+      /**
+       * @struct Transform
+       * @brief Platform joint position as an affine function of its coordinates in the platform plane
+       *
+       * pivot = (px * ax + py * bx + cx, px * ay + py * by + cy, px * az + py * bz + cz)
+       */
+      struct Transform
+      {
+        T ax, bx, cx; ///< X row
+        T ay, by, cy; ///< Y row
+        T az, bz, cz; ///< Z row
+      };
+
+      /**
+       * @brief Evaluate the trig of a pose once, for all legs
+       */
+      void transform(float sway, float surge, float heave, float pitch, float roll, float yaw, Transform &t) const;
+
+      /**
+       * @brief Convert a rotation matrix pose to the scalar type, for all legs
+       */
+      void transform(float sway, float surge, float heave, const RotationMatrix &rotation, Transform &t) const;
+
+      /**
+       * @brief Place the platform joints: the rotation, then the translation and rotation point
+       */
+      void place(T tx, T ty, T th, const Rotation<T> &r, Transform &t) const;
+
+      /**
+       * @brief Solve the unshaped angles of all six legs
+       */
+      IkStatus solveLegs(float *servoValues, const Transform &t, int &failedLeg, float &value) const;
+
+      /**
+       * @brief Shape the angles of a solve, if it succeeded (or with SLAM defined, was slammed)
+       */
+      IkStatus finish(float *servoValues, IkStatus status) const;
+
+      /**
+       * @brief Solve the unshaped angle of one leg
+       *
+       * With SLAM defined, servoValue receives the slammed limit on IK_ASYMPTOTIC.
+       */
+      IkStatus solveLeg(const LegGeometry<T> &leg, const Transform &t, float &servoValue, float &value) const;
+
+      /**
+       * @brief Clamp one unshaped angle to the servo range and apply AGGRO
+       */
+      float shapeAngle(float v) const;
+
+      const IkGeometry<T> &_geometry; ///< Geometry-derived constants (GeometryTables in flash, or a GeometryProfile)
+
+      T _degToRad;     ///< PI / 180
+      T _radToServo;   ///< Servo degrees per radian of arm angle
+      T _servoOffset;  ///< Servo angle at zero radians
+      float _midAngle; ///< Center of the servo range, for AGGRO scaling
+      float _servoMin; ///< Minimum servo angle
+      float _servoMax; ///< Maximum servo angle
+    };
+
+    // Selected kernel scalar type (see IK_SCALAR_FLOAT / IK_SCALAR_FIXED in PlatformGeometry.h)
+#if defined(IK_SCALAR_FIXED)
+    static_assert((ARM_LENGTH + ROD_LENGTH) < 181, "Q16.16 IK requires (ARM_LENGTH + ROD_LENGTH)^2 < 32768");
+    typedef Fixed16 ik_scalar_t;
+#elif defined(IK_SCALAR_FLOAT)
+    typedef float ik_scalar_t;
+#else
+    typedef double ik_scalar_t;
+#endif
+
+    template <typename T>
+    IkKernel<T>::IkKernel(int servo_min_angle, int servo_max_angle, const IkGeometry<T> &geometry)
+        : _geometry(geometry)
+    {
+      const double angle_range = servo_max_angle - servo_min_angle;
+
+      _degToRad = T(GEOMETRY_PI / 180.0);
+
+      // Equivalent to map(degrees(rad), -90, 90, min, max)
+      _radToServo = T(angle_range / GEOMETRY_PI);
+      _servoOffset = T(servo_min_angle + angle_range / 2);
+
+      _midAngle = (float)(servo_min_angle + angle_range / 2);
+      _servoMin = (float)servo_min_angle;
+      _servoMax = (float)servo_max_angle;
+    }
+
+    template <typename T>
+    IkStatus IkKernel<T>::solve(float *servoValues, float sway, float surge, float heave,
+                                float pitch, float roll, float yaw, int &failedLeg, float &value) const
+    {
+      return finish(servoValues, solveRaw(servoValues, sway, surge, heave, pitch, roll, yaw, failedLeg, value));
+    }
+
+    template <typename T>
+    IkStatus IkKernel<T>::solve(float *servoValues, float sway, float surge, float heave,
+                                const RotationMatrix &rotation, int &failedLeg, float &value) const
+    {
+      return finish(servoValues, solveRaw(servoValues, sway, surge, heave, rotation, failedLeg, value));
+    }
+
+    template <typename T>
+    IkStatus IkKernel<T>::finish(float *servoValues, IkStatus status) const
+    {
+#ifdef SLAM
+      if (status == IK_OK || status == IK_ASYMPTOTIC)
+#else
+      if (status == IK_OK)
+#endif
+      {
+        shape(servoValues);
+      }
+
+      return status;
+    }
+
+    template <typename T>
+    IkStatus IkKernel<T>::solveRaw(float *servoValues, float sway, float surge, float heave,
+                                   float pitch, float roll, float yaw, int &failedLeg, float &value) const
+    {
+      Transform t;
+      transform(sway, surge, heave, pitch, roll, yaw, t);
+      return solveLegs(servoValues, t, failedLeg, value);
+    }
+
+    template <typename T>
+    IkStatus IkKernel<T>::solveRaw(float *servoValues, float sway, float surge, float heave,
+                                   const RotationMatrix &rotation, int &failedLeg, float &value) const
+    {
+      Transform t;
+      transform(sway, surge, heave, rotation, t);
+      return solveLegs(servoValues, t, failedLeg, value);
+    }
+
+    template <typename T>
+    IkStatus IkKernel<T>::solveLegs(float *servoValues, const Transform &t, int &failedLeg, float &value) const
+    {
+      for (int i = 0; i < 6; i++)
+      {
+        const IkStatus status = solveLeg(_geometry.legs[i], t, servoValues[i], value);
+        if (status != IK_OK)
+        {
+          failedLeg = i;
+          return status;
+        }
+      }
+
+      return IK_OK;
+    }
+
+    template <typename T>
+    IkStatus IkKernel<T>::check(const float *servoValues, float sway, float surge, float heave,
+                                float pitch, float roll, float yaw, float &error, int &failedLeg, float &value) const
+    {
+      Transform t;
+      transform(sway, surge, heave, pitch, roll, yaw, t);
+      const float radToServo = Ops::toFloat(_radToServo);
+
+      error = 0;
+      for (int i = 0; i < 6; i++)
+      {
+        const LegGeometry<T> &leg = _geometry.legs[i];
+        const T pivot_x = leg.px * t.ax + leg.py * t.bx + t.cx;
+        const T pivot_y = leg.px * t.ay + leg.py * t.by + t.cy;
+        const T pivot_z = leg.px * t.az + leg.py * t.bz + t.cz;
+
+        const T dx = pivot_x - leg.bx;
+        const T dy = pivot_y - leg.by;
+        const T d2 = dx * dx + dy * dy + pivot_z * pivot_z;
+
+        if (d2 > _geometry.maxReachSq)
+        {
+          failedLeg = i;
+          value = sqrtf(Ops::toFloat(d2));
+          return IK_DISTANCE_TOO_GREAT;
+        }
+
+        // The same terms as solveLeg(), in float: their squares overflow Q16.16
+        const float k = Ops::toFloat(d2 - _geometry.kOffset);
+        const float l = Ops::toFloat(_geometry.twoArm * pivot_z);
+        const float m = Ops::toFloat(_geometry.twoArm * (leg.cosS * dx + leg.sinS * dy));
+        const float divisor2 = l * l + m * m;
+
+        if (k * k >= divisor2)
+        {
+          failedLeg = i;
+          value = k / sqrtf(divisor2);
+          return IK_ASYMPTOTIC;
+        }
+
+        // solveLeg() finds the arm angle a where l sin(a) + m cos(a) = k, on the side where the slope
+        // l cos(a) - m sin(a) is positive. The residual over the slope is the Newton step to it
+        T sa, ca;
+        Ops::sinCos((Ops::fromFloat(servoValues[i]) - _servoOffset) / _radToServo, sa, ca);
+        const float s = Ops::toFloat(sa);
+        const float c = Ops::toFloat(ca);
+        const float residual = l * s + m * c - k;
+        const float slope = l * c - m * s;
+        if (slope <= 0)
+        {
+          error = HUGE_VALF;
+          continue;
+        }
+        error = fmaxf(error, fabsf(residual / slope * radToServo));
+      }
+
+      return IK_OK;
+    }
+
+    template <typename T>
+    void IkKernel<T>::transform(float sway, float surge, float heave, float pitch, float roll, float yaw,
+                                Transform &t) const
+    {
+      // Trigonometry of the requested orientation (only calculated once)
+      T sr, cr, sp, cp, sy, cy;
+      Ops::sinCos(Ops::fromFloat(roll) * _degToRad, sr, cr);
+      Ops::sinCos(Ops::fromFloat(pitch) * _degToRad, sp, cp);
+      Ops::sinCos(Ops::fromFloat(yaw) * _degToRad, sy, cy);
+
+      Rotation<T> r;
+      orientation::fromSinCos(sp, cp, sr, cr, sy, cy, r);
+      place(Ops::fromFloat(sway), Ops::fromFloat(surge), Ops::fromFloat(heave), r, t);
+    }
+
+    template <typename T>
+    void IkKernel<T>::transform(float sway, float surge, float heave, const RotationMatrix &rotation,
+                                Transform &t) const
+    {
+      Rotation<T> r;
+      for (int i = 0; i < 3; i++)
+      {
+        for (int j = 0; j < 3; j++)
+        {
+          r.m[i][j] = Ops::fromFloat(rotation.m[i][j]);
+        }
+      }
+      place(Ops::fromFloat(sway), Ops::fromFloat(surge), Ops::fromFloat(heave), r, t);
+    }
+
+    template <typename T>
+    void IkKernel<T>::place(T tx, T ty, T th, const Rotation<T> &r, Transform &t) const
+    {
+      const T z_offset = _geometry.zHome + th;
+
+      // The joints lie in the platform plane, so only the X and Y columns of the rotation apply to them
+      t.ax = r.m[0][0];
+      t.bx = r.m[0][1];
+      t.ay = r.m[1][0];
+      t.by = r.m[1][1];
+      t.az = r.m[2][0];
+      t.bz = r.m[2][1];
+
+#ifdef USE_ENHANCED_IK
+      if (TRANSLATION_FIRST)
+      {
+        // Rotate around the adjustable rotation point, then translate
+        t.cx = tx + _geometry.pivotZ * r.m[0][2];
+        t.cy = ty + _geometry.pivotZ * r.m[1][2];
+        t.cz = _geometry.pivotZ * r.m[2][2] + z_offset;
+      }
+      else
+      {
+        // Rotate, then translate with the rotation point offset
+        t.cx = tx;
+        t.cy = ty;
+        t.cz = z_offset + th;
+      }
+#else
+      t.cx = tx;
+      t.cy = ty;
+      t.cz = z_offset;
+#endif
+    }
+
+    template <typename T>
+    IkStatus IkKernel<T>::solveLeg(const LegGeometry<T> &leg, const Transform &t, float &servoValue, float &value) const
+    {
+      const T pivot_x = leg.px * t.ax + leg.py * t.bx + t.cx;
+      const T pivot_y = leg.px * t.ay + leg.py * t.by + t.cy;
+      const T pivot_z = leg.px * t.az + leg.py * t.bz + t.cz;
+
+      // Squared distance (avoid sqrt until necessary)
+      const T dx = pivot_x - leg.bx;
+      const T dy = pivot_y - leg.by;
+      const T d2 = dx * dx + dy * dy + pivot_z * pivot_z;
+
+      if (d2 > _geometry.maxReachSq)
+      {
+        value = sqrtf(Ops::toFloat(d2));
+        return IK_DISTANCE_TOO_GREAT;
+      }
+
+      // Geometry calculations
+      const T k = d2 - _geometry.kOffset;
+      const T l = _geometry.twoArm * pivot_z;
+      const T m = _geometry.twoArm * (leg.cosS * dx + leg.sinS * dy);
+
+      T divisor, phi;
+      Ops::polar(l, m, divisor, phi); // divisor = sqrt(l^2 + m^2), phi = atan2(m, l)
+      const T k_ratio = k / divisor;
+
+      if (k_ratio >= T(1) || k_ratio <= T(-1))
+      {
+        value = Ops::toFloat(k_ratio);
+#ifdef SLAM
+        servoValue = (k_ratio > T(0)) ? _servoMax : _servoMin;
+#endif
+        return IK_ASYMPTOTIC;
+      }
+
+      // Servo angle, mapped from [-90, 90] degrees of arm angle to the servo range
+      const T servo_rad = Ops::asin(k_ratio) - phi;
+      servoValue = Ops::toFloat(servo_rad * _radToServo + _servoOffset);
+      return IK_OK;
+    }
+
+    template <typename T>
+    size_t IkKernel<T>::solveBatch(const Pose *poses, size_t n, ServoFrameSoA &out, FeasibilityMask &mask) const
+    {
+      if (n > out.capacity)
+      {
+        n = out.capacity;
+      }
+      if (n > mask.capacity)
+      {
+        n = mask.capacity;
+      }
+
+      size_t feasible = 0;
+      for (size_t k = 0; k < n; k++)
+      {
+        const Pose &p = poses[k];
+        float frame[6];
+        int failedLeg;
+        float value;
+        const bool ok = solveRaw(frame, p.sway, p.surge, p.heave, p.pitch, p.roll, p.yaw, failedLeg, value) == IK_OK;
+        if (ok)
+        {
+          for (int i = 0; i < 6; i++)
+          {
+            out.servo[i][k] = shapeAngle(frame[i]);
+          }
+          feasible++;
+        }
+        mask.set(k, ok);
+      }
+
+      return feasible;
+    }
+
+    template <typename T>
+    void IkKernel<T>::shape(float *servoValues) const
+    {
+      for (int i = 0; i < 6; i++)
+      {
+        servoValues[i] = shapeAngle(servoValues[i]);
+      }
+    }
+
+    template <typename T>
+    float IkKernel<T>::shapeAngle(float v) const
+    {
+      v = v < _servoMin ? _servoMin : (v > _servoMax ? _servoMax : v);
+      v = _midAngle + (v - _midAngle) * _geometry.aggro;
+      return v < _servoMin ? _servoMin : (v > _servoMax ? _servoMax : v);
+    }
+
+    template <typename T>
+    void IkKernel<T>::unshape(const float *servoValues, float *angles) const
+    {
+      for (int i = 0; i < 6; i++)
+      {
+        angles[i] = _midAngle + (servoValues[i] - _midAngle) / _geometry.aggro;
+      }
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,471 @@
+#pragma once
+/**
+ * @file IkKernelSimd.h
+ * @brief Vectorized batch IK kernel for host builds
+ *
+ * This file contains a version of the float IK kernel that solves the same
+ * leg of several poses at once, one pose per SSE2 or AVX2 vector lane. It
+ * is meant for host-side workspace sweeps, simulation and gain searches,
+ * where the IK runs millions of times; the firmware keeps using IkKernel.
+ * It has no Arduino dependencies.
+ *
+ * The kernel is only declared when the host compiler targets SSE2 or AVX2
+ * (SIMD_HAS_SSE2); tools fall back to IkKernel<float> otherwise.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "core/IkKernel.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define SIMD_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define SIMD_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+#ifdef SIMD_HAS_SSE2
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @struct SimdSse2
+     * @brief Four-lane SSE2 backend of IkKernelSimd
+     *
+     * Each backend provides a vector type V, a lane mask type M, WIDTH lanes,
+     * and the element-wise operations the kernel needs. Masks are true in a
+     * lane where the comparison holds. rsqrtSeed() is the bit-level
+     * reciprocal square root estimate of math::sqrt.
+     */
+    struct SimdSse2
+    {
+      typedef __m128 V;
+      typedef __m128 M;
+      static const int WIDTH = 4;
+
+      static V set1(float a) { return _mm_set1_ps(a); }
+      static V load(const float *p) { return _mm_loadu_ps(p); }
+      static void store(float *p, V a) { _mm_storeu_ps(p, a); }
+      static V add(V a, V b) { return _mm_add_ps(a, b); }
+      static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+      static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+      static V div(V a, V b) { return _mm_div_ps(a, b); }
+      static V min(V a, V b) { return _mm_min_ps(a, b); }
+      static V max(V a, V b) { return _mm_max_ps(a, b); }
+      static V abs(V a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+      static V trunc(V a) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a)); }
+      static V rsqrtSeed(V a)
+      {
+        const __m128i bits = _mm_sub_epi32(_mm_set1_epi32(0x5f3759df), _mm_srli_epi32(_mm_castps_si128(a), 1));
+        return _mm_castsi128_ps(bits);
+      }
+      static M gt(V a, V b) { return _mm_cmpgt_ps(a, b); }
+      static M ge(V a, V b) { return _mm_cmpge_ps(a, b); }
+      static M lt(V a, V b) { return _mm_cmplt_ps(a, b); }
+      static M le(V a, V b) { return _mm_cmple_ps(a, b); }
+      static M eq(V a, V b) { return _mm_cmpeq_ps(a, b); }
+      static M orMask(M a, M b) { return _mm_or_ps(a, b); }
+      static M andNotMask(M a, M b) { return _mm_andnot_ps(a, b); } ///< b and not a
+      static V select(M m, V a, V b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+      static int bits(M m) { return _mm_movemask_ps(m); }
+    };
+
+#ifdef SIMD_HAS_AVX2
+    /**
+     * @struct SimdAvx2
+     * @brief Eight-lane AVX2 backend of IkKernelSimd
+     *
+     * Separate multiplies and adds are kept (no FMA), so that the lanes
+     * round like the scalar kernel. The integer shifts of the square root
+     * seed are what need AVX2 rather than AVX.
+     */
+    struct SimdAvx2
+    {
+      typedef __m256 V;
+      typedef __m256 M;
+      static const int WIDTH = 8;
+
+      static V set1(float a) { return _mm256_set1_ps(a); }
+      static V load(const float *p) { return _mm256_loadu_ps(p); }
+      static void store(float *p, V a) { _mm256_storeu_ps(p, a); }
+      static V add(V a, V b) { return _mm256_add_ps(a, b); }
+      static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+      static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+      static V div(V a, V b) { return _mm256_div_ps(a, b); }
+      static V min(V a, V b) { return _mm256_min_ps(a, b); }
+      static V max(V a, V b) { return _mm256_max_ps(a, b); }
+      static V abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+      static V trunc(V a) { return _mm256_cvtepi32_ps(_mm256_cvttps_epi32(a)); }
+      static V rsqrtSeed(V a)
+      {
+        const __m256i bits = _mm256_sub_epi32(_mm256_set1_epi32(0x5f3759df), _mm256_srli_epi32(_mm256_castps_si256(a), 1));
+        return _mm256_castsi256_ps(bits);
+      }
+      static M gt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+      static M ge(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+      static M lt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+      static M le(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+      static M eq(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+      static M orMask(M a, M b) { return _mm256_or_ps(a, b); }
+      static M andNotMask(M a, M b) { return _mm256_andnot_ps(a, b); } ///< b and not a
+      static V select(M m, V a, V b) { return _mm256_blendv_ps(b, a, m); }
+      static int bits(M m) { return _mm256_movemask_ps(m); }
+    };
+
+    typedef SimdAvx2 SimdNative; ///< Widest backend available in this build
+#else
+    typedef SimdSse2 SimdNative; ///< Widest backend available in this build
+#endif
+
+    /**
+     * @class IkKernelSimd
+     * @brief Float batch IK kernel, one pose per vector lane
+     *
+     * Solves the same equations as IkKernel<float> built with USE_FAST_MATH,
+     * with the same FastMath approximations at the default accuracy and in
+     * the same order of operations, one leg at a time across WIDTH poses.
+     * Results match the scalar kernel within the tolerance documented in
+     * tools/IkSimdBenchmark, which checks it.
+     *
+     * @tparam B Backend: SimdSse2 or SimdAvx2
+     */
+    template <typename B>
+    class IkKernelSimd
+    {
+    public:
+      /**
+       * @brief Construct a new IkKernelSimd
+       *
+       * @param servo_min_angle Minimum servo angle in degrees
+       * @param servo_max_angle Maximum servo angle in degrees
+       * @param geometry IK constants of the platform, copied into the kernel
+       */
+      IkKernelSimd(int servo_min_angle, int servo_max_angle, const IkGeometry<float> &geometry = GeometryTables<float>::ik);
+
+      /**
+       * @brief Solve many poses, poses in lanes
+       *
+       * Same contract as IkKernel::solveBatch(): without SLAM, so a slammed
+       * leg counts as infeasible.
+       *
+       * @param poses Array of n poses
+       * @param n Number of poses
+       * @param out Receives the shaped servo angles of each pose
+       * @param mask Receives one bit per pose, set if all six legs were solved
+       * @return size_t Number of feasible poses
+       */
+      size_t solveBatch(const Pose *poses, size_t n, ServoFrameSoA &out, FeasibilityMask &mask) const;
+
+    private:
+      typedef typename B::V V;
+      typedef typename B::M M;
+
+      /**
+       * @struct Transform
+       * @brief Lanes of IkKernel::Transform
+       */
+      struct Transform
+      {
+        V ax, bx, cx;
+        V ay, by, cy;
+        V az, bz, cz;
+      };
+
+      /**
+       * @struct Leg
+       * @brief Lanes of LegGeometry
+       */
+      struct Leg
+      {
+        V px, py, bx, by, cosS, sinS;
+      };
+
+      LegGeometry<float> _legs[6]; ///< Per-leg geometry
+
+      float _kOffset, _maxReachSq, _twoArm, _zHome, _pivotZ, _aggro, _degToRad;
+      float _radToServo, _servoOffset, _midAngle, _servoMin, _servoMax;
+
+      static V oddPolynomial(const float *c, int terms, V x);
+      static void sinCos(V x, V &s, V &c);
+      static V sqrt(V x);
+      static V atan2(V y, V x);
+
+      Transform transform(V sway, V surge, V heave, V pitch, V roll, V yaw) const;
+      V solveLeg(const Leg &leg, const Transform &t, M &failed) const;
+      V shape(V v) const;
+    };
+
+    template <typename B>
+    IkKernelSimd<B>::IkKernelSimd(int servo_min_angle, int servo_max_angle, const IkGeometry<float> &geometry)
+    {
+      memcpy(_legs, geometry.legs, sizeof(_legs));
+
+      // Same constants as IkKernel<float>
+      const double angle_range = servo_max_angle - servo_min_angle;
+      _kOffset = geometry.kOffset;
+      _maxReachSq = geometry.maxReachSq;
+      _twoArm = geometry.twoArm;
+      _zHome = geometry.zHome;
+      _pivotZ = geometry.pivotZ;
+      _aggro = geometry.aggro;
+      _degToRad = (float)(GEOMETRY_PI / 180.0);
+      _radToServo = (float)(angle_range / GEOMETRY_PI);
+      _servoOffset = (float)(servo_min_angle + angle_range / 2);
+      _midAngle = (float)(servo_min_angle + angle_range / 2);
+      _servoMin = (float)servo_min_angle;
+      _servoMax = (float)servo_max_angle;
+    }
+
+    template <typename B>
+    typename B::V IkKernelSimd<B>::oddPolynomial(const float *c, int terms, V x)
+    {
+      const V x2 = B::mul(x, x);
+      V p = B::set1(c[terms - 1]);
+      for (int i = terms - 2; i >= 0; i--)
+      {
+        p = B::add(B::mul(p, x2), B::set1(c[i]));
+      }
+      return B::mul(p, x);
+    }
+
+    template <typename B>
+    void IkKernelSimd<B>::sinCos(V x, V &s, V &c)
+    {
+      typedef math::Coefficients<math::FAST_MATH_ACCURACY> C;
+      const V pi = B::set1(math::PI_F);
+      const V halfPi = B::set1(math::HALF_PI_F);
+      const V twoPi = B::set1(math::TWO_PI_F);
+      const V zero = B::set1(0);
+
+      // Reduce to [-pi, pi], as math::sinCos
+      const V k = B::trunc(B::add(B::div(x, twoPi), B::select(B::ge(x, zero), B::set1(0.5f), B::set1(-0.5f))));
+      x = B::select(B::gt(B::abs(x), pi), B::sub(x, B::mul(twoPi, k)), x);
+
+      // Fold into [-pi/2, pi/2]; cos changes sign in the outer quadrants
+      const M high = B::gt(x, halfPi);
+      const M low = B::lt(x, B::sub(zero, halfPi));
+      x = B::select(high, B::sub(pi, x), B::select(low, B::sub(B::sub(zero, pi), x), x));
+      const V sign = B::select(B::orMask(high, low), B::set1(-1.0f), B::set1(1.0f));
+
+      s = oddPolynomial(C::sin(), C::SIN_TERMS, x);
+      c = B::mul(sign, oddPolynomial(C::sin(), C::SIN_TERMS, B::sub(halfPi, B::abs(x))));
+    }
+
+    template <typename B>
+    typename B::V IkKernelSimd<B>::sqrt(V x)
+    {
+      // As math::sqrt: refine the seed with Newton-Raphson, then multiply by x
+      const V half = B::mul(B::set1(0.5f), x);
+      const V threeHalves = B::set1(1.5f);
+      V r = B::rsqrtSeed(x);
+      for (int i = 0; i < math::Coefficients<math::FAST_MATH_ACCURACY>::SQRT_ITERATIONS; i++)
+      {
+        r = B::mul(r, B::sub(threeHalves, B::mul(B::mul(half, r), r)));
+      }
+      return B::select(B::gt(x, B::set1(0)), B::mul(x, r), B::set1(0));
+    }
+
+    template <typename B>
+    typename B::V IkKernelSimd<B>::atan2(V y, V x)
+    {
+      typedef math::Coefficients<math::FAST_MATH_ACCURACY> C;
+      const V zero = B::set1(0);
+      const V ax = B::abs(x);
+      const V ay = B::abs(y);
+
+      // Evaluate in the first octant, then mirror, as math::atan2
+      const M steep = B::gt(ay, ax);
+      const V num = B::select(steep, ax, ay);
+      const V den = B::select(steep, ay, ax);
+      const V r = B::select(B::eq(den, zero), zero, B::div(num, den));
+      const V p = oddPolynomial(C::atan(), C::ATAN_TERMS, r);
+
+      V a = B::select(steep, B::sub(B::set1(math::HALF_PI_F), p), p);
+      a = B::select(B::lt(x, zero), B::sub(B::set1(math::PI_F), a), a);
+      return B::select(B::lt(y, zero), B::sub(zero, a), a);
+    }
+
+    template <typename B>
+    typename IkKernelSimd<B>::Transform IkKernelSimd<B>::transform(V sway, V surge, V heave, V pitch, V roll, V yaw) const
+    {
+      // Same expressions as orientation::fromSinCos and IkKernel::place
+      const V degToRad = B::set1(_degToRad);
+      V sr, cr, sp, cp, sy, cy;
+      sinCos(B::mul(roll, degToRad), sr, cr);
+      sinCos(B::mul(pitch, degToRad), sp, cp);
+      sinCos(B::mul(yaw, degToRad), sy, cy);
+
+      const V sp_sr = B::mul(sp, sr);
+      const V z_offset = B::add(B::set1(_zHome), heave);
+
+      Transform t;
+      t.ax = B::mul(cr, cy);
+      t.bx = B::sub(B::mul(sp_sr, cy), B::mul(cp, sy));
+      t.ay = B::mul(cr, sy);
+      t.by = B::add(B::mul(cp, cy), B::mul(sp_sr, sy));
+      t.az = B::sub(B::set1(0), sr);
+      t.bz = B::mul(sp, cr);
+
+#ifdef USE_ENHANCED_IK
+      if (TRANSLATION_FIRST)
+      {
+        const V pivotZ = B::set1(_pivotZ);
+        const V cp_sr = B::mul(cp, sr);
+        t.cx = B::add(sway, B::mul(pivotZ, B::add(B::mul(cp_sr, cy), B::mul(sp, sy))));
+        t.cy = B::add(surge, B::mul(pivotZ, B::sub(B::mul(cp_sr, sy), B::mul(sp, cy))));
+        t.cz = B::add(B::mul(pivotZ, B::mul(cp, cr)), z_offset);
+      }
+      else
+      {
+        t.cx = sway;
+        t.cy = surge;
+        t.cz = B::add(z_offset, heave);
+      }
+#else
+      t.cx = sway;
+      t.cy = surge;
+      t.cz = z_offset;
+#endif
+      return t;
+    }
+
+    template <typename B>
+    typename B::V IkKernelSimd<B>::solveLeg(const Leg &leg, const Transform &t, M &failed) const
+    {
+      // Same expressions as IkKernel::solveLeg, in every lane
+      const V pivot_x = B::add(B::add(B::mul(leg.px, t.ax), B::mul(leg.py, t.bx)), t.cx);
+      const V pivot_y = B::add(B::add(B::mul(leg.px, t.ay), B::mul(leg.py, t.by)), t.cy);
+      const V pivot_z = B::add(B::add(B::mul(leg.px, t.az), B::mul(leg.py, t.bz)), t.cz);
+
+      const V dx = B::sub(pivot_x, leg.bx);
+      const V dy = B::sub(pivot_y, leg.by);
+      const V d2 = B::add(B::add(B::mul(dx, dx), B::mul(dy, dy)), B::mul(pivot_z, pivot_z));
+
+      const V twoArm = B::set1(_twoArm);
+      const V k = B::sub(d2, B::set1(_kOffset));
+      const V l = B::mul(twoArm, pivot_z);
+      const V m = B::mul(twoArm, B::add(B::mul(leg.cosS, dx), B::mul(leg.sinS, dy)));
+
+      const V divisor = sqrt(B::add(B::mul(l, l), B::mul(m, m)));
+      const V phi = atan2(m, l);
+      const V ratio = B::div(k, divisor);
+
+      // Out of reach, or no angle satisfies the leg equation
+      const V one = B::set1(1.0f);
+      failed = B::orMask(B::gt(d2, B::set1(_maxReachSq)), B::orMask(B::ge(ratio, one), B::le(ratio, B::set1(-1.0f))));
+
+      // asin, as math::asin; lanes that failed produce garbage that the caller discards
+      const V asin = atan2(ratio, sqrt(B::mul(B::sub(one, ratio), B::add(one, ratio))));
+      return B::add(B::mul(B::sub(asin, phi), B::set1(_radToServo)), B::set1(_servoOffset));
+    }
+
+    template <typename B>
+    typename B::V IkKernelSimd<B>::shape(V v) const
+    {
+      // Same as IkKernel::shapeAngle
+      const V lo = B::set1(_servoMin);
+      const V hi = B::set1(_servoMax);
+      const V mid = B::set1(_midAngle);
+      v = B::min(B::max(v, lo), hi);
+      v = B::add(mid, B::mul(B::sub(v, mid), B::set1(_aggro)));
+      return B::min(B::max(v, lo), hi);
+    }
+
+    template <typename B>
+    size_t IkKernelSimd<B>::solveBatch(const Pose *poses, size_t n, ServoFrameSoA &out, FeasibilityMask &mask) const
+    {
+      if (n > out.capacity)
+      {
+        n = out.capacity;
+      }
+      if (n > mask.capacity)
+      {
+        n = mask.capacity;
+      }
+
+      size_t feasible = 0;
+      float lanes[6][B::WIDTH];
+      float angles[B::WIDTH];
+
+      for (size_t start = 0; start < n; start += B::WIDTH)
+      {
+        const size_t count = (n - start < (size_t)B::WIDTH) ? n - start : B::WIDTH;
+
+        // Transpose the poses into lanes, padding a short tail with its last pose
+        for (int k = 0; k < B::WIDTH; k++)
+        {
+          const Pose &p = poses[start + (k < (int)count ? k : count - 1)];
+          lanes[0][k] = p.sway;
+          lanes[1][k] = p.surge;
+          lanes[2][k] = p.heave;
+          lanes[3][k] = p.pitch;
+          lanes[4][k] = p.roll;
+          lanes[5][k] = p.yaw;
+        }
+        const Transform t = transform(B::load(lanes[0]), B::load(lanes[1]), B::load(lanes[2]),
+                                      B::load(lanes[3]), B::load(lanes[4]), B::load(lanes[5]));
+
+        int failedBits = 0;
+        for (int i = 0; i < 6; i++)
+        {
+          const LegGeometry<float> &g = _legs[i];
+          const Leg leg = {B::set1(g.px), B::set1(g.py), B::set1(g.bx), B::set1(g.by), B::set1(g.cosS), B::set1(g.sinS)};
+          M failed;
+          const V angle = shape(solveLeg(leg, t, failed));
+          failedBits |= B::bits(failed);
+
+          if (count == (size_t)B::WIDTH)
+          {
+            B::store(out.servo[i] + start, angle);
+          }
+          else
+          {
+            B::store(angles, angle);
+            memcpy(out.servo[i] + start, angles, count * sizeof(float));
+          }
+
+          // Once every lane has failed, as the scalar kernel stops at the first failing leg
+          if (failedBits == (1 << B::WIDTH) - 1)
+          {
+            break;
+          }
+        }
+
+        for (size_t k = 0; k < count; k++)
+        {
+          const bool ok = !(failedBits & (1 << k));
+          mask.set(start + k, ok);
+          feasible += ok;
+        }
+      }
+
+      return feasible;
+    }
+
+  } // namespace core
+} // namespace stewy
+
+#endif // SIMD_HAS_SSE2
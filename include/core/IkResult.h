@@ -0,0 +1,160 @@
+#pragma once
+/**
+ * @file IkResult.h
+ * @brief Outcome of a platform move, and counts of the outcomes
+ *
+ * This file contains the compact result that Platform::moveTo() returns in
+ * place of logging, and the counters it keeps per outcome. Turning the
+ * counters into text is left to a rate-limited report outside the solve
+ * (see Platform::reportDiagnostics()). It has no Arduino dependencies, so it
+ * can be used in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @enum IkResultStatus
+     * @brief Outcome of a move, applied ones first
+     */
+    enum IkResultStatus
+    {
+      IK_RESULT_OK,                 ///< The pose was applied (solved, cached, or unchanged)
+      IK_RESULT_SLAMMED,            ///< Applied with SLAM: the failing leg was driven to its limit
+      IK_RESULT_CLIPPED,            ///< Applied with CLAMP: only part of the way to the pose
+      IK_RESULT_OUT_OF_RANGE,       ///< A pose component is outside its allowed range
+      IK_RESULT_UNREACHABLE,        ///< The WorkspaceMap rejected the pose (with CLAMP: and no step towards it is reachable)
+      IK_RESULT_DISTANCE_TOO_GREAT, ///< A platform joint is out of reach of its servo arm and rod
+      IK_RESULT_ASYMPTOTIC,         ///< No servo angle satisfies the leg equation of a leg
+      IK_RESULT_STATUS_COUNT        ///< Number of outcomes
+    };
+
+    /**
+     * @struct IkResult
+     * @brief Compact outcome of a move
+     *
+     * The meaning of leg and margin depends on the status:
+     * - IK_RESULT_OUT_OF_RANGE: leg is the pose component (0 = sway .. 5 = yaw),
+     *   margin how far outside its range it is (mm or degrees)
+     * - IK_RESULT_DISTANCE_TOO_GREAT: margin is the excess distance, in mm
+     * - IK_RESULT_SLAMMED, IK_RESULT_ASYMPTOTIC: margin is how far |k / sqrt(l^2 + m^2)| exceeds 1
+     * - IK_RESULT_CLIPPED: margin is the fraction of the move that was left out
+     * - otherwise leg is -1 and margin 0
+     */
+    struct IkResult
+    {
+      uint8_t status; ///< IkResultStatus
+      int8_t leg;     ///< Failing leg or pose component, -1 if none
+      float margin;   ///< By how much the constraint was missed, see above
+
+      /**
+       * @brief Whether the move was applied
+       *
+       * @return true for IK_RESULT_OK, IK_RESULT_SLAMMED and IK_RESULT_CLIPPED
+       */
+      bool ok() const
+      {
+        return status <= IK_RESULT_CLIPPED;
+      }
+    };
+
+    /**
+     * @class IkDiagnostics
+     * @brief Per-outcome counters of moves, and the pacing of their report
+     *
+     * record() is all a move pays for: a counter increment and, on failure,
+     * a copy of the result. takeReport() tells the caller, at most once per
+     * interval, how many moves failed since the last report and how the last
+     * one failed, so that a stream of rejected poses costs one log line per
+     * interval instead of one per pose.
+     */
+    class IkDiagnostics
+    {
+    public:
+      /**
+       * @brief Construct new, zeroed diagnostics
+       *
+       * @param intervalMs Shortest time between two reports, in ms
+       */
+      IkDiagnostics(unsigned long intervalMs);
+
+      /**
+       * @brief Count the outcome of a move
+       *
+       * @param result Outcome of the move
+       */
+      void record(const IkResult &result)
+      {
+        _counts[result.status]++;
+        if (!result.ok())
+        {
+          _pending++;
+          _lastFailure = result;
+        }
+      }
+
+      /**
+       * @brief Take the failures to report, if a report is due
+       *
+       * A report is due when moves failed since the last one, and the
+       * interval has elapsed. Taking it starts a new interval.
+       *
+       * @param nowMs Current time in ms (wraps around)
+       * @param failures Receives the number of failed moves since the last report
+       * @param lastFailure Receives the outcome of the last failed move
+       * @return true if a report is due, false otherwise (nothing is written)
+       */
+      bool takeReport(unsigned long nowMs, unsigned long &failures, IkResult &lastFailure);
+
+      /**
+       * @brief Get the number of moves with an outcome
+       *
+       * @param status Outcome
+       * @return Number of moves since construction or the last resetStats()
+       */
+      unsigned long getCount(IkResultStatus status) const;
+
+      /**
+       * @brief Zero the counters
+       */
+      void resetStats();
+
+      /**
+       * @brief Get the display name of an outcome
+       *
+       * @param status Outcome
+       * @return Name of the outcome
+       */
+      static const char *getStatusString(IkResultStatus status);
+
+    private:
+      unsigned long _intervalMs;                     ///< Shortest time between two reports
+      unsigned long _lastReportMs;                   ///< Time of the last report
+      unsigned long _counts[IK_RESULT_STATUS_COUNT]; ///< Moves per outcome
+      unsigned long _pending;                        ///< Failed moves not reported yet
+      IkResult _lastFailure;                         ///< Outcome of the last failed move
+    };
+
+  } // namespace core
+} // namespace stewy
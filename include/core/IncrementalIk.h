@@ -0,0 +1,174 @@
+#pragma once
+/**
+ * @file IncrementalIk.h
+ * @brief Jacobian-based incremental IK for small pose changes
+ *
+ * This file contains a wrapper around the IK kernel that updates servo
+ * angles with a linear (Jacobian) approximation while successive poses stay
+ * close together, and only runs the full solve when they do not, or when
+ * the linear update is off by more than the target error. It has no
+ * Arduino dependencies, so it can be used in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/IkKernel.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @class IncrementalIk
+     * @brief Linearized IK around the last fully solved pose
+     *
+     * Keeps the Jacobian J of the (unshaped) servo angles with respect to the
+     * six pose components at a base pose. A following pose is solved as
+     * base angles + J * (pose - base pose), a 6x6 multiply, as long as:
+     * - it differs from the previous pose by at most maxDelta on every
+     *   component, and
+     * - it differs from the base pose by at most the drift limit on every
+     *   component.
+     *
+     * Each prediction is vetted with IkKernel::check(), which costs the
+     * orientation trig and a sinCos per leg, about half a solve. If a
+     * leg is out of reach, or the estimated error of any angle exceeds
+     * maxError, the prediction is discarded.
+     *
+     * Otherwise the pose is solved in full and becomes the new base. The
+     * full solution also measures how far the linear prediction had drifted
+     * from the exact angles. Unless that error is several times maxError, J
+     * is corrected with a Broyden rank-one update, so the fallback costs a
+     * single solve. Otherwise J is re-estimated by central differences,
+     * which costs 12 more solves.
+     *
+     * The linearization error grows with the square of the distance from the
+     * base pose, and the IK is much more curved near the edge of the
+     * workspace than near home. The second differences of each central
+     * difference estimate, and the error measured at each Broyden update,
+     * set the drift limit (at most maxDrift) so that the predicted error at
+     * the limit is maxError.
+     *
+     * Poses are arrays of 6 floats: sway, surge, heave (mm), pitch, roll,
+     * yaw (degrees). Thresholds apply to all six alike, in mm or degrees.
+     *
+     * A pose within the difference step of the workspace boundary is never
+     * used as a base after a central difference estimate, but a Broyden
+     * update does not probe the neighbourhood of its base pose; the check
+     * of each prediction is what keeps poses just outside the workspace
+     * from being linearized from a base just inside.
+     */
+    class IncrementalIk
+    {
+    public:
+      /**
+       * @brief Construct a new IncrementalIk
+       *
+       * @param maxDelta Largest change from the previous pose that is linearized, in mm or degrees
+       * @param maxDrift Largest distance from the base pose that is linearized, in mm or degrees
+       * @param maxError Target linearization error, in degrees of unshaped servo angle
+       * @param step Central difference step used to estimate the Jacobian, in mm or degrees
+       */
+      IncrementalIk(float maxDelta, float maxDrift, float maxError, float step);
+
+      /**
+       * @brief Discard the base pose
+       *
+       * The next solve is a full solve.
+       */
+      void invalidate();
+
+      /**
+       * @brief Solve servo angles for a pose
+       *
+       * Same contract as IkKernel::solve(). A linearized solve is within
+       * maxError of the exact angles (to first order), and every leg of the
+       * pose is within reach; anything else is solved in full.
+       *
+       * @param kernel IK kernel used for full solves
+       * @param servoValues Array of 6 floats that receives the servo angles in degrees
+       * @param pose Array of 6 floats: sway, surge, heave, pitch, roll, yaw
+       * @param failedLeg Receives the index of the failing leg, if any
+       * @param value Receives the offending value, as for IkKernel::solve()
+       * @return IkStatus IK_OK on success, otherwise the reason for failure
+       */
+      IkStatus solve(const IkKernel<ik_scalar_t> &kernel, float *servoValues, const float *pose,
+                     int &failedLeg, float &value);
+
+      /**
+       * @brief Check if the last solve was linearized
+       *
+       * @return true if the last solve() was answered from the Jacobian, false if it ran the full solve
+       */
+      bool wasLinear() const;
+
+      /**
+       * @brief Get the number of linearized solves
+       *
+       * @return Number of solves answered from the Jacobian
+       */
+      unsigned long getLinearSolves() const;
+
+      /**
+       * @brief Get the number of full solves
+       *
+       * @return Number of solves that ran the IK kernel
+       */
+      unsigned long getFullSolves() const;
+
+      /**
+       * @brief Get the number of central difference Jacobian estimates
+       *
+       * @return Number of Jacobian estimates (12 solves each)
+       */
+      unsigned long getRefreshes() const;
+
+      /**
+       * @brief Get the number of linear predictions discarded by the check
+       *
+       * @return Number of predictions that failed IkKernel::check() or exceeded maxError, and were solved in full
+       */
+      unsigned long getRejected() const;
+
+    private:
+      float _maxDelta; ///< Largest change from the previous pose that is linearized
+      float _maxDrift; ///< Largest distance from the base pose that is linearized
+      float _maxError; ///< Target linearization error
+      float _step;     ///< Central difference step
+
+      bool _valid;                 ///< Whether the base pose and Jacobian can be used
+      bool _linear;                ///< Whether the last solve was linearized
+      float _driftLimit;           ///< Current drift limit, at most maxDrift, from the observed linearization error
+      float _basePose[6];          ///< Last fully solved pose
+      float _baseAngles[6];        ///< Unshaped servo angles at the base pose
+      float _lastPose[6];          ///< Pose of the previous solve
+      float _jacobian[6][6];       ///< d(servo angle i) / d(pose component j) at the base pose
+      unsigned long _linearSolves; ///< Number of linearized solves
+      unsigned long _fullSolves;   ///< Number of full solves
+      unsigned long _refreshes;    ///< Number of central difference Jacobian estimates
+      unsigned long _rejected;     ///< Number of linear predictions discarded by the check
+
+      void predict(const float *d, float *angles) const;
+      bool update(const float *d, const float *angles);
+      bool refresh(const IkKernel<ik_scalar_t> &kernel, const float *pose, const float *angles);
+      void rebase(const float *pose, const float *angles);
+    };
+
+  } // namespace core
+} // namespace stewy
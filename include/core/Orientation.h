@@ -0,0 +1,190 @@
+#pragma once
+/**
+ * @file Orientation.h
+ * @brief Rotation matrix and quaternion forms of the platform orientation
+ *
+ * This file contains the orientation types accepted by IkKernel and
+ * Platform besides Euler angles, and the conversions between them. The IK
+ * only needs the rotation matrix, so a caller that already holds one (or a
+ * quaternion, which converts without trig) skips the Euler trig entirely.
+ * It has no Arduino dependencies, so it can be used in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include "core/PlatformGeometry.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @struct Rotation
+     * @brief 3x3 rotation matrix, row major
+     *
+     * Column j holds platform axis j (X, Y, Z) in base coordinates, so a
+     * platform joint at (px, py, 0) lands at m * (px, py, 0) before the
+     * translation.
+     *
+     * @tparam T Scalar type: double, float or Fixed16
+     */
+    template <typename T>
+    struct Rotation
+    {
+      T m[3][3]; ///< Entries, m[row][column]
+    };
+
+    typedef Rotation<float> RotationMatrix; ///< Rotation matrix as passed to IkKernel and Platform
+
+    /**
+     * @struct Quaternion
+     * @brief Orientation as a unit quaternion
+     */
+    struct Quaternion
+    {
+      float w; ///< Scalar part
+      float x; ///< X of the vector part
+      float y; ///< Y of the vector part
+      float z; ///< Z of the vector part
+    };
+
+    namespace orientation
+    {
+
+      /**
+       * @brief Build the rotation of Euler angles from their sines and cosines
+       *
+       * The rotation is yaw around Z, of roll around Y, of pitch around X:
+       * Rz(yaw) * Ry(roll) * Rx(pitch).
+       *
+       * @tparam T Scalar type
+       * @param sp Sine of pitch
+       * @param cp Cosine of pitch
+       * @param sr Sine of roll
+       * @param cr Cosine of roll
+       * @param sy Sine of yaw
+       * @param cy Cosine of yaw
+       * @param r Receives the rotation
+       */
+      template <typename T>
+      inline void fromSinCos(T sp, T cp, T sr, T cr, T sy, T cy, Rotation<T> &r)
+      {
+        // Common products
+        const T sp_sr = sp * sr;
+        const T cp_sr = cp * sr;
+
+        r.m[0][0] = cr * cy;
+        r.m[0][1] = sp_sr * cy - cp * sy;
+        r.m[0][2] = cp_sr * cy + sp * sy;
+        r.m[1][0] = cr * sy;
+        r.m[1][1] = cp * cy + sp_sr * sy;
+        r.m[1][2] = cp_sr * sy - sp * cy;
+        r.m[2][0] = -sr;
+        r.m[2][1] = sp * cr;
+        r.m[2][2] = cp * cr;
+      }
+
+      /**
+       * @brief Build the rotation of Euler angles
+       *
+       * @param pitch Rotation around X axis in degrees
+       * @param roll Rotation around Y axis in degrees
+       * @param yaw Rotation around Z axis in degrees
+       * @param r Receives the rotation, as IkKernel builds it
+       */
+      inline void fromEuler(float pitch, float roll, float yaw, RotationMatrix &r)
+      {
+        const float degToRad = (float)(GEOMETRY_PI / 180.0);
+        fromSinCos(sinf(pitch * degToRad), cosf(pitch * degToRad),
+                   sinf(roll * degToRad), cosf(roll * degToRad),
+                   sinf(yaw * degToRad), cosf(yaw * degToRad), r);
+      }
+
+      /**
+       * @brief Build the quaternion of Euler angles
+       *
+       * @param pitch Rotation around X axis in degrees
+       * @param roll Rotation around Y axis in degrees
+       * @param yaw Rotation around Z axis in degrees
+       * @param q Receives the unit quaternion of the same rotation as fromEuler()
+       */
+      inline void fromEuler(float pitch, float roll, float yaw, Quaternion &q)
+      {
+        const float halfDegToRad = (float)(GEOMETRY_PI / 360.0);
+        const float sp = sinf(pitch * halfDegToRad), cp = cosf(pitch * halfDegToRad);
+        const float sr = sinf(roll * halfDegToRad), cr = cosf(roll * halfDegToRad);
+        const float sy = sinf(yaw * halfDegToRad), cy = cosf(yaw * halfDegToRad);
+
+        q.w = cp * cr * cy + sp * sr * sy;
+        q.x = sp * cr * cy - cp * sr * sy;
+        q.y = cp * sr * cy + sp * cr * sy;
+        q.z = cp * cr * sy - sp * sr * cy;
+      }
+
+      /**
+       * @brief Build the rotation of a quaternion, without trig
+       *
+       * The quaternion does not have to be exactly unit: it is normalized
+       * on the way, for the cost of one division.
+       *
+       * @param q Orientation, not zero
+       * @param r Receives the rotation
+       */
+      inline void fromQuaternion(const Quaternion &q, RotationMatrix &r)
+      {
+        const float s = 2.0f / (q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+        const float xx = q.x * q.x * s, yy = q.y * q.y * s, zz = q.z * q.z * s;
+        const float xy = q.x * q.y * s, xz = q.x * q.z * s, yz = q.y * q.z * s;
+        const float wx = q.w * q.x * s, wy = q.w * q.y * s, wz = q.w * q.z * s;
+
+        r.m[0][0] = 1 - (yy + zz);
+        r.m[0][1] = xy - wz;
+        r.m[0][2] = xz + wy;
+        r.m[1][0] = xy + wz;
+        r.m[1][1] = 1 - (xx + zz);
+        r.m[1][2] = yz - wx;
+        r.m[2][0] = xz - wy;
+        r.m[2][1] = yz + wx;
+        r.m[2][2] = 1 - (xx + yy);
+      }
+
+      /**
+       * @brief Recover the Euler angles of a rotation
+       *
+       * Exact for |roll| < 90 degrees, the range of any reachable pose.
+       *
+       * @param r Rotation
+       * @param pitch Receives the rotation around X axis in degrees
+       * @param roll Receives the rotation around Y axis in degrees
+       * @param yaw Receives the rotation around Z axis in degrees
+       */
+      inline void toEuler(const RotationMatrix &r, float &pitch, float &roll, float &yaw)
+      {
+        const float radToDeg = (float)(180.0 / GEOMETRY_PI);
+        const float sr = -r.m[2][0];
+        roll = asinf(sr < -1 ? -1 : (sr > 1 ? 1 : sr)) * radToDeg;
+        pitch = atan2f(r.m[2][1], r.m[2][2]) * radToDeg;
+        yaw = atan2f(r.m[1][0], r.m[0][0]) * radToDeg;
+      }
+
+    } // namespace orientation
+
+  } // namespace core
+} // namespace stewy
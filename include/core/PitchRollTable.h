@@ -0,0 +1,137 @@
+#pragma once
+/**
+ * @file PitchRollTable.h
+ * @brief Precomputed pitch/roll IK lookup table
+ *
+ * This file contains a lookup table of servo angles over the pitch/roll
+ * envelope used by ball balancing, for a fixed sway/surge/heave/yaw.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include "core/Config.h"
+#include "core/IkKernel.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @class PitchRollTable
+     * @brief Bilinear pitch/roll lookup table of servo angles
+     *
+     * Ball balancing only ever changes pitch and roll, so the IK is a 2D
+     * function while sway, surge, heave and yaw stay fixed. This table samples
+     * that function on a regular grid over [MIN_PITCH, MAX_PITCH] x
+     * [MIN_ROLL, MAX_ROLL] and interpolates bilinearly between grid points,
+     * which costs a few multiply-adds instead of a full trig solve.
+     *
+     * The table depends on the translation setpoint, which can change at
+     * runtime, so it lives in a statically allocated RAM block (no heap)
+     * rather than in flash. When the translation changes, the table is
+     * rebuilt IK_LUT_ROWS_PER_CALL rows at a time, so the rebuild never
+     * stalls a control tick. Until it is complete, lookups miss and the
+     * caller falls back to the full solve.
+     *
+     * The table holds the unshaped angles from IkKernel::solveRaw(), as
+     * hundredths of a degree from the middle of the servo range, and the servo
+     * range clamp and AGGRO are applied after interpolating, so their kinks
+     * are not smeared across a grid cell. With the default grid of about 2
+     * degrees, the mean servo angle error is around 0.03 degrees, rising to
+     * about 0.6 degrees where the arms approach the edge of the reachable
+     * envelope.
+     */
+    class PitchRollTable
+    {
+    public:
+      static const int PITCH_POINTS = IK_LUT_PITCH_STEPS + 1; ///< Grid points along pitch
+      static const int ROLL_POINTS = IK_LUT_ROLL_STEPS + 1;   ///< Grid points along roll
+
+      /**
+       * @brief Construct an empty table
+       */
+      PitchRollTable();
+
+      /**
+       * @brief Discard the table contents
+       *
+       * The next lookup starts a rebuild.
+       */
+      void invalidate();
+
+      /**
+       * @brief Look up the servo angles for a pitch/roll pair
+       *
+       * If the translation differs from the one the table was built for, the
+       * table is invalidated. If the table is incomplete, up to
+       * IK_LUT_ROWS_PER_CALL more rows are solved with the given kernel.
+       *
+       * @param kernel IK kernel used to fill the table
+       * @param servoValues Array of 6 floats that receives the servo angles (only written on a hit)
+       * @param sway Translation along X axis in mm
+       * @param surge Translation along Y axis in mm
+       * @param heave Translation along Z axis in mm
+       * @param yaw Rotation around Z axis in degrees
+       * @param pitch Rotation around X axis in degrees
+       * @param roll Rotation around Y axis in degrees
+       * @return true if the angles were interpolated from the table
+       * @return false if the table is incomplete, the pose is outside the grid, or a neighbouring grid point is infeasible
+       */
+      bool lookup(const IkKernel<ik_scalar_t> &kernel, float *servoValues,
+                  int sway, int surge, int heave, float yaw, float pitch, float roll);
+
+      /**
+       * @brief Reset the hit and miss counters
+       */
+      void resetStats();
+
+      /**
+       * @brief Get the number of hits
+       *
+       * @return Number of lookups answered from the table
+       */
+      unsigned long getHits() const;
+
+      /**
+       * @brief Get the number of misses
+       *
+       * @return Number of lookups not answered from the table
+       */
+      unsigned long getMisses() const;
+
+    private:
+      static const int16_t INFEASIBLE = INT16_MIN; ///< Marks a grid point the IK could not solve
+
+      int16_t _angles[PITCH_POINTS][ROLL_POINTS][6]; ///< Unshaped servo angles, in 1/100 degree from the middle of the servo range
+      int _rowsBuilt;                                 ///< Number of pitch rows solved so far
+      unsigned long _hits;                            ///< Lookups answered from the table
+      unsigned long _misses;                          ///< Lookups not answered from the table
+
+      // Translation the table was built for
+      int _sway;
+      int _surge;
+      int _heave;
+      float _yaw;
+
+      void buildRow(const IkKernel<ik_scalar_t> &kernel, int row);
+    };
+
+  } // namespace core
+} // namespace stewy
@@ -26,12 +26,42 @@
 
 #include <ArduinoLog.h>
 #include "core/PlatformGeometry.h"
+#include "core/IkKernel.h"
+#include "core/PitchRollTable.h"
+#include "core/IncrementalIk.h"
+#include "core/ForwardKinematics.h"
+#include "core/WorkspaceMap.h"
+#include "core/PoseCache.h"
+#include "core/GeometryProfile.h"
+#include "core/IkResult.h"
+#include "core/Orientation.h"
 
 namespace stewy
 {
   namespace core
   {
 
+    /**
+     * @struct PlatformState
+     * @brief Setpoints of a Platform, for a record keyframe
+     *
+     * Fixed-size fields only, so that the bytes read the same on the Teensy
+     * and on the host (see Recorder.h).
+     */
+    struct PlatformState
+    {
+      int32_t sway;            ///< Current sway in mm
+      int32_t surge;           ///< Current surge in mm
+      int32_t heave;           ///< Current heave in mm
+      float pitch;             ///< Current pitch in degrees
+      float roll;              ///< Current roll in degrees
+      float yaw;               ///< Current yaw in degrees
+      RotationMatrix rotation; ///< Current orientation, if set as a rotation
+      bool fromRotation;       ///< Whether the orientation was set as a rotation
+      bool geometryCurrent;    ///< Whether the setpoints were solved for the current geometry
+      float clipRatio;         ///< Fraction of the last requested pose change that was clipped, with CLAMP
+    };
+
     /**
      * @class Platform
      * @brief Stewart platform control class
@@ -48,6 +78,32 @@ namespace stewy
       int _servo_min_angle; ///< Minimum allowed servo angle in degrees
       int _servo_max_angle; ///< Maximum allowed servo angle in degrees
 
+      static GeometryProfile _geometry; ///< Current platform geometry, shared by all instances
+
+      IkKernel<ik_scalar_t> _kernel; ///< IK solver, in the scalar type selected in PlatformGeometry.h
+      uint16_t _geometryRevision;    ///< Revision of _geometry the setpoints were solved for
+      IkDiagnostics _diagnostics;    ///< Outcomes of the moves of this instance
+
+#ifdef IK_LUT_ENABLED
+      static PitchRollTable _pitchRollTable; ///< Pitch/roll lookup table, shared by all instances with the default servo range
+#endif
+
+#ifdef IK_JACOBIAN_ENABLED
+      static IncrementalIk _incrementalIk; ///< Linearized IK around the last full solve, shared by all instances with the default servo range
+#endif
+
+#ifdef WORKSPACE_MAP_ENABLED
+      static WorkspaceMap _workspaceMap; ///< Reachability map of the pose envelope, shared by all instances
+#endif
+
+#ifdef POSE_CACHE_ENABLED
+      static PoseCache _poseCache; ///< Servo angles of recently solved poses, shared by all instances with the default servo range
+#endif
+
+#ifdef FK_ENABLED
+      ForwardKinematics _forwardKinematics; ///< Pose estimator, warm-started from the previous estimate
+#endif
+
       // Setpoints (internal state)
       int _sp_sway = 0;  ///< Current sway (x-axis translation) in mm
       int _sp_surge = 0; ///< Current surge (y-axis translation) in mm
@@ -57,6 +113,67 @@ namespace stewy
       float _sp_roll = 0;  ///< Current roll (y-axis rotation) in degrees
       float _sp_yaw = 0;   ///< Current yaw (z-axis rotation) in degrees
 
+      RotationMatrix _sp_rotation;  ///< Current orientation, if set as a rotation
+      bool _spFromRotation = false; ///< Whether the orientation was set as a rotation, and the Euler setpoints are stale
+
+      /**
+       * @brief Recover the Euler setpoints of an orientation set as a rotation
+       *
+       * Deferred until something needs them, so that moves given as a
+       * rotation never pay for the trig.
+       */
+      void syncOrientation();
+
+      /**
+       * @brief Turn a kernel status into a move outcome
+       *
+       * @param status Outcome of the solve
+       * @param value Offending value of the solve
+       * @param margin Receives by how much the constraint was missed
+       * @return Outcome of the move
+       */
+      IkResultStatus classify(IkStatus status, float value, float &margin) const;
+
+      /**
+       * @brief Discard everything derived from the previous geometry
+       *
+       * Invalidates the lookup table, the incremental IK, the pose cache and
+       * the workspace map, which is only re-enabled for the default geometry.
+       */
+      static void geometryChanged();
+
+      /**
+       * @brief Count the outcome of a move
+       *
+       * @param status Outcome
+       * @param leg Failing leg or pose component, -1 if none
+       * @param margin By how much the constraint was missed
+       * @return The outcome, as moveTo() returns it
+       */
+      IkResult record(IkResultStatus status, int leg = -1, float margin = 0);
+
+#ifdef CLAMP
+      float _clipRatio = 0; ///< Fraction of the last requested pose change that was clipped
+
+      /**
+       * @brief Move as far as possible towards an unreachable pose
+       *
+       * Bisects the fraction of the way from the current setpoints to the
+       * requested pose, over CLAMP_ITERATIONS full IK solves, and applies the
+       * furthest reachable pose found. Translations are rounded to whole mm
+       * before each solve, since the setpoints are stored as integers. If no
+       * step towards the pose is reachable, the platform holds the current
+       * setpoints (a clip ratio of 1), and the move fails as the pose does.
+       *
+       * @param servoValues Pointer to an array of 6 floats that receives the servo angles, if a pose was found
+       * @param pose Requested pose: sway, surge, heave (mm), pitch, roll, yaw (degrees)
+       * @return IK_RESULT_CLIPPED, with the fraction of the move left out as the margin; if none of it was
+       *         applied, the failing status, leg and margin of the pose itself (IK_RESULT_UNREACHABLE if only
+       *         the WorkspaceMap rejects it)
+       */
+      IkResult clampMove(float *servoValues, const float *pose);
+#endif
+
     public:
       /**
        * @brief Construct a new Platform object
@@ -83,19 +200,18 @@ namespace stewy
        * This is equivalent to calling moveTo(servoValues, 0, 0, 0, 0, 0, 0).
        *
        * @param servoValues Pointer to an array of 6 floats where the calculated servo angles will be stored
-       * @return true if the movement is physically possible and the servo values were calculated successfully
-       * @return false if the movement is not possible due to physical constraints
+       * @return IkResult of the move, ok() if the servo values were calculated successfully
        *
        * @see moveTo
        */
-      bool home(float *servoValues);
+      IkResult home(float *servoValues);
 
       /**
        * @brief Move platform to specified position and orientation
        *
        * Calculates servo angles for the specified 6DOF position and orientation using inverse kinematics.
        * The calculated angles are stored in the servoValues array. If the movement is not physically
-       * possible (e.g., beyond the platform's range of motion), the function returns false and
+       * possible (e.g., beyond the platform's range of motion), the result is not ok() and
        * the servoValues array remains unchanged.
        *
        * @param servoValues Pointer to an array of 6 floats where the calculated servo angles will be stored
@@ -105,14 +221,41 @@ namespace stewy
        * @param pitch Rotation around X axis in degrees, constrained by PITCH_MIN and PITCH_MAX
        * @param roll Rotation around Y axis in degrees, constrained by ROLL_MIN and ROLL_MAX
        * @param yaw Rotation around Z axis in degrees, constrained by YAW_MIN and YAW_MAX
-       * @return true if the movement is physically possible and the servo values were calculated successfully
-       * @return false if the movement is not possible due to physical constraints or parameter limits
+       * @return IkResult of the move: ok() if the movement is physically possible and the servo values were
+       *         calculated successfully; otherwise the reason, with the failing leg or pose component
        *
-       * @note If the function returns false, the servoValues array will not be modified.
-       * @note The function performs boundary checking on all parameters and logs errors for out-of-range values.
+       * @note If the result is not ok(), the servoValues array will not be modified.
+       * @note Nothing is logged: every outcome is counted, and failures are reported by reportDiagnostics().
        * @note The AGGRO scaling factor is applied to the calculated servo angles to increase the range of motion.
+       * @note With IK_JACOBIAN_ENABLED, small pose changes are solved with an IncrementalIk instead of the full solve.
+       * @note With WORKSPACE_MAP_ENABLED, poses that the WorkspaceMap knows to be unreachable are rejected without solving.
+       * @note With POSE_CACHE_ENABLED, a pose that rounds to a recently solved one gets the stored servo angles, without solving.
+       *       Only full solves are stored, and the map is checked first, so the cache never answers for an unreachable pose.
+       * @note With CLAMP defined, an unreachable pose is clipped to the furthest reachable pose on the way
+       *       to it instead, and the result is IK_RESULT_CLIPPED if any part of the move was applied.
        */
-      bool moveTo(float *servoValues, int sway, int surge, int heave, float pitch, float roll, float yaw);
+      IkResult moveTo(float *servoValues, int sway, int surge, int heave, float pitch, float roll, float yaw);
+
+#ifdef WORKSPACE_MAP_ENABLED
+      /**
+       * @brief Check whether a pose is reachable, without solving the IK
+       *
+       * Looks the pose up in the WorkspaceMap, in constant time. Only
+       * WORKSPACE_UNREACHABLE is definitive for moveTo(): a pose in a
+       * partly reachable cell, or outside the map, is WORKSPACE_UNKNOWN.
+       *
+       * @param sway Translation along X axis in mm
+       * @param surge Translation along Y axis in mm
+       * @param heave Translation along Z axis in mm
+       * @param pitch Rotation around X axis in degrees
+       * @param roll Rotation around Y axis in degrees
+       * @param yaw Rotation around Z axis in degrees
+       * @return WorkspaceStatus of the pose
+       *
+       * @see WorkspaceMap
+       */
+      WorkspaceStatus checkPose(int sway, int surge, int heave, float pitch, float roll, float yaw) const;
+#endif
 
       /**
        * @brief Move platform to specified pitch and roll angles
@@ -124,13 +267,234 @@ namespace stewy
        * @param servoValues Pointer to an array of 6 floats where the calculated servo angles will be stored
        * @param pitch Pitch angle in degrees, constrained by PITCH_MIN and PITCH_MAX
        * @param roll Roll angle in degrees, constrained by ROLL_MIN and ROLL_MAX
-       * @return true if the movement is physically possible and the servo values were calculated successfully
-       * @return false if the movement is not possible due to physical constraints or parameter limits
+       * @return IkResult of the move, as for the full moveTo
        *
        * @note This method calls the full moveTo method with the current values for sway, surge, heave, and yaw.
+       * @note With IK_LUT_ENABLED, the servo angles are interpolated from a PitchRollTable when possible,
+       *       and the full solve is only used while the table is being rebuilt, outside its grid, or
+       *       next to an infeasible grid point.
        * @see moveTo
+       * @see PitchRollTable
+       */
+      IkResult moveTo(float *servoValues, float pitch, float roll);
+
+      /**
+       * @brief Move platform to specified position and orientation, given as a rotation matrix
+       *
+       * For callers that already hold the orientation as a matrix (motion
+       * cueing filters, interpolators, the forward kinematics): the IK uses
+       * the matrix as is, and neither the solve nor the range checks
+       * evaluate any trig. The Euler overloads build this same matrix from
+       * their angles.
+       *
+       * The angle limits are those of the Euler angles of the matrix (see
+       * orientation::toEuler). The Euler setpoints are only recovered from
+       * the matrix when read, by getPitch() or by the next Euler move.
+       *
+       * @param servoValues Pointer to an array of 6 floats where the calculated servo angles will be stored
+       * @param sway Translation along X axis in mm, constrained by SWAY_MIN and SWAY_MAX
+       * @param surge Translation along Y axis in mm, constrained by SURGE_MIN and SURGE_MAX
+       * @param heave Translation along Z axis in mm, constrained by HEAVE_MIN and HEAVE_MAX
+       * @param rotation Orientation of the platform
+       * @return IkResult of the move, as for the Euler moveTo
+       *
+       * @note The lookup table, the pose cache, the workspace map and the incremental IK are keyed on
+       *       Euler angles, and do not apply: every move given as a rotation is a full solve.
+       * @note With CLAMP defined, an unreachable pose is clipped as for the Euler moveTo.
+       */
+      IkResult moveTo(float *servoValues, int sway, int surge, int heave, const RotationMatrix &rotation);
+
+      /**
+       * @brief Move platform to specified position and orientation, given as a quaternion
+       *
+       * Converts the quaternion to a rotation matrix, without trig, and
+       * moves as the rotation matrix overload.
+       *
+       * @param servoValues Pointer to an array of 6 floats where the calculated servo angles will be stored
+       * @param sway Translation along X axis in mm, constrained by SWAY_MIN and SWAY_MAX
+       * @param surge Translation along Y axis in mm, constrained by SURGE_MIN and SURGE_MAX
+       * @param heave Translation along Z axis in mm, constrained by HEAVE_MIN and HEAVE_MAX
+       * @param quaternion Orientation of the platform, normalized on the way
+       * @return IkResult of the move, as for the Euler moveTo
+       */
+      IkResult moveTo(float *servoValues, int sway, int surge, int heave, const Quaternion &quaternion);
+
+      /**
+       * @brief Log the moves that failed since the last report
+       *
+       * Logs one line, with the number of failed moves and the reason for
+       * the last one, at most once every IK_DIAGNOSTIC_INTERVAL_MS, and
+       * only if a move failed. Call it once per loop, outside the solve.
+       */
+      void reportDiagnostics();
+
+      /**
+       * @brief Get the move outcome counters
+       *
+       * @return Counters of all moves on this instance
+       */
+      const IkDiagnostics &getDiagnostics() const;
+
+      /**
+       * @brief Solve a sequence of poses, without moving the platform
+       *
+       * Stateless batch solve for precomputed motions (demo or cueing
+       * sequences): the setpoints are not read or changed, and neither SLAM
+       * nor CLAMP applies. A pose outside the SWAY_MIN .. YAW_MAX envelope is
+       * marked infeasible, as moveTo() would reject it.
+       *
+       * @param poses Array of n poses
+       * @param n Number of poses
+       * @param out Receives the servo angles of each pose, as moveTo() would write them
+       * @param mask Receives one bit per pose, set if the pose is feasible
+       * @return Number of feasible poses
+       *
+       * @see IkKernel::solveBatch
+       */
+      size_t solveBatch(const Pose *poses, size_t n, ServoFrameSoA &out, FeasibilityMask &mask) const;
+
+#ifdef CLAMP
+      /**
+       * @brief Get the clipping of the last move
+       *
+       * @return Fraction of the requested pose change that the last moveTo left out:
+       *         0 if the pose was reached, 1 if the platform did not move at all
+       */
+      float getClipRatio() const;
+#endif
+
+      /**
+       * @brief Get the platform geometry
+       *
+       * @return Geometry used by all instances
+       */
+      static const GeometryProfile &getGeometry();
+
+      /**
+       * @brief Change one tunable field of the platform geometry
+       *
+       * Applies to all instances at their next move: their setpoints are
+       * solved again even if unchanged.
+       *
+       * @param name Name of the field, as in GEOMETRY_PARAMS (e.g. "ROD_LENGTH")
+       * @param value New value, in mm or degrees
+       * @return true if it was applied
+       * @return false if the name is unknown or the resulting geometry is not valid (nothing changes)
+       *
+       * @see GeometryProfile::isValid
+       */
+      static bool setGeometryParam(const char *name, double value);
+
+      /**
+       * @brief Go back to the geometry of PlatformGeometry.h
+       */
+      static void resetGeometry();
+
+      /**
+       * @brief Load the platform geometry saved in EEPROM
+       *
+       * Call it before constructing any Platform. A blank, corrupt or
+       * invalid record is ignored.
+       *
+       * @return true if a saved geometry was applied
+       * @return false if the geometry of PlatformGeometry.h is kept
+       */
+      static bool loadGeometry();
+
+      /**
+       * @brief Apply a geometry record, as from EEPROM or a record keyframe
+       *
+       * @param record Record made by GeometryProfile::toRecord()
+       * @return true if it was applied
+       * @return false if it is corrupt or invalid (nothing changes)
+       */
+      static bool setGeometry(const GeometryRecord &record);
+
+      /**
+       * @brief Save the platform geometry to EEPROM
+       */
+      static void saveGeometry();
+
+      /**
+       * @brief Start the solve caches afresh
+       *
+       * Empties the lookup table, the incremental IK and the pose cache,
+       * whose contents depend on the poses solved so far. The recorder does
+       * at each keyframe, so that the replay of a record solves the same way
+       * from a keyframe as the firmware did.
+       */
+      static void invalidateCaches();
+
+      /**
+       * @brief Get the setpoints, for a record keyframe
+       *
+       * @param state Receives the setpoints
+       */
+      void getState(PlatformState &state);
+
+      /**
+       * @brief Restore the setpoints of getState()
+       *
+       * @param state Setpoints
+       */
+      void setState(const PlatformState &state);
+
+#ifdef IK_LUT_ENABLED
+      /**
+       * @brief Get the pitch/roll lookup table
+       *
+       * The table is shared by all instances, so its hit and miss counters
+       * cover every pitch/roll moveTo() with the default servo range.
+       *
+       * @return The shared PitchRollTable
+       */
+      static PitchRollTable &getPitchRollTable();
+#endif
+
+#ifdef POSE_CACHE_ENABLED
+      /**
+       * @brief Get the pose cache
+       *
+       * The cache is shared by all instances, so its hit and miss counters
+       * cover every moveTo() with the default servo range.
+       *
+       * @return The shared PoseCache
+       */
+      static PoseCache &getPoseCache();
+#endif
+
+#ifdef FK_ENABLED
+      /**
+       * @brief Estimate the platform pose from the actual servo positions
+       *
+       * Runs at most FK_MAX_ITERATIONS Newton-Raphson iterations of the forward
+       * kinematics, starting from the previous estimate. Call it once per loop
+       * with the slewed servo positions, so that consecutive estimates stay close.
+       *
+       * @param servoPositions Pointer to an array of 6 servo angles in degrees, as written to the servos
+       * @param pose Pointer to an array of 6 floats that receives sway, surge, heave (mm), pitch, roll and yaw (degrees)
+       * @return true if the estimate converged to within FK_TOLERANCE
+       * @return false if it did not; pose still receives the best estimate
+       *
+       * @note Servos clamped to their limits make the estimate approximate.
+       * @see ForwardKinematics
+       */
+      bool estimatePose(const float *servoPositions, float *pose);
+
+      /**
+       * @brief Get the last pose estimated by estimatePose()
+       *
+       * @return const float* Array of 6 floats: sway, surge, heave (mm), pitch, roll and yaw (degrees)
+       */
+      const float *getEstimatedPose() const;
+
+      /**
+       * @brief Get the forward kinematics convergence statistics
+       *
+       * @return Statistics of all estimatePose calls on this instance
        */
-      bool moveTo(float *servoValues, float pitch, float roll);
+      const FkStats &getFkStats() const;
+#endif
 
       /**
        * @brief Get current sway value
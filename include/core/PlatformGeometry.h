@@ -24,8 +24,6 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <Arduino.h>
-
 namespace stewy
 {
   namespace core
@@ -50,6 +48,16 @@ namespace stewy
 #define ROTATION_POINT_OFFSET 0 // Height offset for rotation point in mm (0 = rotate around home position)
 #define TRANSLATION_FIRST true  // Apply translation before rotation for better range
 
+/*
+  Scalar type used by the IK kernel (see IkKernel.h). The Teensy 3.2 (MK20DX256)
+  has no FPU, so double math is emulated in software on every control tick.
+
+  IK_SCALAR_FLOAT solves in single precision, IK_SCALAR_FIXED solves in Q16.16
+  fixed point. If neither is defined, the kernel solves in double precision.
+*/
+#define IK_SCALAR_FLOAT
+// #define IK_SCALAR_FIXED
+
 /*
   If defined, the IK algorithm will "slam" values to min or max when it encounters
   an asymptotic condition. That is, if the solution requires that the servo (e.g.) extend
@@ -60,6 +68,23 @@ namespace stewy
 */
 // #define SLAM
 
+/*
+  If defined, a pose that the IK cannot reach is not rejected outright. Instead,
+  the platform moves as far as it can along the straight line from the current
+  setpoint to the requested pose: the fraction of the way is found by bisection
+  over the IK, with CLAMP_ITERATIONS solves (a resolution of 1 / 2^CLAMP_ITERATIONS),
+  and Platform::getClipRatio() reports the fraction that was left out.
+
+  If NOT defined, an unreachable pose leaves the servos (and setpoints) unchanged.
+  CLAMP and SLAM are alternatives; define at most one of them.
+*/
+#define CLAMP
+#define CLAMP_ITERATIONS 6
+
+#if defined(SLAM) && defined(CLAMP)
+#error "SLAM and CLAMP cannot both be defined"
+#endif
+
 /*
   Prescalar to the output of the platform IK solution for each servo.
   NOTE: Even with aggro, the solution will never fall outside the range of
@@ -70,15 +95,15 @@ namespace stewy
     //==============================================================================
     // Geometry of the platform.
 
-#define THETA_P_DEG 45.25                // Platform joint angle (degrees) offset from AXIS[1|2|3]. A value of zero puts these joints directly on the axes
-#define THETA_B_DEG 24.5                 // Base Servo pinion angle (degrees) offset from AXIS[1|2|3]. A value of zero puts the servo pinion directly on the axes
-#define THETA_P (THETA_P_DEG * PI / 180) // Theta P, in radians
-#define THETA_B (THETA_B_DEG * PI / 180) // Theta B, in radians
-#define P_RAD 50                         // Platform radius (mm). The distance from the center of the platform to the center of one platform / pushrod "joint". This should be the same for all six pushrods.
-#define B_RAD 80.2                       // Base radius (mm). Distance from the center of the base plate to the center of one servo pinion gear. Again, this should be the same for all six servos.
-#define ARM_LENGTH 25                    // Servo arm length (mm). Distance from the center of the servo pivot to the center of the pushrod pivot on the servo arm.
-#define ROD_LENGTH 155                   // Push rod length (mm). Distance between pushrod ball joints (servo to platform).
-#define Z_HOME 148                       // Default Z height of the platform (above the base), with servo arms horizontal. Formally, the distance from the plane described by the collection of servo pinion gear centers, to the plane described by the collection of platform / pushrod joints.
+#define THETA_P_DEG 45.25 // Platform joint angle (degrees) offset from AXIS[1|2|3]. A value of zero puts these joints directly on the axes
+#define THETA_B_DEG 24.5  // Base Servo pinion angle (degrees) offset from AXIS[1|2|3]. A value of zero puts the servo pinion directly on the axes
+#define P_RAD 50          // Platform radius (mm). The distance from the center of the platform to the center of one platform / pushrod "joint". This should be the same for all six pushrods.
+#define B_RAD 80.2        // Base radius (mm). Distance from the center of the base plate to the center of one servo pinion gear. Again, this should be the same for all six servos.
+#define ARM_LENGTH 25     // Servo arm length (mm). Distance from the center of the servo pivot to the center of the pushrod pivot on the servo arm.
+#define ROD_LENGTH 155    // Push rod length (mm). Distance between pushrod ball joints (servo to platform).
+#define Z_HOME 148        // Default Z height of the platform (above the base), with servo arms horizontal. Formally, the distance from the plane described by the collection of servo pinion gear centers, to the plane described by the collection of platform / pushrod joints.
+
+    constexpr double GEOMETRY_PI = 3.14159265358979323846; ///< PI, without depending on Arduino.h
 
     /*
        There are three axes of symmetry (AXIS1, AXIS2, AXIS3). Looking down on the
@@ -88,60 +113,206 @@ namespace stewy
        an axis, and an offset angle (positive or negative theta) from the axis.
      */
 
-#define AXIS1 (PI / 6)  // 30 degrees.
-#define AXIS2 (-PI / 2) //-90 degrees.
+#define AXIS1_DEG 30  // 30 degrees.
+#define AXIS2_DEG -90 //-90 degrees.
 /*
    NOTE: We make an assumption of mirror symmetry for AXIS3 along the Y axis.
    That is, AXIS1 is at (e.g.) 30 degrees, and AXIS3 will be at 120 degrees
    We account for this by negating the value of x-coordinates generated based
    on this axis later on. This is potentially messy, and should maybe be refactored.
  */
-#define AXIS3 AXIS1
+#define AXIS3_DEG AXIS1_DEG
 
-    /*
-       Absolute angle that the servo arm plane of rotation is at (degrees), from the world-X axis.
-    */
-    const double THETA_S_DEG[6] = {
-        -60,
-        120,
-        180,
-        0,
-        60,
-        -120};
-
-    const double THETA_S[6] = { // Servo arm angle (radians)
-        radians(THETA_S_DEG[0]),
-        radians(THETA_S_DEG[1]),
-        radians(THETA_S_DEG[2]),
-        radians(THETA_S_DEG[3]),
-        radians(THETA_S_DEG[4]),
-        radians(THETA_S_DEG[5])};
+    /**
+     * @struct GeometryDescription
+     * @brief Design parameters of the platform
+     *
+     * Everything the IK needs to know about the physical platform. The
+     * constants of the IK are derived from this, at compile time for
+     * DEFAULT_GEOMETRY (see GeometryTables) and at runtime for a geometry
+     * loaded into a GeometryProfile.
+     */
+    struct GeometryDescription
+    {
+      double platformRadius;      ///< P_RAD, in mm
+      double baseRadius;          ///< B_RAD, in mm
+      double thetaPDeg;           ///< THETA_P_DEG
+      double thetaBDeg;           ///< THETA_B_DEG
+      double axisDeg[3];          ///< AXIS1_DEG, AXIS2_DEG, AXIS3_DEG
+      double servoPlaneDeg[6];    ///< Absolute angle of each servo arm plane of rotation (degrees), from the world-X axis
+      double armLength;           ///< ARM_LENGTH, in mm
+      double rodLength;           ///< ROD_LENGTH, in mm
+      double zHome;               ///< Z_HOME, in mm
+      double rotationPointOffset; ///< ROTATION_POINT_OFFSET, in mm
+      double aggro;               ///< AGGRO
+    };
 
-    /*
-       XY cartesian coordinates of the platform joints, based on the polar
-       coordinates (platform radius P_RAD, radial axis AXIS[1|2\3], and offset THETA_P.
-       These coordinates are in the plane of the platform itself.
+    /**
+     * @brief Geometry of this platform, from the defines above
      */
-    const double P_COORDS[6][2] = {
-        {P_RAD * cos(AXIS1 + THETA_P), P_RAD *sin(AXIS1 + THETA_P)},
-        {P_RAD * cos(AXIS1 - THETA_P), P_RAD *sin(AXIS1 - THETA_P)},
-        {P_RAD * cos(AXIS2 + THETA_P), P_RAD *sin(AXIS2 + THETA_P)},
-        {-P_RAD * cos(AXIS2 + THETA_P), P_RAD *sin(AXIS2 + THETA_P)},
-        {-P_RAD * cos(AXIS3 - THETA_P), P_RAD *sin(AXIS3 - THETA_P)},
-        {-P_RAD * cos(AXIS3 + THETA_P), P_RAD *sin(AXIS3 + THETA_P)}};
+    constexpr GeometryDescription DEFAULT_GEOMETRY = {
+        P_RAD,
+        B_RAD,
+        THETA_P_DEG,
+        THETA_B_DEG,
+        {AXIS1_DEG, AXIS2_DEG, AXIS3_DEG},
+        {-60, 120, 180, 0, 60, -120},
+        ARM_LENGTH,
+        ROD_LENGTH,
+        Z_HOME,
+        ROTATION_POINT_OFFSET,
+        AGGRO};
 
-    /*
-       XY cartesian coordinates of the servo centers, based on the polar
-       coordinates (base radius B_RAD, radial axis AXIS[1|2\3], and offset THETA_B.
-       These coordinates are in the plane of the base itself.
+    /**
+     * @struct LegGeometry
+     * @brief Derived geometry of one leg, in the IK scalar type
+     *
+     * @tparam T Scalar type: double, float or Fixed16
      */
-    const double B_COORDS[6][2] = {
-        {B_RAD * cos(AXIS1 + THETA_B), B_RAD *sin(AXIS1 + THETA_B)},
-        {B_RAD * cos(AXIS1 - THETA_B), B_RAD *sin(AXIS1 - THETA_B)},
-        {B_RAD * cos(AXIS2 + THETA_B), B_RAD *sin(AXIS2 + THETA_B)},
-        {-B_RAD * cos(AXIS2 + THETA_B), B_RAD *sin(AXIS2 + THETA_B)},
-        {-B_RAD * cos(AXIS3 - THETA_B), B_RAD *sin(AXIS3 - THETA_B)},
-        {-B_RAD * cos(AXIS3 + THETA_B), B_RAD *sin(AXIS3 + THETA_B)}};
+    template <typename T>
+    struct LegGeometry
+    {
+      T px, py;     ///< XY coordinates of the platform joint, in the plane of the platform (mm)
+      T bx, by;     ///< XY coordinates of the servo center, in the plane of the base (mm)
+      T cosS, sinS; ///< cos/sin of the servo arm plane angle
+    };
+
+    /**
+     * @struct IkGeometry
+     * @brief Every geometry-derived constant of the IK, in one flat block
+     *
+     * A solve reads nothing else about the geometry, so swapping this block
+     * swaps the platform the IK solves for.
+     *
+     * @tparam T Scalar type: double, float or Fixed16
+     */
+    template <typename T>
+    struct IkGeometry
+    {
+      LegGeometry<T> legs[6]; ///< Per-leg geometry
+      T kOffset;              ///< rodLength^2 - armLength^2
+      T maxReachSq;           ///< (armLength + rodLength)^2
+      T twoArm;               ///< 2 * armLength
+      T zHome;                ///< zHome
+      T pivotZ;               ///< rotationPointOffset
+      float maxReach;         ///< armLength + rodLength, for diagnostics
+      float aggro;            ///< AGGRO prescalar of the servo angles
+    };
+
+    namespace geometry
+    {
+      /*
+        constexpr trigonometry. <cmath> is not constexpr before C++26, so the
+        tables below use Taylor series, which converge to double precision
+        within 15 terms after reducing the angle to [-PI, PI].
+      */
+      constexpr double wrap(double rad)
+      {
+        return rad > GEOMETRY_PI ? wrap(rad - 2 * GEOMETRY_PI) : (rad < -GEOMETRY_PI ? wrap(rad + 2 * GEOMETRY_PI) : rad);
+      }
+
+      constexpr double sinSeries(double x2, double term, int n)
+      {
+        return n > 15 ? term : term + sinSeries(x2, -term * x2 / ((2 * n) * (2 * n + 1)), n + 1);
+      }
+
+      constexpr double cosSeries(double x2, double term, int n)
+      {
+        return n > 15 ? term : term + cosSeries(x2, -term * x2 / ((2 * n + 1) * (2 * n + 2)), n + 1);
+      }
+
+      constexpr double sinRad(double rad)
+      {
+        return sinSeries(wrap(rad) * wrap(rad), wrap(rad), 1);
+      }
+
+      constexpr double cosRad(double rad)
+      {
+        return cosSeries(wrap(rad) * wrap(rad), 1.0, 0);
+      }
+
+      constexpr double toRad(double deg)
+      {
+        return deg * GEOMETRY_PI / 180.0;
+      }
+
+      /*
+         Leg i sits on axis (i / 2), offset by +/- theta from it. Legs 3, 4
+         and 5 are mirrored along the Y axis (see AXIS3_DEG).
+      */
+      constexpr double polarAngle(const GeometryDescription &g, double thetaDeg, int i)
+      {
+        return toRad(g.axisDeg[i / 2] + ((i == 1 || i == 4) ? -thetaDeg : thetaDeg));
+      }
+
+      constexpr double mirror(int i)
+      {
+        return i >= 3 ? -1.0 : 1.0;
+      }
+
+      /**
+       * @brief Derive the geometry of one leg from a platform description
+       *
+       * Usable both at compile time (for the flash tables) and at runtime.
+       *
+       * @param g Platform description
+       * @param i Leg index (0-5)
+       * @return LegGeometry<T> Joint coordinates and servo plane cos/sin
+       */
+      template <typename T>
+      constexpr LegGeometry<T> deriveLeg(const GeometryDescription &g, int i)
+      {
+        return LegGeometry<T>{
+            T(mirror(i) * g.platformRadius * cosRad(polarAngle(g, g.thetaPDeg, i))),
+            T(g.platformRadius * sinRad(polarAngle(g, g.thetaPDeg, i))),
+            T(mirror(i) * g.baseRadius * cosRad(polarAngle(g, g.thetaBDeg, i))),
+            T(g.baseRadius * sinRad(polarAngle(g, g.thetaBDeg, i))),
+            T(cosRad(toRad(g.servoPlaneDeg[i]))),
+            T(sinRad(toRad(g.servoPlaneDeg[i])))};
+      }
+
+      /**
+       * @brief Derive all IK constants from a platform description
+       *
+       * Usable both at compile time (for the flash tables) and at runtime.
+       *
+       * @param g Platform description
+       * @return IkGeometry<T> Constant block of the IK
+       */
+      template <typename T>
+      constexpr IkGeometry<T> deriveIk(const GeometryDescription &g)
+      {
+        return IkGeometry<T>{
+            {deriveLeg<T>(g, 0), deriveLeg<T>(g, 1), deriveLeg<T>(g, 2),
+             deriveLeg<T>(g, 3), deriveLeg<T>(g, 4), deriveLeg<T>(g, 5)},
+            T(g.rodLength * g.rodLength - g.armLength * g.armLength),
+            T((g.armLength + g.rodLength) * (g.armLength + g.rodLength)),
+            T(2.0 * g.armLength),
+            T(g.zHome),
+            T(g.rotationPointOffset),
+            (float)(g.armLength + g.rodLength),
+            (float)g.aggro};
+      }
+    } // namespace geometry
+
+    /**
+     * @struct GeometryTables
+     * @brief IK constants of DEFAULT_GEOMETRY, computed at compile time
+     *
+     * The table is a constant-initialized static member of a class template,
+     * so it is emitted once (in flash) no matter how many translation units
+     * include this header, and nothing runs at startup to fill it.
+     *
+     * @tparam T Scalar type: double, float or Fixed16
+     */
+    template <typename T>
+    struct GeometryTables
+    {
+      static constexpr IkGeometry<T> ik = geometry::deriveIk<T>(DEFAULT_GEOMETRY);
+    };
+
+    template <typename T>
+    constexpr IkGeometry<T> GeometryTables<T>::ik;
 
   } // namespace core
 } // namespace stewy
@@ -0,0 +1,50 @@
+#pragma once
+/**
+ * @file Pose.h
+ * @brief Platform pose
+ *
+ * This file contains the pose type used by the batch IK. It has no Arduino
+ * dependencies, so it can be used in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @struct Pose
+     * @brief Position and orientation of the platform
+     *
+     * The layout matches the float[6] poses used elsewhere (IncrementalIk,
+     * ForwardKinematics, WorkspaceMap), in the same order.
+     */
+    struct Pose
+    {
+      float sway;  ///< Translation along X axis in mm
+      float surge; ///< Translation along Y axis in mm
+      float heave; ///< Translation along Z axis in mm
+      float pitch; ///< Rotation around X axis in degrees
+      float roll;  ///< Rotation around Y axis in degrees
+      float yaw;   ///< Rotation around Z axis in degrees
+    };
+
+  } // namespace core
+} // namespace stewy
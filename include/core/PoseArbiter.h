@@ -0,0 +1,263 @@
+#pragma once
+/**
+ * @file PoseArbiter.h
+ * @brief Arbitration of pose requests from several input sources
+ *
+ * This file contains the stage between the input sources (command line,
+ * Nunchuck, touchscreen) and the platform: each source submits the pose it
+ * wants, and once per control tick the arbiter combines the requests and
+ * runs a single IK solve on the one long-lived Platform.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include "core/Config.h"
+#include "core/Platform.h"
+#include "core/Pose.h"
+#include "core/PoseInterpolator.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @enum PoseSource
+     * @brief Producer of a pose request
+     */
+    enum PoseSource
+    {
+      SOURCE_COMMAND_LINE, ///< Shell commands (moveto, demo)
+      SOURCE_NUNCHUCK,     ///< Nunchuck CONTROL mode
+      SOURCE_TOUCHSCREEN,  ///< Ball balancing PID, and the lost-ball return to home
+      SOURCE_COUNT         ///< Number of sources
+    };
+
+    /**
+     * @enum PoseAxis
+     * @brief Bit of each pose component in a request's axis mask
+     */
+    enum PoseAxis
+    {
+      AXIS_SWAY = 1 << 0,  ///< Sway
+      AXIS_SURGE = 1 << 1, ///< Surge
+      AXIS_HEAVE = 1 << 2, ///< Heave
+      AXIS_PITCH = 1 << 3, ///< Pitch
+      AXIS_ROLL = 1 << 4,  ///< Roll
+      AXIS_YAW = 1 << 5,   ///< Yaw
+      AXIS_ALL = 0x3f      ///< All six
+    };
+
+    /**
+     * @struct PoseArbiterStats
+     * @brief Request counts, per source
+     */
+    struct PoseArbiterStats
+    {
+      unsigned long submitted[SOURCE_COUNT]; ///< Requests submitted
+      unsigned long replaced[SOURCE_COUNT];  ///< Requests replaced by a later one from the same source, in the same tick
+      unsigned long applied[SOURCE_COUNT];   ///< Requests that set at least one component of the solved pose
+      unsigned long overruled[SOURCE_COUNT]; ///< Requests that lost every component to a higher priority
+      unsigned long solves;                  ///< Ticks that ran the IK
+      unsigned long failures;                ///< Solves that the platform rejected
+    };
+
+    /**
+     * @struct PoseRequest
+     * @brief The pending request of one source
+     */
+    struct PoseRequest
+    {
+      float pose[6];    ///< Requested components: sway, surge, heave, pitch, roll, yaw
+      uint8_t axes;     ///< Mask of the requested components
+      uint8_t priority; ///< Priority
+      float weight;     ///< Blending weight
+    };
+
+    /**
+     * @struct PoseArbiterState
+     * @brief Pending requests and motion of a PoseArbiter, for a record keyframe
+     */
+    struct PoseArbiterState
+    {
+      PoseRequest requests[SOURCE_COUNT]; ///< Pending request of each source, if its axes are non-zero
+#ifdef POSE_INTERPOLATION_ENABLED
+      PoseInterpolatorState interpolator; ///< Motion from the current pose to the target
+      float target[6];                    ///< Pose the platform is moving to
+#endif
+    };
+
+    /**
+     * @class PoseArbiter
+     * @brief Combines the pose requests of one tick into a single IK solve
+     *
+     * Each source keeps at most one request per tick (a later submit
+     * replaces the earlier one). A request sets some of the six pose
+     * components, given by its axis mask, with a priority and a weight.
+     * update() resolves each component on its own:
+     * - the requests with the highest priority among those that set it win,
+     * - several winners are blended by their weights,
+     * - a component that no request sets keeps the current setpoint.
+     *
+     * The resulting pose is solved once by the Platform, whose setpoints
+     * then persist from tick to tick, so an unchanged pose costs nothing.
+     * A pitch/roll-only result goes through Platform::moveTo(servoValues,
+     * pitch, roll), and may be served by the lookup table.
+     *
+     * With POSE_INTERPOLATION_ENABLED, the resulting pose is the target of
+     * a PoseInterpolator instead, and every tick solves the interpolated
+     * pose until the platform gets there. Components that no request sets
+     * keep their target rather than their setpoint. On the way, the pose is
+     * solved as a quaternion, unless only pitch and roll are moving, which
+     * goes through the pitch/roll moveTo() as above; the target itself is
+     * solved in Euler angles, so that the pose cache and the incremental IK
+     * apply.
+     */
+    class PoseArbiter
+    {
+    public:
+      /**
+       * @brief Construct a new PoseArbiter
+       *
+       * @param platform The platform that solves every pose; must outlive the arbiter
+       */
+      PoseArbiter(Platform &platform);
+
+      /**
+       * @brief Submit a pose request for this tick
+       *
+       * @param source Producer of the request
+       * @param priority Higher wins (see the PRIORITY_* settings in Config.h)
+       * @param pose Requested pose; only the components in axes are used
+       * @param axes Mask of PoseAxis bits
+       * @param weight Weight when blended with requests of the same priority
+       */
+      void submit(PoseSource source, uint8_t priority, const Pose &pose, uint8_t axes = AXIS_ALL, float weight = 1.0f);
+
+      /**
+       * @brief Submit a pitch/roll request for this tick
+       *
+       * The other components keep their current value, unless another
+       * request sets them.
+       *
+       * @param source Producer of the request
+       * @param priority Higher wins
+       * @param pitch Rotation around X axis in degrees
+       * @param roll Rotation around Y axis in degrees
+       */
+      void submitPitchRoll(PoseSource source, uint8_t priority, float pitch, float roll);
+
+      /**
+       * @brief Submit a request for the home pose for this tick
+       *
+       * @param source Producer of the request
+       * @param priority Higher wins
+       */
+      void submitHome(PoseSource source, uint8_t priority);
+
+      /**
+       * @brief Combine this tick's requests and solve the result
+       *
+       * Call it once per tick, after every source has run. All requests are
+       * consumed, whatever the outcome.
+       *
+       * With POSE_INTERPOLATION_ENABLED, the platform moves one tick
+       * (CONTROL_INTERVAL_US) towards the target, even without a request.
+       * If the platform rejects a pose on the way, the motion stops there.
+       *
+       * @param servoValues Pointer to an array of 6 floats that receives the servo angles
+       * @return true if a pose was solved and applied
+       * @return false if there was nothing to solve, or the platform rejected the pose (servoValues unchanged)
+       */
+      bool update(float *servoValues);
+
+      /**
+       * @brief Check if the platform has got to the last resolved pose
+       *
+       * Without POSE_INTERPOLATION_ENABLED, update() solves every pose at
+       * once, so this is always true.
+       *
+       * @return true if update() has nothing left to solve without a new request
+       */
+      bool isSettled() const;
+
+      /**
+       * @brief Get the platform the arbiter solves on
+       *
+       * @return The long-lived platform
+       */
+      Platform &getPlatform();
+
+      /**
+       * @brief Get the pending requests and the motion, for a record keyframe
+       *
+       * The setpoints are the platform's, see Platform::getState().
+       *
+       * @param state Receives the state
+       */
+      void getState(PoseArbiterState &state) const;
+
+      /**
+       * @brief Restore the pending requests and the motion of getState()
+       *
+       * @param state State
+       */
+      void setState(const PoseArbiterState &state);
+
+      /**
+       * @brief Get the request counts
+       *
+       * @return Counts since construction
+       */
+      const PoseArbiterStats &getStats() const;
+
+      /**
+       * @brief Get the display name of a source
+       *
+       * @param source Producer of a request
+       * @return Name of the source
+       */
+      static const char *getSourceString(PoseSource source);
+
+    private:
+      Platform &_platform;                 ///< Long-lived platform, holds the setpoints
+      PoseRequest _requests[SOURCE_COUNT]; ///< Pending request of each source, if its axes are non-zero
+      PoseArbiterStats _stats;             ///< Request counts
+
+#ifdef POSE_INTERPOLATION_ENABLED
+      PoseInterpolator _interpolator; ///< Motion from the current pose to the target
+      float _target[6];               ///< Pose the platform is moving to: sway, surge, heave, pitch, roll, yaw
+
+      /**
+       * @brief Solve the target, with the pitch/roll moveTo() if the translation and the yaw are those of the platform
+       *
+       * @param servoValues Pointer to an array of 6 floats that receives the servo angles
+       * @return The platform's result
+       */
+      IkResult moveToTarget(float *servoValues);
+
+      /**
+       * @brief Move the target, and the interpolated pose, to where the platform is
+       */
+      void stopAtPlatform();
+#endif
+    };
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,153 @@
+#pragma once
+/**
+ * @file PoseCache.h
+ * @brief Fixed-size cache of servo angles for recently solved poses
+ *
+ * This file contains a small memoization cache, keyed on quantized 6-DOF
+ * poses, that returns stored servo angles instead of solving the IK again.
+ * It does not allocate, and has no Arduino dependencies, so it can be used
+ * in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @struct PoseCacheEntry
+     * @brief One cached pose and its servo angles
+     */
+    struct PoseCacheEntry
+    {
+      int32_t key[6];       ///< Pose components divided by their quantum, rounded
+      float servoValues[6]; ///< Servo angles in degrees, as written by Platform::moveTo()
+      uint32_t lastUse;     ///< Use counter at the last hit or store, 0 if the entry is empty
+    };
+
+    /**
+     * @class PoseCache
+     * @brief Memoization of servo angles on quantized poses
+     *
+     * A pose is rounded to a multiple of quantumMm (sway, surge, heave) and
+     * quantumDeg (pitch, roll, yaw), and two poses that round alike share an
+     * entry. The angles returned on a hit are those of the pose that was
+     * stored, so their error is bounded by how much the angles change within
+     * one quantum; keep the quanta small.
+     *
+     * The entries are owned by the caller. Lookups scan all of them, which
+     * for a few dozen entries costs far less than one IK solve. When the
+     * cache is full, a store replaces the least recently used entry.
+     *
+     * Poses are arrays of 6 floats: sway, surge, heave (mm), pitch, roll,
+     * yaw (degrees).
+     */
+    class PoseCache
+    {
+    public:
+      /**
+       * @brief Construct a new, empty PoseCache
+       *
+       * @param entries Storage for the entries
+       * @param capacity Number of entries
+       * @param quantumMm Quantum of sway, surge and heave, in mm
+       * @param quantumDeg Quantum of pitch, roll and yaw, in degrees
+       */
+      PoseCache(PoseCacheEntry *entries, size_t capacity, float quantumMm, float quantumDeg);
+
+      /**
+       * @brief Look a pose up
+       *
+       * @param pose Array of 6 floats: sway, surge, heave, pitch, roll, yaw
+       * @param servoValues Array of 6 floats that receives the stored servo angles on a hit
+       * @return true on a hit, false on a miss (servoValues is not modified)
+       */
+      bool lookup(const float *pose, float *servoValues);
+
+      /**
+       * @brief Store the servo angles of a pose
+       *
+       * Overwrites the entry of the pose if there is one, else takes an empty
+       * or the least recently used entry.
+       *
+       * @param pose Array of 6 floats: sway, surge, heave, pitch, roll, yaw
+       * @param servoValues Array of 6 servo angles in degrees
+       */
+      void store(const float *pose, const float *servoValues);
+
+      /**
+       * @brief Empty the cache
+       *
+       * Call it whenever the angles of a pose may have changed, e.g. after a
+       * geometry change. The hit and miss counters are kept.
+       */
+      void invalidate();
+
+      /**
+       * @brief Reset the hit and miss counters
+       */
+      void resetStats();
+
+      /**
+       * @brief Get the number of hits
+       *
+       * @return Number of lookups answered from the cache
+       */
+      unsigned long getHits() const;
+
+      /**
+       * @brief Get the number of misses
+       *
+       * @return Number of lookups not answered from the cache
+       */
+      unsigned long getMisses() const;
+
+      /**
+       * @brief Get the number of entries in use
+       *
+       * @return Number of non-empty entries
+       */
+      size_t getSize() const;
+
+      /**
+       * @brief Get the number of entries
+       *
+       * @return Capacity given to the constructor
+       */
+      size_t getCapacity() const;
+
+    private:
+      PoseCacheEntry *_entries; ///< Caller-owned entries
+      size_t _capacity;         ///< Number of entries
+      float _quantum[6];        ///< Quantum of each pose component
+      uint32_t _clock;          ///< Use counter, stamped on entries at each hit or store
+      unsigned long _hits;      ///< Number of hits
+      unsigned long _misses;    ///< Number of misses
+
+      void quantize(const float *pose, int32_t *key) const;
+      PoseCacheEntry *find(const int32_t *key);
+      void tick(PoseCacheEntry &entry);
+    };
+
+  } // namespace core
+} // namespace stewy
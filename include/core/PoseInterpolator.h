@@ -0,0 +1,178 @@
+#pragma once
+/**
+ * @file PoseInterpolator.h
+ * @brief Time-synchronized motion between poses, in pose space
+ *
+ * This file contains the pose-space counterpart of the per-servo ramp in
+ * updateServos(): the platform moves to its target pose on a straight line
+ * in translation and along the shortest arc in orientation, so all six legs
+ * start and arrive together. It has no Arduino dependencies, so it can be
+ * used in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/Orientation.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @struct PoseInterpolatorState
+     * @brief Segment and progress of a PoseInterpolator, for a record keyframe
+     */
+    struct PoseInterpolatorState
+    {
+      float from[3];       ///< Translation at the start of the segment
+      float to[3];         ///< Target translation
+      Quaternion fromQ;    ///< Orientation at the start of the segment
+      Quaternion toQ;      ///< Target orientation, in the hemisphere of fromQ
+      Quaternion targetQ;  ///< Target orientation, as set
+      float arc;           ///< Angle between fromQ and toQ on the unit sphere
+      float sinArc;        ///< sin(arc)
+      float delta[6];      ///< Change over the segment, in seconds at full speed
+      float maxSpeed;      ///< Largest ds/dt of the segment
+      float maxAccel;      ///< Largest d2s/dt2 of the segment
+      float s;             ///< Path parameter
+      float speed;         ///< ds/dt
+      float current[3];    ///< Current translation
+      Quaternion currentQ; ///< Current orientation
+    };
+
+    /**
+     * @class PoseInterpolator
+     * @brief Moves a pose towards a target under speed and acceleration limits
+     *
+     * Each target starts a segment from the current pose. Along it, the
+     * translation is interpolated linearly and the orientation by slerp,
+     * both with the same path parameter s, from 0 at the start to 1 at the
+     * target. s follows a trapezoidal speed profile whose limits are those
+     * of the translation or of the rotation, whichever is tighter for the
+     * length of the segment, so neither exceeds its own limits and both
+     * arrive at the same time.
+     *
+     * A target that changes every tick (a PID output, a joystick) starts a
+     * new segment every tick. The speed carries over to the new segment as
+     * its component along the new direction, as a fraction of the limits:
+     * a target that keeps moving the same way gives a continuous motion,
+     * and one that reverses starts the way back from rest.
+     *
+     * Speeds are in mm/s and degrees/s, accelerations in mm/s^2 and
+     * degrees/s^2. Translations are arrays of 3 floats: sway, surge,
+     * heave.
+     */
+    class PoseInterpolator
+    {
+    public:
+      /**
+       * @brief Construct a new PoseInterpolator, at rest at the home pose
+       *
+       * @param maxSpeedMm Largest translation speed, in mm/s
+       * @param maxAccelMm Largest translation acceleration, in mm/s^2
+       * @param maxSpeedDeg Largest rotation speed, in degrees/s
+       * @param maxAccelDeg Largest rotation acceleration, in degrees/s^2
+       */
+      PoseInterpolator(float maxSpeedMm, float maxAccelMm, float maxSpeedDeg, float maxAccelDeg);
+
+      /**
+       * @brief Jump to a pose, and stop there
+       *
+       * @param translation Sway, surge and heave in mm
+       * @param orientation Orientation, unit
+       */
+      void reset(const float *translation, const Quaternion &orientation);
+
+      /**
+       * @brief Set the pose to move to
+       *
+       * Starts a new segment from the current pose, unless the target is
+       * unchanged.
+       *
+       * @param translation Sway, surge and heave in mm
+       * @param orientation Orientation, unit
+       */
+      void setTarget(const float *translation, const Quaternion &orientation);
+
+      /**
+       * @brief Advance the motion
+       *
+       * @param dt Time since the previous step, in seconds
+       * @param translation Receives the current sway, surge and heave in mm
+       * @param orientation Receives the current orientation
+       */
+      void step(float dt, float *translation, Quaternion &orientation);
+
+      /**
+       * @brief Whether the target has been reached
+       *
+       * @return true if the pose is at the target, at rest
+       */
+      bool isSettled() const;
+
+      /**
+       * @brief Get the current speed
+       *
+       * @return Speed along the segment, as a fraction of the tighter limit (0 to 1)
+       */
+      float getSpeedFraction() const;
+
+      /**
+       * @brief Get the segment and the progress along it, for a record keyframe
+       *
+       * @param state Receives the state
+       */
+      void getState(PoseInterpolatorState &state) const;
+
+      /**
+       * @brief Restore the segment and the progress of getState()
+       *
+       * @param state State, from an interpolator with the same limits
+       */
+      void setState(const PoseInterpolatorState &state);
+
+    private:
+      float _maxSpeedMm;  ///< Largest translation speed
+      float _maxAccelMm;  ///< Largest translation acceleration
+      float _maxSpeedDeg; ///< Largest rotation speed
+      float _maxAccelDeg; ///< Largest rotation acceleration
+
+      float _from[3];         ///< Translation at the start of the segment
+      float _to[3];           ///< Target translation
+      Quaternion _fromQ;      ///< Orientation at the start of the segment
+      Quaternion _toQ;        ///< Target orientation, in the hemisphere of _fromQ
+      Quaternion _targetQ;    ///< Target orientation, as set
+      float _arc;             ///< Angle between _fromQ and _toQ on the unit sphere, half the rotation, in radians
+      float _sinArc;          ///< sin(_arc), for slerp
+      float _delta[6];        ///< Change over the segment, in seconds at full speed: translation, then rotation vector
+      float _maxSpeed;        ///< Largest ds/dt of the segment
+      float _maxAccel;        ///< Largest d2s/dt2 of the segment
+      float _s;               ///< Path parameter, 0 at the start of the segment, 1 at the target
+      float _speed;           ///< ds/dt
+      float _current[3];      ///< Current translation
+      Quaternion _currentQ;   ///< Current orientation
+
+      /**
+       * @brief Pose at a point of the segment
+       */
+      void evaluate(float s, float *translation, Quaternion &orientation) const;
+    };
+
+  } // namespace core
+} // namespace stewy
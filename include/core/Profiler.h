@@ -0,0 +1,170 @@
+#pragma once
+/**
+ * @file Profiler.h
+ * @brief Per-stage timing of the control loop, on a cycle counter
+ *
+ * This file contains a lightweight profiler that times the stages of the
+ * control loop (shell, nunchuck, touch read, filter, PID, IK, servo write)
+ * and keeps the minimum, mean, maximum and a log2 histogram of each, in a
+ * fixed block of RAM. It has no Arduino dependencies: the counter is
+ * supplied by the caller, the DWT cycle counter on the Teensy and a
+ * std::chrono clock in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @enum ProfileStage
+     * @brief Stage of the control loop timed by the Profiler
+     */
+    enum ProfileStage
+    {
+      STAGE_SHELL,       ///< Command line
+      STAGE_NUNCHUCK,    ///< Nunchuck read and mode handling
+      STAGE_TOUCH_READ,  ///< Touchscreen ADC read
+      STAGE_FILTER,      ///< Touchscreen deadzone and filter
+      STAGE_PID,         ///< Ball balancing PID
+      STAGE_IK,          ///< Pose arbitration and IK solve
+      STAGE_SERVO_WRITE, ///< Servo setpoints and pulse widths
+      STAGE_ESTIMATE,    ///< Forward kinematics pose estimate
+      STAGE_COUNT        ///< Number of stages
+    };
+
+    const int PROFILE_BUCKETS = 32; ///< Histogram buckets, one per power of two of the cycle count
+
+    /**
+     * @struct StageStats
+     * @brief Timings of one stage, since the last reset
+     */
+    struct StageStats
+    {
+      uint32_t count;                      ///< Times the stage ran
+      uint32_t minCycles;                  ///< Shortest run
+      uint32_t maxCycles;                  ///< Longest run
+      uint64_t totalCycles;                ///< Sum of all runs, for the mean
+      uint32_t histogram[PROFILE_BUCKETS]; ///< Runs of 2^b to 2^(b+1) - 1 cycles in bucket b (0 cycles in bucket 0)
+    };
+
+    /**
+     * @class Profiler
+     * @brief Times the stages of the control loop
+     *
+     * Bracket a stage with start() and stop():
+     *
+     *   const uint32_t start = profiler.start();
+     *   ...
+     *   profiler.stop(STAGE_IK, start);
+     *
+     * A stage costs two reads of the counter and a few additions; nothing
+     * is allocated. The counter is free running and may wrap around, so a
+     * single run must be shorter than its period (about 59 s for the cycle
+     * counter of a 72 MHz Teensy). The Profiler is not interrupt safe: time
+     * stages from the loop only.
+     */
+    class Profiler
+    {
+    public:
+      /**
+       * @brief Construct a new Profiler
+       *
+       * @param counter Returns the cycle counter (ARM_DWT_CYCCNT on the Teensy)
+       * @param cyclesPerUs Cycles of the counter per microsecond (F_CPU / 1000000 on the Teensy)
+       */
+      Profiler(uint32_t (*counter)(), uint32_t cyclesPerUs);
+
+      /**
+       * @brief Start timing a stage
+       *
+       * @return uint32_t The counter, to pass to stop()
+       */
+      uint32_t start() const
+      {
+        return _counter();
+      }
+
+      /**
+       * @brief Stop timing a stage, and record its run
+       *
+       * @param stage Stage timed
+       * @param startCycles Counter returned by start()
+       */
+      void stop(ProfileStage stage, uint32_t startCycles)
+      {
+        record(stage, _counter() - startCycles);
+      }
+
+      /**
+       * @brief Record a run of a stage
+       *
+       * @param stage Stage timed
+       * @param cycles Duration of the run, in cycles
+       */
+      void record(ProfileStage stage, uint32_t cycles);
+
+      /**
+       * @brief Get the timings of a stage
+       *
+       * @param stage Stage
+       * @return const StageStats& Timings since the last reset
+       */
+      const StageStats &getStats(ProfileStage stage) const;
+
+      /**
+       * @brief Reset the timings of all stages
+       */
+      void reset();
+
+      /**
+       * @brief Convert cycles of the counter to microseconds
+       *
+       * @param cycles Cycles
+       * @return float Microseconds
+       */
+      float toMicroseconds(double cycles) const;
+
+      /**
+       * @brief Get the histogram bucket of a duration
+       *
+       * @param cycles Duration, in cycles
+       * @return int Bucket, floor(log2(cycles)), or 0 for 0 cycles
+       */
+      static int getBucket(uint32_t cycles);
+
+      /**
+       * @brief Get the name of a stage
+       *
+       * @param stage Stage
+       * @return const char* Name, for reports
+       */
+      static const char *getStageString(ProfileStage stage);
+
+    private:
+      uint32_t (*_counter)();         ///< Cycle counter
+      uint32_t _cyclesPerUs;          ///< Cycles per microsecond
+      StageStats _stats[STAGE_COUNT]; ///< Timings of each stage
+    };
+
+  } // namespace core
+} // namespace stewy
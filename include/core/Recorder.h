@@ -0,0 +1,325 @@
+#pragma once
+/**
+ * @file Recorder.h
+ * @brief Record of the raw inputs and task runs of the control loop, in a RAM ring buffer
+ *
+ * This file contains a compact recorder of what the control loop reads and
+ * when: the raw touchscreen samples, the Nunchuck frames, and the runs of
+ * the ball controller, the pose solve and the pose estimate, each with its
+ * time in microseconds. The `record` command streams the buffer out over
+ * serial, and tools/Replay feeds it back through the firmware on the host,
+ * to reproduce what happened on the rig.
+ *
+ * Each entry takes 8 bytes: the time since the previous entry, the type,
+ * and the raw values. The loop makes about 500 entries per second. The
+ * buffer is supplied by the caller; when it is full, the oldest entries
+ * are overwritten, so it always holds the last moments before recording
+ * stopped. It has no Arduino dependencies.
+ *
+ * The inputs alone only reproduce a run from the state they were recorded
+ * from. So the loop also records keyframes: its state (PID integrators,
+ * touch filter, interpolator, pending pose requests, Nunchuck mode and
+ * setpoint, geometry) when recording starts, every so often after, and
+ * after a shell command changes it behind the inputs' back. A keyframe is
+ * a RECORD_KEYFRAME entry followed by its states, each a RECORD_STATE entry
+ * and its bytes, five to a RECORD_DATA entry. The states are copied as
+ * bytes, so they only hold fixed-size fields, laid out alike on the Teensy
+ * and on the host. The replay starts from the oldest keyframe left in the
+ * buffer.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @enum RecordType
+     * @brief What an entry of the record holds
+     */
+    enum RecordType
+    {
+      RECORD_TIME,         ///< Time of the following entries, after a gap too long for a delta (a: high, b: low 16 bits)
+      RECORD_TOUCH,        ///< Touchscreen sample (a: x, b: y, flags: z, saturated at 255)
+      RECORD_NUNCHUCK,     ///< Nunchuck read (a: joystick X, b: joystick Y, flags: RECORD_NUNCHUCK_* bits)
+      RECORD_BALL_CONTROL, ///< Run of the ball controller
+      RECORD_CONTROL,      ///< Run of the pose solve and servo update (a: high, b: low 16 bits of the checksum of the servo setpoints)
+      RECORD_ESTIMATE,     ///< Run of the pose estimate
+      RECORD_KEYFRAME,     ///< State of the loop follows (a: number of states, flags: RecordKeyframeReason)
+      RECORD_STATE,        ///< One state of a keyframe, its bytes follow (a: size in bytes, flags: RecordState)
+      RECORD_DATA,         ///< Next RECORD_DATA_BYTES bytes of a state (flags, then a and b, little-endian)
+      RECORD_TYPE_COUNT    ///< Number of types
+    };
+
+    /**
+     * @enum RecordKeyframeReason
+     * @brief Why a keyframe was recorded
+     */
+    enum RecordKeyframeReason
+    {
+      RECORD_KEYFRAME_START,    ///< Recording started
+      RECORD_KEYFRAME_PERIODIC, ///< The keyframe interval passed
+      RECORD_KEYFRAME_CHANGE    ///< A shell command changed the state of the loop (geometry, gains, pose, servos)
+    };
+
+    /**
+     * @enum RecordState
+     * @brief The states of a keyframe, each one the bytes of a struct
+     */
+    enum RecordState
+    {
+      RECORD_STATE_LOOP,     ///< RecordLoopState
+      RECORD_STATE_GEOMETRY, ///< GeometryRecord of the platform geometry
+      RECORD_STATE_PLATFORM, ///< PlatformState
+      RECORD_STATE_ARBITER,  ///< PoseArbiterState
+      RECORD_STATE_TOUCH,    ///< drivers::TouchState
+      RECORD_STATE_NUNCHUCK, ///< drivers::NunchuckDriverState
+      RECORD_STATE_COUNT     ///< Number of states
+    };
+
+    /**
+     * @struct RecordLoopState
+     * @brief What the loop itself holds between its tasks
+     */
+    struct RecordLoopState
+    {
+      float servoValues[6]; ///< Servo setpoints of the last pose solve, in degrees
+      float setpointX;      ///< Ball setpoint from the Nunchuck, normalized (-1.0 to 1.0)
+      float setpointY;      ///< Ball setpoint from the Nunchuck, normalized (-1.0 to 1.0)
+      uint32_t ms;          ///< millis() at the keyframe
+    };
+
+    const uint8_t RECORD_NUNCHUCK_Z = 0x01;  ///< Z button pressed
+    const uint8_t RECORD_NUNCHUCK_C = 0x02;  ///< C button pressed
+    const uint8_t RECORD_NUNCHUCK_OK = 0x04; ///< The read succeeded (otherwise the other fields are those of the last read)
+
+    const int RECORD_ENTRY_BYTES = 8;                  ///< Size of an encoded entry
+    const int RECORD_DATA_BYTES = 5;                   ///< Bytes of a state in a RECORD_DATA entry
+    const uint32_t RECORD_CHECKSUM_SEED = 2166136261u; ///< Initial value of Recorder::checksum()
+
+    /**
+     * @struct RecordEntry
+     * @brief One entry of the record
+     */
+    struct RecordEntry
+    {
+      uint16_t deltaUs; ///< Microseconds since the previous entry
+      uint8_t type;     ///< RecordType
+      uint8_t flags;    ///< Small value, depending on the type
+      int16_t a;        ///< First value, depending on the type
+      int16_t b;        ///< Second value, depending on the type
+    };
+
+    /**
+     * @class Recorder
+     * @brief Records the inputs and task runs of the loop in a ring buffer
+     *
+     * Entries are made from the loop only; the Recorder is not interrupt
+     * safe. Times are those of micros(), and may wrap around.
+     */
+    class Recorder
+    {
+    public:
+      /**
+       * @brief Construct a new Recorder, stopped
+       *
+       * @param buffer Entries, kept by reference
+       * @param capacity Number of entries in the buffer
+       * @param keyframeIntervalUs Time between keyframes, in microseconds, 0 for a keyframe at start() only
+       */
+      Recorder(RecordEntry *buffer, int capacity, uint32_t keyframeIntervalUs = 0);
+
+      /**
+       * @brief Clear the record, and start recording, from a keyframe
+       */
+      void start();
+
+      /**
+       * @brief Stop recording, and keep the record
+       */
+      void stop();
+
+      /**
+       * @brief Check if entries are being recorded
+       *
+       * @return true between start() and stop()
+       */
+      bool isRecording() const;
+
+      /**
+       * @brief Record an entry, if recording
+       *
+       * @param type What happened
+       * @param timeUs When, in microseconds
+       * @param a First value
+       * @param b Second value
+       * @param flags Small value
+       */
+      void record(RecordType type, uint32_t timeUs, int16_t a = 0, int16_t b = 0, uint8_t flags = 0);
+
+      /**
+       * @brief Ask for a keyframe, at the next isKeyframeDue()
+       *
+       * @param reason Why, recorded with the keyframe
+       */
+      void requestKeyframe(RecordKeyframeReason reason);
+
+      /**
+       * @brief Check if the loop should record a keyframe
+       *
+       * A keyframe the loop cannot record yet stays due, until it records one.
+       *
+       * @param timeUs Current time, in microseconds
+       * @return true if recording, and a keyframe was asked for or the interval has passed since the last one
+       */
+      bool isKeyframeDue(uint32_t timeUs) const;
+
+      /**
+       * @brief Start a keyframe: its states follow, with recordState()
+       *
+       * @param timeUs When, in microseconds
+       * @param states Number of recordState() calls that follow
+       */
+      void recordKeyframe(uint32_t timeUs, int states);
+
+      /**
+       * @brief Record one state of a keyframe, as bytes
+       *
+       * @param state Which state
+       * @param timeUs When, in microseconds, that of the keyframe
+       * @param data The struct of the state
+       * @param size Its size in bytes
+       */
+      void recordState(RecordState state, uint32_t timeUs, const void *data, uint16_t size);
+
+      /**
+       * @brief Get the number of entries held
+       *
+       * @return int Entries, up to the capacity
+       */
+      int getCount() const;
+
+      /**
+       * @brief Get the number of entries the buffer holds
+       *
+       * @return int Capacity
+       */
+      int getCapacity() const;
+
+      /**
+       * @brief Get the number of entries overwritten since start()
+       *
+       * @return unsigned long Entries lost
+       */
+      unsigned long getOverwritten() const;
+
+      /**
+       * @brief Get an entry
+       *
+       * The delta of the oldest entry is meaningless: its time is getFirstTime().
+       *
+       * @param index Entry, from 0 for the oldest
+       * @return const RecordEntry& The entry
+       */
+      const RecordEntry &getEntry(int index) const;
+
+      /**
+       * @brief Get the time of the oldest entry
+       *
+       * @return uint32_t Microseconds
+       */
+      uint32_t getFirstTime() const;
+
+      /**
+       * @brief Get the time of the latest entry
+       *
+       * @return uint32_t Microseconds
+       */
+      uint32_t getLastTime() const;
+
+      /**
+       * @brief Encode an entry, little-endian
+       *
+       * @param entry Entry
+       * @param bytes RECORD_ENTRY_BYTES bytes
+       */
+      static void encode(const RecordEntry &entry, uint8_t *bytes);
+
+      /**
+       * @brief Decode an entry encoded by encode()
+       *
+       * @param bytes RECORD_ENTRY_BYTES bytes
+       * @param entry Entry
+       */
+      static void decode(const uint8_t *bytes, RecordEntry &entry);
+
+      /**
+       * @brief Add bytes to a checksum of a record (FNV-1a)
+       *
+       * @param hash Checksum so far, RECORD_CHECKSUM_SEED to begin with
+       * @param bytes Bytes
+       * @param size Number of bytes
+       * @return uint32_t Checksum
+       */
+      static uint32_t checksum(uint32_t hash, const uint8_t *bytes, size_t size);
+
+      /**
+       * @brief Get the name of an entry type
+       *
+       * @param type Type
+       * @return const char* Name, for reports
+       */
+      static const char *getTypeString(RecordType type);
+
+      /**
+       * @brief Get the name of a keyframe reason
+       *
+       * @param reason Reason
+       * @return const char* Name, for reports
+       */
+      static const char *getKeyframeReasonString(RecordKeyframeReason reason);
+
+    private:
+      /**
+       * @brief Append an entry, overwriting the oldest if the buffer is full
+       *
+       * @param entry Entry
+       */
+      void append(const RecordEntry &entry);
+
+      RecordEntry *_buffer;         ///< Entries
+      int _capacity;                ///< Entries in the buffer
+      int _oldest;                  ///< Index of the oldest entry
+      int _count;                   ///< Entries held
+      unsigned long _overwritten;   ///< Entries lost since start()
+      uint32_t _firstUs;            ///< Time of the oldest entry
+      uint32_t _lastUs;             ///< Time of the latest entry
+      bool _recording;              ///< Between start() and stop()
+      uint32_t _keyframeIntervalUs; ///< Time between keyframes, 0 for none but the first
+      uint32_t _keyframeUs;         ///< Time of the last keyframe
+      bool _keyframeRequested;      ///< Whether a keyframe was asked for since the last one
+      uint8_t _keyframeReason;      ///< RecordKeyframeReason of the next keyframe
+    };
+
+  } // namespace core
+} // namespace stewy
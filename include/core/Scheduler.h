@@ -0,0 +1,150 @@
+#pragma once
+/**
+ * @file Scheduler.h
+ * @brief Multi-rate cooperative scheduler for the control loop
+ *
+ * This file contains the scheduler that runs the subsystems of loop() from
+ * a static table of tasks, each at its own period and phase, against a
+ * microsecond clock. It has no Arduino dependencies, so it can be used in
+ * host-side tools, against a virtual clock; the clock and the way to wait
+ * for the next deadline are supplied by the caller (micros(), and a busy
+ * wait or WFI on the Teensy).
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    const int SCHEDULER_MAX_TASKS = 8; ///< Largest number of tasks in a table
+
+    /**
+     * @struct SchedulerTask
+     * @brief One entry of the task table
+     */
+    struct SchedulerTask
+    {
+      const char *name;  ///< Name, for reports
+      void (*run)();     ///< Runs the task once
+      uint32_t periodUs; ///< Period in microseconds, 0 for a background task
+      uint32_t phaseUs;  ///< First release, in microseconds after begin()
+      uint8_t priority;  ///< Among the tasks due, the highest priority runs first
+    };
+
+    /**
+     * @struct TaskStats
+     * @brief Timing counters of one task, since begin() or resetStats()
+     */
+    struct TaskStats
+    {
+      unsigned long runs;     ///< Times the task ran
+      unsigned long overruns; ///< Releases skipped, because the task had not started before the next one
+      uint32_t maxLatencyUs;  ///< Longest time from a release to the start of the task
+      uint32_t maxRunUs;      ///< Longest run
+    };
+
+    /**
+     * @class Scheduler
+     * @brief Runs a static table of periodic and background tasks
+     *
+     * Each periodic task is released every periodUs, from phaseUs after
+     * begin(), on a fixed time grid: a late start does not shift the
+     * following releases. Tasks are not preempted. On each pass, the highest
+     * priority task due runs (the earliest released, between equal
+     * priorities). When none is due, each background task runs once, then
+     * the scheduler waits for the next release.
+     *
+     * A task that has not started by its next release has overrun: the
+     * releases it missed are counted and skipped, so it runs once, and
+     * stays on its grid.
+     *
+     * Timestamps come from the clock in microseconds, and may wrap around.
+     */
+    class Scheduler
+    {
+    public:
+      /**
+       * @brief Construct a new Scheduler
+       *
+       * @param tasks Task table, kept by reference; only the first SCHEDULER_MAX_TASKS are used
+       * @param count Number of tasks in the table
+       * @param clock Returns the time in microseconds (micros())
+       * @param idle Waits until a time in microseconds, or returns early; nullptr to spin on the clock
+       */
+      Scheduler(const SchedulerTask *tasks, int count, uint32_t (*clock)(), void (*idle)(uint32_t untilUs));
+
+      /**
+       * @brief Release the periodic tasks, each phaseUs from now, and reset the counters
+       */
+      void begin();
+
+      /**
+       * @brief Run one task due, or the background tasks and wait for the next release
+       *
+       * Call from loop(), again and again.
+       */
+      void runOnce();
+
+      /**
+       * @brief Get the number of tasks
+       *
+       * @return int Number of tasks in the table
+       */
+      int getTaskCount() const;
+
+      /**
+       * @brief Get a task
+       *
+       * @param task Task index, in the table
+       * @return const SchedulerTask& Task entry
+       */
+      const SchedulerTask &getTask(int task) const;
+
+      /**
+       * @brief Get the counters of a task
+       *
+       * @param task Task index, in the table
+       * @return const TaskStats& Counters of the task
+       */
+      const TaskStats &getStats(int task) const;
+
+      /**
+       * @brief Reset the counters of all tasks
+       */
+      void resetStats();
+
+    private:
+      const SchedulerTask *_tasks;            ///< Task table
+      int _count;                             ///< Number of tasks
+      uint32_t (*_clock)();                   ///< Time in microseconds
+      void (*_idle)(uint32_t untilUs);        ///< Waits for a time
+      uint32_t _release[SCHEDULER_MAX_TASKS]; ///< Next release of each periodic task
+      TaskStats _stats[SCHEDULER_MAX_TASKS];  ///< Counters of each task
+
+      /**
+       * @brief Run a task and time it
+       */
+      void run(int task);
+    };
+
+  } // namespace core
+} // namespace stewy
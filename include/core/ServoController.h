@@ -0,0 +1,144 @@
+#pragma once
+/**
+ * @file ServoController.h
+ * @brief Servo updates driven by a periodic timer, decoupled from the main loop
+ *
+ * This file contains the servo update that runs from a timer interrupt
+ * (IntervalTimer on the Teensy): it advances the servo motion profiles and
+ * writes the pulse widths at a fixed rate, whatever the main loop is doing.
+ * It has no Arduino dependencies, so it can be used in host-side tools,
+ * driven by a simulated timer; starting the timer and writing the pulses
+ * are up to the caller.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <atomic>
+#include "core/ServoOutput.h"
+#include "core/ServoProfile.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @brief Writes a pulse width to a servo
+     *
+     * @param servo Servo index (0-5)
+     * @param us Pulse width in microseconds
+     */
+    typedef void (*ServoWriter)(int servo, uint16_t us);
+
+    /**
+     * @struct ServoControllerStats
+     * @brief Counters of the servo update, since begin()
+     */
+    struct ServoControllerStats
+    {
+      unsigned long ticks;   ///< Timer ticks
+      unsigned long targets; ///< Sets of targets taken over from the control loop
+      unsigned long writes;  ///< Pulse widths written (only those that changed)
+    };
+
+    /**
+     * @class ServoController
+     * @brief Advances the servo profiles and writes the servos from a timer tick
+     *
+     * The control loop and the timer share two kinds of data, each in one
+     * direction, and neither side ever waits for the other:
+     * - targets, from the loop to the timer, through a double buffer: the
+     *   loop fills the slot the timer is not reading, then publishes it
+     *   with a single atomic store. The timer always reads a complete set,
+     *   the latest published.
+     * - positions, from the timer to the loop, behind a sequence counter:
+     *   the loop copies them, and copies again if a tick ran meanwhile.
+     *
+     * Both rely on the timer tick running to completion without the loop
+     * running in between, as an interrupt on a single core does. tick() is
+     * the only function to call from the interrupt.
+     */
+    class ServoController
+    {
+    public:
+      /**
+       * @brief Construct a new ServoController
+       *
+       * @param output Angle to pulse width mapping of the servos
+       * @param writer Called from tick() for each pulse width that changed
+       * @param profile Motion profile of each servo, copied; nullptr to move the servos straight to their targets
+       */
+      ServoController(const ServoOutput &output, ServoWriter writer, const ServoProfile *profile);
+
+      /**
+       * @brief Put the servos at rest at given angles
+       *
+       * Call before the timer starts, or with it stopped.
+       *
+       * @param angles Array of 6 angles in degrees, also the targets
+       * @param nowUs Current time, in microseconds
+       */
+      void begin(const float *angles, uint32_t nowUs);
+
+      /**
+       * @brief Hand new targets to the timer (control loop side)
+       *
+       * @param angles Array of 6 target angles in degrees
+       */
+      void setTargets(const float *angles);
+
+      /**
+       * @brief Advance the profiles and write the servos (timer side)
+       *
+       * @param nowUs Current time, in microseconds
+       */
+      void tick(uint32_t nowUs);
+
+      /**
+       * @brief Get the angles of the last tick (control loop side)
+       *
+       * @param angles Array of 6 floats that receives the angles in degrees
+       */
+      void getPositions(float *angles) const;
+
+      /**
+       * @brief Get the counters
+       *
+       * @return ServoControllerStats Copy of the counters, consistent with each other
+       */
+      ServoControllerStats getStats() const;
+
+    private:
+      ServoOutput _output;       ///< Pulse width mapping, and the pulse widths written
+      ServoWriter _writer;       ///< Writes a pulse width
+      bool _profiled;            ///< Whether the servos follow _profiles
+      ServoProfile _profiles[6]; ///< Motion of each servo
+
+      float _targets[2][6];                  ///< Double buffer of targets
+      std::atomic<uint8_t> _published;       ///< Slot of _targets the timer reads
+      std::atomic<uint32_t> _targetSequence; ///< Number of sets of targets published
+      uint32_t _takenSequence;               ///< Last set of targets taken over by the timer
+
+      float _positions[6];                     ///< Angles of the last tick
+      ServoControllerStats _stats;             ///< Counters, updated by the timer
+      std::atomic<uint32_t> _positionSequence; ///< Number of ticks that updated _positions and _stats
+    };
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,105 @@
+#pragma once
+/**
+ * @file ServoOutput.h
+ * @brief Servo angle to pulse width mapping, in fixed point
+ *
+ * This file contains the output stage between the servo angles and the
+ * pulse widths written to the servos. It has no Arduino dependencies, so it
+ * can be used in host-side tools; writing the pulses is up to the caller.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include "core/FixedPoint.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @class ServoOutput
+     * @brief Maps the angles of the six servos to pulse widths, and tracks what was written
+     *
+     * The range mapping, the reversal and the trim of each servo are folded
+     * into one Q16.16 scale and offset when the output is constructed, so a
+     * pulse width costs one multiply-add, a rounding and a clamp. The angle
+     * keeps its fractional part: at 0-360 degrees over 755-2250 us, a degree
+     * is about 4 us.
+     *
+     * The last pulse width of each servo is kept, so that a servo is only
+     * written when its pulse width changes.
+     */
+    class ServoOutput
+    {
+    public:
+      /**
+       * @brief Construct a new ServoOutput
+       *
+       * @param minAngle Angle of the shortest pulse, in degrees (SERVO_MIN_ANGLE)
+       * @param maxAngle Angle of the longest pulse, in degrees (SERVO_MAX_ANGLE)
+       * @param minUs Shortest pulse, in microseconds (SERVO_MIN_US)
+       * @param maxUs Longest pulse, in microseconds (SERVO_MAX_US)
+       * @param reverse Array of 6 flags, non-zero for a reversed servo (SERVO_REVERSE)
+       * @param trim Array of 6 trims, in microseconds, added after reversing (SERVO_TRIM)
+       */
+      ServoOutput(int minAngle, int maxAngle, int minUs, int maxUs, const int *reverse, const int *trim);
+
+      /**
+       * @brief Get the pulse width of a servo angle
+       *
+       * @param servo Servo index (0-5)
+       * @param angle Angle in degrees
+       * @return uint16_t Pulse width in microseconds, rounded, within [minUs, maxUs]
+       */
+      uint16_t toMicroseconds(int servo, float angle) const;
+
+      /**
+       * @brief Set the angle of a servo
+       *
+       * @param servo Servo index (0-5)
+       * @param angle Angle in degrees
+       * @return true if the pulse width changed, and must be written (see getMicroseconds())
+       * @return false if it is the one last written
+       */
+      bool update(int servo, float angle);
+
+      /**
+       * @brief Get the current pulse width of a servo
+       *
+       * @param servo Servo index (0-5)
+       * @return uint16_t Pulse width in microseconds, 0 before the first update
+       */
+      uint16_t getMicroseconds(int servo) const;
+
+      /**
+       * @brief Forget the pulse widths written, so that the next update of each servo writes it
+       */
+      void invalidate();
+
+    private:
+      Fixed16 _scale[6];  ///< Microseconds per degree, negative for a reversed servo
+      Fixed16 _offset[6]; ///< Microseconds at 0 degrees, trim included
+      int32_t _minRaw;    ///< Shortest pulse, in Q16.16
+      int32_t _maxRaw;    ///< Longest pulse, in Q16.16
+      uint16_t _pulse[6]; ///< Last pulse width of each servo
+    };
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,171 @@
+#pragma once
+/**
+ * @file ServoProfile.h
+ * @brief Time-based, jerk-limited motion of one servo
+ *
+ * This file contains the motion profile that updateServos() applies to each
+ * servo on its way to its setpoint. Limits are per second rather than per
+ * loop iteration, and the motion is a function of time only, so a loop that
+ * runs long moves the servos no faster or slower. It has no Arduino
+ * dependencies, so it can be used in host-side tools; the caller supplies
+ * the timestamps (micros()).
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    const uint32_t SERVO_PROFILE_STEP_US = 1000;  ///< Time step of the profile
+    const uint32_t SERVO_PROFILE_MAX_STEPS = 250; ///< Largest catch-up per update, beyond which the profile skips time
+
+    /**
+     * @class ServoProfile
+     * @brief Moves a servo angle towards a target with an S-curve profile
+     *
+     * The profile limits speed, acceleration and jerk. Jerk is constant
+     * over each SERVO_PROFILE_STEP_US step of a fixed time grid, and the
+     * angle, speed and acceleration are integrated exactly over it, so the
+     * motion is a piecewise cubic in time. Between grid points it is
+     * evaluated from the last one, so the angle returned at a given time is
+     * the same however often, and at whatever times, update() was called
+     * before.
+     *
+     * Each step takes the jerk that drives towards full speed, unless the
+     * servo could then no longer stop at the target within the acceleration
+     * and jerk limits, in which case it holds the acceleration or brakes.
+     * The servo arrives with no speed or acceleration left, without
+     * overshoot, and a target that moves mid-motion is followed without a
+     * jump in acceleration.
+     *
+     * Timestamps are in microseconds, and may wrap around. Angles are in
+     * degrees, speeds in degrees/s, accelerations in degrees/s^2 and jerks
+     * in degrees/s^3.
+     */
+    class ServoProfile
+    {
+    public:
+      /**
+       * @brief Construct a new ServoProfile, at rest at angle 0 and time 0
+       *
+       * @param maxSpeed Largest speed, in degrees/s
+       * @param maxAccel Largest acceleration, in degrees/s^2
+       * @param maxJerk Largest jerk, in degrees/s^3
+       */
+      ServoProfile(float maxSpeed, float maxAccel, float maxJerk);
+
+      /**
+       * @brief Jump to an angle, and stop there
+       *
+       * @param angle Angle in degrees, also the new target
+       * @param nowUs Current time, the start of the time grid
+       */
+      void reset(float angle, uint32_t nowUs);
+
+      /**
+       * @brief Set the angle to move to, from now on
+       *
+       * The motion up to nowUs is that towards the previous target.
+       *
+       * @param target Angle in degrees
+       * @param nowUs Current time
+       */
+      void setTarget(float target, uint32_t nowUs);
+
+      /**
+       * @brief Advance the motion
+       *
+       * After a gap of more than SERVO_PROFILE_MAX_STEPS steps (a stalled
+       * loop), the motion resumes from where the last of them left it,
+       * rather than catching up in one go.
+       *
+       * @param nowUs Current time, no earlier than that of the previous call
+       * @return float Angle at nowUs, in degrees
+       */
+      float update(uint32_t nowUs);
+
+      /**
+       * @brief Whether the target has been reached
+       *
+       * @return true if the angle is at the target, at rest
+       */
+      bool isSettled() const;
+
+      /**
+       * @brief Get the target
+       *
+       * @return float Target angle in degrees
+       */
+      float getTarget() const;
+
+      /**
+       * @brief Get the speed at the last grid point
+       *
+       * @return float Speed in degrees/s
+       */
+      float getSpeed() const;
+
+      /**
+       * @brief Get the acceleration at the last grid point
+       *
+       * @return float Acceleration in degrees/s^2
+       */
+      float getAcceleration() const;
+
+    private:
+      float _maxSpeed; ///< Largest speed
+      float _maxAccel; ///< Largest acceleration
+      float _maxJerk;  ///< Largest jerk
+
+      float _target;    ///< Angle to move to
+      float _angle;     ///< Angle at the last grid point
+      float _speed;     ///< Speed at the last grid point
+      float _accel;     ///< Acceleration at the last grid point
+      float _jerk;      ///< Jerk over the step that starts at the last grid point
+      uint32_t _gridUs; ///< Time of the last grid point
+
+      /**
+       * @brief Jerk for the step from the current state towards the target
+       */
+      float chooseJerk() const;
+
+      /**
+       * @brief Whether the servo can still stop at the target after a step with a given jerk
+       *
+       * @param distance Distance to the target, positive
+       * @param speed Speed towards the target
+       * @param accel Acceleration towards the target
+       * @param jerk Jerk towards the target
+       */
+      bool canStop(float distance, float speed, float accel, float jerk) const;
+
+      /**
+       * @brief Distance the servo covers in the quickest stop from a state
+       *
+       * @param speed Speed towards the target, positive
+       * @param accel Acceleration towards the target
+       */
+      float stoppingDistance(float speed, float accel) const;
+    };
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,160 @@
+#pragma once
+/**
+ * @file WorkspaceMap.h
+ * @brief Quantized workspace reachability map
+ *
+ * This file contains a constant-time reachability check of a pose, against
+ * a bitmap of the six-dimensional pose envelope that is generated offline by
+ * tools/WorkspaceMapGenerator. It has no Arduino dependencies, so it can be
+ * used in host-side tools.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include "core/IkKernel.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    /**
+     * @enum WorkspaceStatus
+     * @brief Reachability of a pose, as far as the map knows
+     *
+     * The values are the 2-bit cell codes of the bitmap.
+     */
+    enum WorkspaceStatus
+    {
+      WORKSPACE_UNKNOWN = 0,    ///< Partly reachable cell, outside the map, or map not verified: run the IK
+      WORKSPACE_REACHABLE = 1,  ///< Every sample of the cell was accepted by the IK
+      WORKSPACE_UNREACHABLE = 2 ///< No sample of the cell was accepted by the IK
+    };
+
+    /**
+     * @struct WorkspaceProbe
+     * @brief A pose with a known IK outcome, used to check the map against the geometry
+     */
+    struct WorkspaceProbe
+    {
+      float pose[6];  ///< Sway, surge, heave (mm), pitch, roll, yaw (degrees)
+      bool reachable; ///< Whether the IK accepted the pose when the map was generated
+    };
+
+    /**
+     * @struct WorkspaceMapLayout
+     * @brief A generated map (see WorkspaceMapData.cpp)
+     *
+     * The envelope [min, max] of each pose component is split into cells[i]
+     * equal cells. Cells are numbered with sway varying slowest and yaw
+     * fastest, and packed four per byte, lowest bits first.
+     */
+    struct WorkspaceMapLayout
+    {
+      uint8_t cells[6];             ///< Cells along each pose component
+      float min[6];                 ///< Lower bound of each pose component
+      float max[6];                 ///< Upper bound of each pose component
+      bool slam;                    ///< Whether SLAM was defined, i.e. IK_ASYMPTOTIC counted as accepted
+      const WorkspaceProbe *probes; ///< Probe poses
+      uint8_t probeCount;           ///< Number of probe poses
+      const uint8_t *bits;          ///< Packed 2-bit cell codes (WorkspaceStatus)
+    };
+
+    /**
+     * @brief The map generated for PlatformGeometry.h by tools/WorkspaceMapGenerator
+     */
+    extern const WorkspaceMapLayout WORKSPACE_MAP;
+
+    /**
+     * @class WorkspaceMap
+     * @brief Constant-time reachability check of a pose
+     *
+     * The generator solves the IK on a lattice several points finer than the
+     * cells, and marks a cell reachable or unreachable only if every lattice
+     * point in it (corners included) agrees. It is a sampled map, not a
+     * proof: a sliver of the workspace that falls between lattice points can
+     * be missed. The default lattice spacing is a few mm or degrees.
+     *
+     * The map is tied to the geometry it was generated for, so it answers
+     * WORKSPACE_UNKNOWN for every pose until verify() has re-solved its probe
+     * poses with the current kernel and found the same outcomes.
+     */
+    class WorkspaceMap
+    {
+    public:
+      /**
+       * @brief Construct a new WorkspaceMap
+       *
+       * @param layout Generated map
+       */
+      WorkspaceMap(const WorkspaceMapLayout &layout);
+
+      /**
+       * @brief Check the map against the current geometry
+       *
+       * Solves each probe pose and compares the outcome with the one
+       * recorded by the generator. Until this succeeds, query() answers
+       * WORKSPACE_UNKNOWN.
+       *
+       * @param kernel IK kernel of the platform
+       * @return true if every probe matched
+       * @return false if the map is stale, and has been disabled
+       */
+      bool verify(const IkKernel<ik_scalar_t> &kernel);
+
+      /**
+       * @brief Disable the map until the next verify()
+       */
+      void invalidate();
+
+      /**
+       * @brief Whether verify() still has to be called
+       *
+       * @return true if the map was never verified, or invalidated since
+       */
+      bool needsVerify() const;
+
+      /**
+       * @brief Look up the reachability of a pose
+       *
+       * @param pose Array of 6 floats: sway, surge, heave (mm), pitch, roll, yaw (degrees)
+       * @return WorkspaceStatus of the cell that contains the pose
+       */
+      WorkspaceStatus query(const float *pose) const;
+
+    private:
+      /**
+       * @enum State
+       * @brief Verification state of the map
+       */
+      enum State
+      {
+        UNVERIFIED, ///< verify() not called yet
+        VALID,      ///< Probes matched
+        STALE       ///< Probes did not match
+      };
+
+      const WorkspaceMapLayout &_layout; ///< Generated map
+      State _state;                      ///< Verification state
+      float _scale[6];                   ///< Cells per mm or degree, along each pose component
+      uint32_t _stride[6];               ///< Index distance between neighbouring cells, along each pose component
+    };
+
+  } // namespace core
+} // namespace stewy
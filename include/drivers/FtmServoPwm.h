@@ -0,0 +1,193 @@
+#pragma once
+/**
+ * @file FtmServoPwm.h
+ * @brief Servo pulses from the Teensy 3.x FlexTimer (FTM0) hardware PWM
+ *
+ * This file contains a servo output driver that generates the servo pulses
+ * with the FTM0 timer rather than the Servo library, at a frame rate of
+ * 50 to 333 Hz, for digital servos that accept frames faster than the
+ * standard 50 Hz. It only touches the timer through an FtmRegisters block,
+ * so on the host it can drive a plain struct that a simulated timer reads;
+ * on the Teensy, the block is FTM0 itself. Routing the pins to the timer
+ * (the port mux) is up to the caller.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace drivers
+  {
+
+    /**
+     * @struct FtmRegisters
+     * @brief Register block of a Kinetis K20 FlexTimer, in memory order
+     *
+     * Names follow the reference manual (FTMx_SC, FTMx_C0SC, ...). FTM0 of the
+     * Teensy 3.x is at 0x40038000, the address of FTM0_SC.
+     */
+    struct FtmRegisters
+    {
+      volatile uint32_t SC;  ///< Status and control (clock source, prescaler)
+      volatile uint32_t CNT; ///< Counter
+      volatile uint32_t MOD; ///< Modulo, the last count of a period
+      struct
+      {
+        volatile uint32_t SC; ///< Channel status and control (mode)
+        volatile uint32_t V;  ///< Channel value, the count at which the pulse ends
+      } C[8];
+      volatile uint32_t CNTIN;    ///< Counter initial value
+      volatile uint32_t STATUS;   ///< Capture and compare status
+      volatile uint32_t MODE;     ///< Features mode selection
+      volatile uint32_t SYNC;     ///< Synchronization
+      volatile uint32_t OUTINIT;  ///< Initial state of the channel outputs
+      volatile uint32_t OUTMASK;  ///< Output mask
+      volatile uint32_t COMBINE;  ///< Function of the channel pairs
+      volatile uint32_t DEADTIME; ///< Deadtime insertion
+      volatile uint32_t EXTTRIG;  ///< External trigger
+      volatile uint32_t POL;      ///< Channel polarity
+      volatile uint32_t FMS;      ///< Fault mode status
+      volatile uint32_t FILTER;   ///< Input capture filter
+      volatile uint32_t FLTCTRL;  ///< Fault control
+      volatile uint32_t QDCTRL;   ///< Quadrature decoder
+      volatile uint32_t CONF;     ///< Configuration
+      volatile uint32_t FLTPOL;   ///< Fault input polarity
+      volatile uint32_t SYNCONF;  ///< Synchronization configuration
+      volatile uint32_t INVCTRL;  ///< Inverting control
+      volatile uint32_t SWOCTRL;  ///< Software output control
+      volatile uint32_t PWMLOAD;  ///< PWM load
+    };
+
+    /**
+     * Register bits used by FtmServoPwm, and by simulated timers on the host.
+     * Named without the FTM_ prefix of the Teensy core, whose macros would
+     * replace them.
+     */
+    namespace ftm
+    {
+      const uint32_t SC_CLKS_BUS = 1 << 3;       ///< SC: count the bus clock
+      const uint32_t SC_PS_MASK = 7;             ///< SC: prescaler, divides the clock by 2^PS
+      const uint32_t CSC_EDGE_PWM = 0x28;        ///< CnSC: edge-aligned PWM, high from the start of the period to CnV (MSB, ELSB)
+      const uint32_t MODE_FTMEN = 1 << 0;        ///< MODE: FTM features, needed for buffered, synchronized updates
+      const uint32_t MODE_WPDIS = 1 << 2;        ///< MODE: write protection disabled
+      const uint32_t SYNC_CNTMAX = 1 << 1;       ///< SYNC: load the buffered values at the end of a period
+      const uint32_t SYNC_SWSYNC = 1 << 7;       ///< SYNC: software trigger, cleared once the values are loaded
+      const uint32_t COMBINE_SYNCEN = 0x20202020; ///< COMBINE: synchronized CnV updates, on the four channel pairs
+      const uint32_t SYNCONF_SYNCMODE = 1 << 7;  ///< SYNCONF: enhanced synchronization
+      const uint32_t SYNCONF_SWWRBUF = 1 << 8;   ///< SYNCONF: the software trigger loads MOD, CNTIN and CnV
+    } // namespace ftm
+
+    const uint16_t SERVO_PWM_MIN_FRAME_HZ = 50;    ///< Lowest frame rate, that of analog servos
+    const uint16_t SERVO_PWM_MAX_FRAME_HZ = 333;   ///< Highest frame rate, about 3 ms frames for 2.25 ms pulses
+    const uint32_t SERVO_PWM_FLUSH_GUARD_US = 100; ///< Time before the end of a frame from which a pending flush() can no longer be replaced
+
+    /**
+     * @class FtmServoPwm
+     * @brief Generates the pulses of six servos on FTM0 channels
+     *
+     * The timer counts the bus clock, divided by the smallest prescaler that
+     * fits a frame in its 16 bits: 3 counts per microsecond at 50 Hz, and 12
+     * at 333 Hz, with a 48 MHz bus. Each servo pin is an edge-aligned PWM
+     * channel, high from the start of the frame to its pulse width.
+     *
+     * write() only updates the buffered pulse widths. flush() hands them to
+     * the timer, which loads all of them at once at the end of the current
+     * frame, so no pulse is ever cut short or stretched, and all six servos
+     * see their new pulses in the same frame. A flush() before that load
+     * replaces the pulses handed over, unless the frame is about to end
+     * (SERVO_PWM_FLUSH_GUARD_US), in which case the new pulses stay pending
+     * for the next flush(). The writes of a flush() take well under a
+     * microsecond, so the guard leaves room for it to be interrupted.
+     *
+     * The driver takes over the whole timer: the other FTM0 pins no longer
+     * work with analogWrite().
+     */
+    class FtmServoPwm
+    {
+    public:
+      /**
+       * @brief Construct a new FtmServoPwm
+       *
+       * @param ftm Timer registers (FTM0 on the Teensy, a simulated block on the host)
+       * @param busHz Clock of the timer, in Hz (F_BUS)
+       */
+      FtmServoPwm(FtmRegisters &ftm, uint32_t busHz);
+
+      /**
+       * @brief Get the FTM0 channel of a Teensy 3.x pin
+       *
+       * @param pin Teensy pin number
+       * @return int Channel (0-7), or -1 if the pin has none
+       */
+      static int channelOf(int pin);
+
+      /**
+       * @brief Set the timer up, with all pulses off
+       *
+       * @param pins Array of 6 Teensy pins, each on an FTM0 channel (SERVO_PINS)
+       * @param frameHz Frame rate, from SERVO_PWM_MIN_FRAME_HZ to SERVO_PWM_MAX_FRAME_HZ
+       * @return true if the timer runs
+       * @return false if a pin has no FTM0 channel, or the frame rate is out of range
+       */
+      bool begin(const int *pins, uint16_t frameHz);
+
+      /**
+       * @brief Set the pulse width of a servo, from the next flush()
+       *
+       * @param servo Servo index (0-5)
+       * @param us Pulse width in microseconds, 0 for no pulse
+       */
+      void write(int servo, uint16_t us);
+
+      /**
+       * @brief Hand the pulse widths written to the timer, for the next frame
+       *
+       * @return true if there was nothing pending, or it was handed over
+       * @return false if the frame is about to load the previous ones; they stay pending
+       */
+      bool flush();
+
+      /**
+       * @brief Get the length of a frame
+       *
+       * @return uint32_t Frame length in timer counts, 0 before begin()
+       */
+      uint32_t getFrameCounts() const;
+
+      /**
+       * @brief Get the timer counts per microsecond
+       *
+       * @return float Counts per microsecond, the resolution of the pulses
+       */
+      float getCountsPerMicrosecond() const;
+
+    private:
+      FtmRegisters &_ftm;    ///< Timer registers
+      uint32_t _busHz;       ///< Clock of the timer
+      uint8_t _channel[6];   ///< FTM0 channel of each servo
+      uint32_t _countsPerUs; ///< Timer counts per microsecond, in Q16.16
+      uint32_t _frameCounts; ///< Timer counts per frame
+      uint32_t _guardCounts; ///< SERVO_PWM_FLUSH_GUARD_US, in timer counts
+      uint32_t _pending[6];  ///< Channel values of the pulse widths written
+      bool _dirty;           ///< Whether _pending changed since the last flush() that went through
+    };
+
+  } // namespace drivers
+} // namespace stewy
@@ -24,9 +24,11 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <WiiChuck.h> // https://github.com/madhephaestus/WiiChuck.git
-#include <Blinker.h>  // Blinker for LED indication
+#include <Blinker.h> // Blinker for LED indication
 #include "core/Config.h"
+#include "core/PoseArbiter.h"
+#include "core/Recorder.h"
+#include "hal/NunchuckBus.h"
 
 namespace stewy
 {
@@ -79,6 +81,27 @@ namespace stewy
       CCW ///< Counter-clockwise movement
     };
 
+    /**
+     * @struct NunchuckDriverState
+     * @brief Mode and setpoint of the Nunchuck driver, for a record keyframe
+     *
+     * Fixed-size fields only, so that the bytes read the same on the Teensy
+     * and on the host (see Recorder.h): the enums are kept as bytes.
+     */
+    struct NunchuckDriverState
+    {
+      hal::NunchuckState state; ///< Joystick and buttons, as last read
+      uint8_t mode;             ///< ControlMode
+      uint8_t subMode;          ///< ControlSubMode
+      uint8_t direction;        ///< Direction
+      bool zPressed;            ///< Whether the Z button is pressed
+      bool cPressed;            ///< Whether the C button is pressed
+      float speed;              ///< Movement speed for CIRCLE and EIGHT modes
+      float radius;             ///< Circle radius for CIRCLE mode
+      uint32_t lastButtonTime;  ///< millis() of the last button press
+      core::xy_coordf setpoint; ///< Current setpoint position
+    };
+
     /**
      * @class NunchuckDriver
      * @brief Driver for Wii Nunchuck controller
@@ -91,10 +114,10 @@ namespace stewy
     class NunchuckDriver
     {
     private:
-      Accessory *nunchuck;    ///< Pointer to the Nunchuck accessory object
-      ControlMode mode;       ///< Current control mode
-      ControlSubMode subMode; ///< Current sub-mode (for CONTROL mode)
-      Direction direction;    ///< Current movement direction (for CIRCLE, EIGHT modes)
+      hal::NunchuckState state; ///< Joystick and buttons, as last read from the Nunchuck
+      ControlMode mode;         ///< Current control mode
+      ControlSubMode subMode;   ///< Current sub-mode (for CONTROL mode)
+      Direction direction;      ///< Current movement direction (for CIRCLE, EIGHT modes)
 
       float speed;  ///< Movement speed for CIRCLE and EIGHT modes
       float radius; ///< Circle radius for CIRCLE mode
@@ -106,6 +129,8 @@ namespace stewy
       core::xy_coordf deadBand; ///< Joystick deadband to prevent drift
       core::xy_coordf setpoint; ///< Current setpoint position
 
+      core::Recorder *recorder; ///< Records the reads, if not nullptr
+
     public:
       /**
        * @brief Construct a new NunchuckDriver object
@@ -123,7 +148,7 @@ namespace stewy
       /**
        * @brief Destructor for NunchuckDriver
        *
-       * Properly cleans up dynamically allocated objects (Accessory).
+       * Nothing to release: the Nunchuck itself belongs to the HAL.
        */
       ~NunchuckDriver();
 
@@ -140,15 +165,36 @@ namespace stewy
        *
        * Reads input from the Nunchuck, handles button presses,
        * updates the setpoint based on the current mode, and
-       * applies platform movements accordingly.
+       * requests platform movements accordingly.
        *
-       * @param servoValues Pointer to an array of 6 floats where servo values will be updated
+       * @param arbiter Pose arbiter that receives the platform movement requests
        * @return core::xy_coordf Current setpoint position (-1.0 to 1.0 in both axes)
        *
        * @note In SETPOINT mode, the touchscreen driver uses the returned setpoint to control the platform.
-       * @note In CONTROL mode, this method directly updates the servo values based on joystick input.
+       * @note In CONTROL mode, this method submits a pose from the joystick input, with PRIORITY_NUNCHUCK.
+       */
+      core::xy_coordf process(core::PoseArbiter &arbiter);
+
+      /**
+       * @brief Record the reads, as RECORD_NUNCHUCK entries
+       *
+       * @param recorder Recorder of the loop, or nullptr to stop recording the reads
+       */
+      void setRecorder(core::Recorder *recorder);
+
+      /**
+       * @brief Get the mode and the setpoint, for a record keyframe
+       *
+       * @param state Receives the state
+       */
+      void getState(NunchuckDriverState &state) const;
+
+      /**
+       * @brief Restore the mode and the setpoint of getState()
+       *
+       * @param state State
        */
-      core::xy_coordf process(float *servoValues);
+      void setState(const NunchuckDriverState &state);
 
       /**
        * @brief Get current control mode
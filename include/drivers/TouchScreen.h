@@ -24,10 +24,13 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <TouchScreen.h> // from https://github.com/adafruit/Touch-Screen-Library
-#include <PID_v1.h>      // https://github.com/br3ttb/Arduino-PID-Library
-#include <EEPROM.h>      // for storing calibration data
+#include <PID_v1.h> // https://github.com/br3ttb/Arduino-PID-Library
 #include "core/Config.h"
+#include "core/PoseArbiter.h"
+#include "core/Profiler.h"
+#include "core/Recorder.h"
+#include "hal/Store.h"    // for storing calibration data
+#include "hal/TouchAdc.h" // the resistive touchscreen
 
 namespace stewy
 {
@@ -112,6 +115,46 @@ namespace stewy
       bool isCalibrated; ///< Flag indicating if calibration has been performed
     };
 
+    /**
+     * @struct TouchPidState
+     * @brief State of one PID controller of the ball, for a record keyframe
+     */
+    struct TouchPidState
+    {
+      double p;         ///< Proportional gain
+      double i;         ///< Integral gain
+      double d;         ///< Derivative gain
+      double outputSum; ///< Integral term, as the PID library keeps it
+      double lastInput; ///< Input of the last compute, for the derivative
+      uint32_t lastMs;  ///< millis() of the last compute
+      bool computed;    ///< Whether it computed since init(); if not, lastMs is unused
+    };
+
+    /**
+     * @struct TouchState
+     * @brief State of the ball controller, for a record keyframe
+     *
+     * Fixed-size fields only, so that the bytes read the same on the Teensy
+     * and on the host (see Recorder.h).
+     */
+    struct TouchState
+    {
+      TouchCalibration calibration; ///< Calibration in use
+      TouchFilter filter;           ///< Window of the moving average
+      double inputX;                ///< X input to the PID controller
+      double inputY;                ///< Y input to the PID controller
+      double outputX;               ///< Roll output of the PID controller
+      double outputY;               ///< Pitch output of the PID controller
+      double setpointX;             ///< X setpoint of the PID controller
+      double setpointY;             ///< Y setpoint of the PID controller
+      float lastInputX;             ///< Last raw X position detected, for the deadzone
+      float lastInputY;             ///< Last raw Y position detected, for the deadzone
+      bool touched;                 ///< Whether the last sample detected the ball
+      uint32_t ballLastSeen;        ///< millis() when the ball was last detected
+      TouchPidState roll;           ///< Roll (X axis) PID controller
+      TouchPidState pitch;          ///< Pitch (Y axis) PID controller
+    };
+
     /**
      * @class TouchScreenDriver
      * @brief Driver for the touchscreen
@@ -124,7 +167,6 @@ namespace stewy
     class TouchScreenDriver
     {
     private:
-      TouchScreen *ts;              ///< Pointer to the TouchScreen hardware interface
       TouchFilter filter;           ///< Filter for smoothing touchscreen input
       TouchCalibration calibration; ///< Calibration data for the touchscreen
       PID *rollPID;                 ///< PID controller for roll (X axis)
@@ -136,6 +178,15 @@ namespace stewy
       double outputY;   ///< Pitch output from the PID controller
       double setpointX; ///< Target X position for the PID controller
       double setpointY; ///< Target Y position for the PID controller
+      bool touched;     ///< Whether the last sample detected the ball
+      float lastInputX; ///< Last raw X position detected, for the deadzone
+      float lastInputY; ///< Last raw Y position detected, for the deadzone
+
+      TouchPidState rollState;  ///< What the roll PID library keeps to itself: input and time of its last compute
+      TouchPidState pitchState; ///< What the pitch PID library keeps to itself: input and time of its last compute
+
+      core::Profiler *profiler; ///< Times the read, filter and PID stages, if not nullptr
+      core::Recorder *recorder; ///< Records the raw samples, if not nullptr
 
       unsigned long ballLastSeen;                                         ///< Timestamp when the ball was last detected
       bool isCalibrating;                                                 ///< Flag indicating if calibration is in progress
@@ -149,7 +200,7 @@ namespace stewy
        * @brief Construct a new TouchScreenDriver object
        *
        * Initializes the touchscreen driver with the specified pin configuration.
-       * Creates the TouchScreen and PID controller objects.
+       * Starts the touchscreen HAL, and creates the PID controller objects.
        *
        * @param xp X+ pin number
        * @param yp Y+ pin number
@@ -162,7 +213,7 @@ namespace stewy
       /**
        * @brief Destructor for TouchScreenDriver
        *
-       * Properly cleans up dynamically allocated objects (TouchScreen and PID controllers).
+       * Properly cleans up dynamically allocated objects (PID controllers).
        */
       ~TouchScreenDriver();
 
@@ -176,22 +227,54 @@ namespace stewy
       void init();
 
       /**
-       * @brief Process touchscreen input
+       * @brief Time the touch read, filter and PID stages
+       *
+       * @param profiler Profiler that records the stages, or nullptr to stop timing them
+       */
+      void setProfiler(core::Profiler *profiler);
+
+      /**
+       * @brief Record the raw samples, as RECORD_TOUCH entries
+       *
+       * @param recorder Recorder of the loop, or nullptr to stop recording the samples
+       */
+      void setRecorder(core::Recorder *recorder);
+
+      /**
+       * @brief Sample the touchscreen
        *
-       * Reads the current ball position from the touchscreen, applies filtering,
-       * and uses PID control to calculate platform adjustments to move the ball
-       * toward the setpoint. Updates the servo values accordingly.
+       * Reads the current ball position from the touchscreen, and adds it to
+       * the filter, or to the calibration in progress. Can run faster than
+       * control(), so that the filter averages more samples.
+       */
+      void sample();
+
+      /**
+       * @brief Run the ball controller on the filtered position
+       *
+       * Uses PID control to calculate platform adjustments to move the ball
+       * toward the setpoint. Submits the resulting pitch and roll to the arbiter,
+       * with PRIORITY_TOUCHSCREEN.
        *
        * If the ball is not detected for a certain period (LOST_BALL_TIMEOUT),
        * the platform returns to the home position.
        *
        * @param setpoint_x Normalized X setpoint (-1.0 to 1.0)
        * @param setpoint_y Normalized Y setpoint (-1.0 to 1.0)
-       * @param servoValues Array to store calculated servo values
+       * @param arbiter Pose arbiter that receives the platform movement requests
        *
        * @note This method does nothing if calibration is in progress or if the PID controllers are in manual mode.
        */
-      void process(float setpoint_x, float setpoint_y, float *servoValues);
+      void control(float setpoint_x, float setpoint_y, core::PoseArbiter &arbiter);
+
+      /**
+       * @brief Process touchscreen input: sample(), then control()
+       *
+       * @param setpoint_x Normalized X setpoint (-1.0 to 1.0)
+       * @param setpoint_y Normalized Y setpoint (-1.0 to 1.0)
+       * @param arbiter Pose arbiter that receives the platform movement requests
+       */
+      void process(float setpoint_x, float setpoint_y, core::PoseArbiter &arbiter);
 
       /**
        * @brief Start touchscreen calibration
@@ -242,6 +325,13 @@ namespace stewy
        */
       void getPID(char axis, double &p, double &i, double &d);
 
+      /**
+       * @brief Get the calibration in use
+       *
+       * @return const TouchCalibration& Calibrated area, or the defaults if not calibrated
+       */
+      const TouchCalibration &getCalibration() const;
+
       /**
        * @brief Reset PID controllers to default values
        *
@@ -254,6 +344,38 @@ namespace stewy
        */
       void resetPID();
 
+      /**
+       * @brief Get the state of the ball controller, for a record keyframe
+       *
+       * The PID library keeps its integral to itself: it is read by running
+       * a copy of each controller once, which needs a millisecond since its
+       * last compute.
+       *
+       * @param state Receives the state
+       * @return true if the state was read
+       * @return false during a calibration, or in the millisecond of a compute: try again later
+       */
+      bool getState(TouchState &state);
+
+      /**
+       * @brief Restore the state of getState(), but for the PID integrals and times
+       *
+       * @param state State
+       * @see setPIDState
+       */
+      void setState(const TouchState &state);
+
+      /**
+       * @brief Restore the state of one PID controller, from getState()
+       *
+       * The PID library only takes the time of a compute from the clock:
+       * call it with millis() at pid.lastMs, then move the clock on.
+       *
+       * @param axis 'x' or 'y'
+       * @param pid State of the controller
+       */
+      void setPIDState(char axis, const TouchPidState &pid);
+
     private:
       /**
        * @brief Load calibration data from EEPROM
@@ -284,7 +406,7 @@ namespace stewy
        * @param step Current calibration step (0-3, corresponding to the four corners)
        * @param p Touchscreen point data
        */
-      void processCalibrationPoint(int step, TSPoint p);
+      void processCalibrationPoint(int step, hal::TouchPoint p);
 
       /**
        * @brief Finish the calibration process
@@ -293,6 +415,27 @@ namespace stewy
        * saves them to EEPROM, and re-enables the PID controllers.
        */
       void finishCalibration();
+
+      /**
+       * @brief Put both PID controllers in automatic mode
+       *
+       * From manual mode, the PID library starts the integral from the
+       * output and the derivative from the input: the input is kept, for
+       * getState().
+       */
+      void setAutomatic();
+
+      /**
+       * @brief Read the integral of a PID controller, with a copy of it
+       *
+       * @param pid Controller
+       * @param input Its input
+       * @param output Its output
+       * @param setpoint Its setpoint
+       * @param state Input and time of its last compute; receives the gains and the integral
+       * @return true if the copy computed
+       */
+      static bool readPID(PID *pid, double &input, double &output, double &setpoint, TouchPidState &state);
     };
 
   } // namespace drivers
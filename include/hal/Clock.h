@@ -0,0 +1,103 @@
+#pragma once
+/**
+ * @file Clock.h
+ * @brief Hardware abstraction of time: clocks, delays, the periodic timer and sleep
+ *
+ * This file is part of the hardware abstraction layer (HAL) that the
+ * firmware calls instead of the Arduino globals, so that it also builds and
+ * runs natively on Linux. Each function has a Teensy implementation, in
+ * src/hal/teensy/, and a host implementation, in src/hal/native/; the
+ * PlatformIO environment selects one of them.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    /**
+     * @brief Start the clocks, and the cycle counter
+     *
+     * Call once, at the start of setup().
+     */
+    void clockBegin();
+
+    /**
+     * @brief Get the time since startup
+     *
+     * @return uint32_t Milliseconds, wrapping around after about 49 days
+     */
+    uint32_t millis();
+
+    /**
+     * @brief Get the time since startup
+     *
+     * @return uint32_t Microseconds, wrapping around after about 71 minutes
+     */
+    uint32_t micros();
+
+    /**
+     * @brief Wait
+     *
+     * @param ms Milliseconds to wait
+     */
+    void delay(uint32_t ms);
+
+    /**
+     * @brief Get the cycle counter, for profiling
+     *
+     * @return uint32_t CPU cycles on the Teensy (DWT), nanoseconds on the host; wraps around
+     */
+    uint32_t cycleCount();
+
+    /**
+     * @brief Get the rate of the cycle counter
+     *
+     * @return uint32_t Counts of cycleCount() per microsecond
+     */
+    uint32_t cyclesPerMicrosecond();
+
+    /**
+     * @brief Call a function periodically, from an interrupt
+     *
+     * On the Teensy this is an IntervalTimer, which interrupts the loop. The
+     * host runs the function on the loop thread, at the first clock call
+     * after each tick is due (micros(), delay() or waitForInterrupt()), so
+     * it too runs to completion between two statements of the loop, never
+     * alongside them.
+     *
+     * @param isr Function to call
+     * @param periodUs Period in microseconds
+     * @return true if the timer started
+     */
+    bool timerBegin(void (*isr)(), uint32_t periodUs);
+
+    /**
+     * @brief Sleep until the next interrupt
+     *
+     * WFI on the Teensy, where the SysTick interrupt wakes the CPU up at
+     * least every millisecond. The host sleeps for a fraction of that.
+     */
+    void waitForInterrupt();
+
+  } // namespace hal
+} // namespace stewy
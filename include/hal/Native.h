@@ -0,0 +1,90 @@
+#pragma once
+/**
+ * @file Native.h
+ * @brief Inputs of the host implementation of the HAL
+ *
+ * On the host there is no touchscreen or Nunchuck to read. These functions
+ * set what the HAL returns instead, and type on the serial console, from a
+ * simulation or a test; they only
+ * exist in the native build (src/hal/native/). A simulation can also run
+ * the clock on simulated time, faster than real time and repeatably.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include "hal/NunchuckBus.h"
+#include "hal/TouchAdc.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+    namespace native
+    {
+
+      /**
+       * @brief Set the reading of the touchscreen
+       *
+       * @param point Position and pressure that touchRead() returns from now on (nothing touches, initially)
+       */
+      void setTouchPoint(const TouchPoint &point);
+
+      /**
+       * @brief Connect a Nunchuck, and set its state
+       *
+       * @param state Joystick and buttons that nunchuckRead() returns from now on (no Nunchuck, initially)
+       */
+      void setNunchuckState(const NunchuckState &state);
+
+      /**
+       * @brief Type on the serial console
+       *
+       * @param text Characters that serialRead() returns, before any from the standard input
+       */
+      void setSerialInput(const char *text);
+
+      /**
+       * @brief Set the file that backs the non-volatile store
+       *
+       * @param path File, created on the first write ("stewy_eeprom.bin" in the working directory, by default)
+       */
+      void setStorePath(const char *path);
+
+      /**
+       * @brief Run the clock on simulated time, from 0
+       *
+       * From now on, time only moves with advanceClock() and delay(), and
+       * timerBegin() runs its interrupt from advanceClock() rather than from
+       * the clock calls. Call it before anything reads the clock.
+       */
+      void useVirtualClock();
+
+      /**
+       * @brief Move simulated time forward
+       *
+       * Runs the interrupt of timerBegin() at each of its ticks on the way,
+       * with the clock at the time of the tick.
+       *
+       * @param us Microseconds to move forward
+       */
+      void advanceClock(uint32_t us);
+
+    } // namespace native
+  } // namespace hal
+} // namespace stewy
@@ -0,0 +1,61 @@
+#pragma once
+/**
+ * @file NunchuckBus.h
+ * @brief Hardware abstraction of the Wii Nunchuck, on I2C
+ *
+ * The Teensy implementation talks to the Nunchuck over Wire with the
+ * WiiChuck library. The host implementation returns the state last set
+ * with hal::native::setNunchuckState() (see Native.h).
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    /**
+     * @struct NunchuckState
+     * @brief Joystick and buttons of the Nunchuck
+     */
+    struct NunchuckState
+    {
+      int joyX;     ///< Joystick X, as reported by the accessory
+      int joyY;     ///< Joystick Y, as reported by the accessory
+      bool buttonZ; ///< Z button pressed
+      bool buttonC; ///< C button pressed
+    };
+
+    /**
+     * @brief Start the I2C bus, and identify the Nunchuck
+     *
+     * @return true if a Nunchuck answered
+     */
+    bool nunchuckBegin();
+
+    /**
+     * @brief Read the Nunchuck
+     *
+     * @param state Joystick and buttons, unchanged if the read failed
+     * @return true if the read succeeded
+     */
+    bool nunchuckRead(NunchuckState &state);
+
+  } // namespace hal
+} // namespace stewy
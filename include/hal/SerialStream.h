@@ -0,0 +1,56 @@
+#pragma once
+/**
+ * @file SerialStream.h
+ * @brief Hardware abstraction of the serial console
+ *
+ * The Teensy implementation uses the USB serial port. The host
+ * implementation reads stdin without blocking, and writes stdout.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    /**
+     * @brief Open the serial console
+     *
+     * @param baud Baud rate (ignored by USB serial and by the host)
+     */
+    void serialBegin(uint32_t baud);
+
+    /**
+     * @brief Read a character, without waiting
+     *
+     * @return int The character, or -1 if none is available
+     */
+    int serialRead();
+
+    /**
+     * @brief Write a character
+     *
+     * @param c Character
+     */
+    void serialWrite(char c);
+
+  } // namespace hal
+} // namespace stewy
@@ -0,0 +1,71 @@
+#pragma once
+/**
+ * @file ServoOut.h
+ * @brief Hardware abstraction of the servo outputs
+ *
+ * The Teensy implementation drives the servos with the Servo library, or
+ * with the FTM0 hardware PWM when SERVO_PWM_ENABLED is defined (see
+ * FtmServoPwm.h). The host implementation keeps the pulse widths, so that
+ * they can be read back.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    const int SERVO_OUTPUTS = 6; ///< Number of servo outputs
+
+    /**
+     * @brief Start the servo outputs
+     *
+     * @param pins Array of SERVO_OUTPUTS pins (SERVO_PINS)
+     * @return true if the outputs started
+     */
+    bool servoBegin(const int *pins);
+
+    /**
+     * @brief Set the pulse width of a servo
+     *
+     * Safe to call from the servo timer interrupt. With a buffered output,
+     * the pulse is only sent by servoFlush().
+     *
+     * @param servo Servo index (0-5)
+     * @param us Pulse width in microseconds
+     */
+    void servoWrite(int servo, uint16_t us);
+
+    /**
+     * @brief Send the pulse widths written since the last call, to all servos together
+     */
+    void servoFlush();
+
+    /**
+     * @brief Get the pulse width last written to a servo
+     *
+     * @param servo Servo index (0-5)
+     * @return uint16_t Pulse width in microseconds, 0 if never written
+     */
+    uint16_t servoRead(int servo);
+
+  } // namespace hal
+} // namespace stewy
@@ -0,0 +1,85 @@
+#pragma once
+/**
+ * @file Store.h
+ * @brief Hardware abstraction of the non-volatile store
+ *
+ * The Teensy implementation uses the EEPROM. The host implementation keeps
+ * the same number of bytes in a file (see hal::native::setStorePath()), so
+ * a saved geometry or calibration survives a restart there too. Unwritten
+ * bytes read as 0xFF, as on an erased EEPROM.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    const int STORE_SIZE = 2048; ///< Bytes in the store (the EEPROM of the Teensy 3.2)
+
+    /**
+     * @brief Read bytes from the store
+     *
+     * @param address First byte
+     * @param data Destination
+     * @param size Number of bytes
+     */
+    void storeRead(int address, void *data, size_t size);
+
+    /**
+     * @brief Write bytes to the store, skipping those that already hold the value
+     *
+     * @param address First byte
+     * @param data Source
+     * @param size Number of bytes
+     */
+    void storeWrite(int address, const void *data, size_t size);
+
+    /**
+     * @brief Read an object from the store, as EEPROM.get()
+     *
+     * @param address First byte
+     * @param value Object read
+     * @return T& The object
+     */
+    template <typename T>
+    T &storeGet(int address, T &value)
+    {
+      storeRead(address, &value, sizeof(T));
+      return value;
+    }
+
+    /**
+     * @brief Write an object to the store, as EEPROM.put()
+     *
+     * @param address First byte
+     * @param value Object to write
+     * @return const T& The object
+     */
+    template <typename T>
+    const T &storePut(int address, const T &value)
+    {
+      storeWrite(address, &value, sizeof(T));
+      return value;
+    }
+
+  } // namespace hal
+} // namespace stewy
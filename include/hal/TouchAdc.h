@@ -0,0 +1,65 @@
+#pragma once
+/**
+ * @file TouchAdc.h
+ * @brief Hardware abstraction of the resistive touchscreen ADC
+ *
+ * The Teensy implementation reads the 4-wire touchscreen with the Adafruit
+ * TouchScreen library. The host implementation returns the point last set
+ * with hal::native::setTouchPoint() (see Native.h).
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    /**
+     * @struct TouchPoint
+     * @brief Raw touchscreen reading
+     */
+    struct TouchPoint
+    {
+      int16_t x; ///< Raw X position (ADC counts)
+      int16_t y; ///< Raw Y position (ADC counts)
+      int16_t z; ///< Pressure, 0 when nothing touches the screen
+    };
+
+    /**
+     * @brief Start the touchscreen
+     *
+     * @param xp X+ pin
+     * @param yp Y+ pin, analog
+     * @param xm X- pin, analog
+     * @param ym Y- pin
+     * @param ohms Resistance between X+ and X-, in ohms
+     */
+    void touchBegin(uint8_t xp, uint8_t yp, uint8_t xm, uint8_t ym, uint16_t ohms);
+
+    /**
+     * @brief Read the touchscreen
+     *
+     * @return TouchPoint Position and pressure
+     */
+    TouchPoint touchRead();
+
+  } // namespace hal
+} // namespace stewy
@@ -0,0 +1,229 @@
+#pragma once
+/**
+ * @file Arduino.h
+ * @brief Arduino compatibility for the native build
+ *
+ * The firmware itself goes through the HAL (include/hal/), but the
+ * libraries it uses (ArduinoLog, PID, Shell, Blinker) include Arduino.h.
+ * The native PlatformIO environment puts this directory on the include
+ * path, so that they build unchanged on Linux: this header provides the
+ * part of the Arduino API they and Config.h use, on top of the HAL.
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+#include <type_traits>
+#include "hal/Clock.h"
+
+// abs() of floats and doubles too, as the Arduino abs() macro
+using std::abs;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+// Pin numbers of the Teensy 3.2
+#define LED_BUILTIN 13
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+#define A8 22
+#define A9 23
+
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+// No separate flash address space on the host
+#define PROGMEM
+#define PGM_P const char *
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+class __FlashStringHelper;
+#define F(string) ((const __FlashStringHelper *)(string))
+
+inline unsigned long millis()
+{
+  return stewy::hal::millis();
+}
+
+inline unsigned long micros()
+{
+  return stewy::hal::micros();
+}
+
+inline void delay(unsigned long ms)
+{
+  stewy::hal::delay(ms);
+}
+
+void delayMicroseconds(unsigned int us);
+
+template <class T, class A, class B, class C, class D>
+T map(T x, A inMin, B inMax, C outMin, D outMax)
+{
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+template <class T, class L, class H>
+T constrain(T amount, L low, H high)
+{
+  return amount < low ? low : (amount > high ? high : amount);
+}
+
+template <class A, class B>
+typename std::common_type<A, B>::type min(A a, B b)
+{
+  return b < a ? b : a;
+}
+
+template <class A, class B>
+typename std::common_type<A, B>::type max(A a, B b)
+{
+  return a < b ? b : a;
+}
+
+inline double radians(double deg)
+{
+  return deg * DEG_TO_RAD;
+}
+
+inline double degrees(double rad)
+{
+  return rad * RAD_TO_DEG;
+}
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+// Pins only keep their state; nothing is connected on the host
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+class Print;
+
+/**
+ * @class Printable
+ * @brief Object that can print itself
+ */
+class Printable
+{
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print &p) const = 0;
+};
+
+/**
+ * @class Print
+ * @brief Text output, as the Arduino Print class
+ */
+class Print
+{
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *s) { return s == nullptr ? 0 : write((const uint8_t *)s, strlen(s)); }
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+
+  size_t print(const __FlashStringHelper *s) { return write((const char *)s); }
+  size_t print(const char *s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(long n, int base = DEC);
+  size_t print(unsigned long n, int base = DEC);
+  size_t print(double n, int digits = 2);
+  size_t print(const Printable &p) { return p.printTo(*this); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(T value) { return print(value) + println(); }
+  template <typename T>
+  size_t println(T value, int format) { return print(value, format) + println(); }
+
+  int printf(const char *format, ...);
+};
+
+/**
+ * @class Stream
+ * @brief Text input and output, as the Arduino Stream class
+ */
+class Stream : public Print
+{
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  virtual void flush() {}
+};
+
+/**
+ * @class NativeSerial
+ * @brief The Serial port, on the serial console HAL (stdin and stdout)
+ */
+class NativeSerial : public Stream
+{
+public:
+  void begin(unsigned long baud);
+  int available() override;
+  int read() override;
+  int peek() override;
+  void flush() override;
+  size_t write(uint8_t c) override;
+  using Print::write;
+  operator bool() const { return true; }
+
+private:
+  int _next = -1; ///< Character read ahead by available() or peek()
+};
+
+extern NativeSerial Serial;
+
+// The sketch, run by main()
+void setup();
+void loop();
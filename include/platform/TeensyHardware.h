@@ -52,6 +52,9 @@ namespace stewy
 #define CPU_RESTART_ADDR (uint32_t *)0xE000ED0C           // to this memory location...
 #define CPU_RESTART (*CPU_RESTART_ADDR = CPU_RESTART_VAL) // presto!
         CPU_RESTART;
+#elif defined(STEWY_NATIVE)
+        // Native build: end the process, for the shell or the simulator to start again
+        exit(0);
 #else
         // For other platforms, just reset the Arduino
         asm volatile("jmp 0");
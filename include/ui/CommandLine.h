@@ -35,6 +35,10 @@ extern "C"
 #include "core/Config.h"
 #include "drivers/TouchScreen.h"
 #include "drivers/Nunchuck.h"
+#include "core/PoseArbiter.h"
+#include "core/Profiler.h"
+#include "core/Recorder.h"
+#include "core/Scheduler.h"
 
 namespace stewy
 {
@@ -56,20 +60,34 @@ namespace stewy
       drivers::TouchScreenDriver *touchscreen; ///< Pointer to the touchscreen driver
       drivers::NunchuckDriver *nunchuck;       ///< Pointer to the nunchuck driver
       float *servoValues;                      ///< Pointer to the servo values array
+      void (*moveServos)();                    ///< Hands servoValues over to the servos
+      core::PoseArbiter *arbiter;              ///< Pose arbiter that moves the platform
+      core::Profiler *profiler;                ///< Stage timings of the loop, or nullptr
+      core::Scheduler *scheduler;              ///< Scheduler that runs the loop tasks, or nullptr
+      core::Recorder *recorder;                ///< Record of the loop inputs, or nullptr
 
     public:
       /**
        * @brief Construct a new CommandLine object
        *
        * Initializes the command line interface with references to the
-       * touchscreen driver, nunchuck driver, and servo values array.
+       * touchscreen driver, nunchuck driver, servo values array, the function
+       * that moves the servos to it, pose arbiter, profiler, scheduler and
+       * recorder.
        * Also sets the static instance pointer for use in command handlers.
        *
        * @param touchscreen Pointer to the touchscreen driver
        * @param nunchuck Pointer to the nunchuck driver
        * @param servoValues Pointer to the servo values array (6 elements)
+       * @param moveServos Hands servoValues over to the servos (updateServos() of main.cpp), for blocking commands
+       * @param arbiter Pose arbiter that moves the platform
+       * @param profiler Stage timings of the loop, or nullptr if not profiled
+       * @param scheduler Scheduler that runs the loop tasks, or nullptr
+       * @param recorder Record of the loop inputs, or nullptr if not recorded
        */
-      CommandLine(drivers::TouchScreenDriver *touchscreen, drivers::NunchuckDriver *nunchuck, float *servoValues);
+      CommandLine(drivers::TouchScreenDriver *touchscreen, drivers::NunchuckDriver *nunchuck, float *servoValues,
+                  void (*moveServos)(), core::PoseArbiter *arbiter, core::Profiler *profiler, core::Scheduler *scheduler,
+                  core::Recorder *recorder);
 
       /**
        * @brief Destructor for CommandLine object
@@ -192,7 +210,8 @@ namespace stewy
       /**
        * @brief Move platform to specified position
        *
-       * Moves the platform to the specified position and orientation.
+       * Requests a move to the specified position and orientation, which
+       * the pose arbiter applies at the end of the control tick.
        * Usage: moveto <pitch> <roll> [sway] [surge] [heave] [yaw]
        *
        * @param argc Number of arguments (3-7)
@@ -201,6 +220,42 @@ namespace stewy
        */
       static int handleMoveTo(int argc, char **argv);
 
+      /**
+       * @brief Move the platform at once, for a blocking command
+       *
+       * Submits the pose with PRIORITY_COMMAND_LINE and solves it right
+       * away, as the end of a control tick would, and hands each solve over
+       * to the servos: the control task does not run until the command
+       * returns. With POSE_INTERPOLATION_ENABLED, it then keeps solving,
+       * once every CONTROL_INTERVAL_US, until the arbiter has settled at the
+       * pose.
+       *
+       * @param pose Pose to move to
+       * @return true if the platform got to the pose
+       */
+      static bool moveNow(const core::Pose &pose);
+
+      /**
+       * @brief Wait, for a blocking command, while the servos keep moving
+       *
+       * Hands the setpoints over to the servos once every
+       * CONTROL_INTERVAL_US, as the control task would, so that the servo
+       * profiles of SERVO_ACCELERATION_ENABLED keep moving without the
+       * servo timer.
+       *
+       * @param ms Time to wait, in milliseconds
+       */
+      static void hold(unsigned long ms);
+
+      /**
+       * @brief Note that a command changed the state of the loop
+       *
+       * The inputs the recorder records do not tell the replay about
+       * commands: the loop records a keyframe after them instead, from the
+       * next pose solve.
+       */
+      static void loopChanged();
+
       /**
        * @brief Set log level
        *
@@ -213,6 +268,72 @@ namespace stewy
        */
       static int handleLog(int argc, char **argv);
 
+      /**
+       * @brief Display or change the platform geometry
+       *
+       * Without arguments, displays the tunable geometry parameters.
+       * A parameter name and value changes that parameter, and save, load
+       * and reset write it to EEPROM, read it back, or restore the defaults.
+       * Usage: geom [<parameter> <value> | save | load | reset]
+       *
+       * @param argc Number of arguments (1-3)
+       * @param argv Array of argument strings
+       * @return SHELL_RET_SUCCESS on success, SHELL_RET_FAILURE on failure
+       */
+      static int handleGeometry(int argc, char **argv);
+
+      /**
+       * @brief Display or clear the pose cache and lookup table statistics
+       *
+       * Displays the hits, misses and entries of the shared pose cache, and
+       * the hits and misses of the pitch/roll lookup table, or empties the
+       * cache and resets both counters.
+       * Usage: cache [clear]
+       *
+       * @param argc Number of arguments (1-2)
+       * @param argv Array of argument strings
+       * @return SHELL_RET_SUCCESS on success, SHELL_RET_FAILURE on failure
+       */
+      static int handleCache(int argc, char **argv);
+
+      /**
+       * @brief Display and reset the loop timings
+       *
+       * Displays the runs, minimum, mean and maximum time and the histogram
+       * of each profiled stage, and the runs, overruns, worst latency and
+       * worst run time of each scheduler task, then resets them all.
+       * Usage: stats
+       *
+       * @param argc Number of arguments (must be 1)
+       * @param argv Array of argument strings
+       * @return SHELL_RET_SUCCESS on success, SHELL_RET_FAILURE on failure
+       */
+      static int handleStats(int argc, char **argv);
+
+      /**
+       * @brief Record the loop inputs, and send the record
+       *
+       * Starts or stops the recorder, shows its state, or stops it and sends
+       * the record over serial for tools/Replay: a STEWY-RECORD header line
+       * with the touchscreen calibration and gains, STEWY-DATA lines of
+       * entries in hex, and a STEWY-END line with their checksum. The
+       * entries start with a keyframe of the loop state, unless the buffer
+       * wrapped around over it.
+       * Usage: record [start | stop | send]
+       *
+       * @param argc Number of arguments (1 or 2)
+       * @param argv Array of argument strings
+       * @return SHELL_RET_SUCCESS on success, SHELL_RET_FAILURE on failure
+       */
+      static int handleRecord(int argc, char **argv);
+
+      /**
+       * @brief Write a line to the serial console, whatever the log level
+       *
+       * @param line Text, without the line ending
+       */
+      static void writeLine(const char *line);
+
       /**
        * @brief Set PID parameters
        *
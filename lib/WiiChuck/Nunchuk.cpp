@@ -117,7 +117,7 @@ uint8_t Nunchuk::read()
     a += 1;
   }
   _ax = a - 511;
-  _ax2 = pow(_ax, 2);
+  _ax2 = (long)_ax * _ax;
 
   a = _buf[3] * 2 * 2;
   if ((_buf[5] >> 4) & 1)
@@ -129,7 +129,7 @@ uint8_t Nunchuk::read()
     a += 1;
   }
   _ay = a - 511;
-  _ay2 = pow(_ay, 2);
+  _ay2 = (long)_ay * _ay;
 
   a = _buf[4] * 2 * 2;
   if ((_buf[5] >> 6) & 1)
@@ -141,7 +141,7 @@ uint8_t Nunchuk::read()
     a += 1;
   }
   _az = a - 511;
-  _az2 = pow(_az, 2);
+  _az2 = (long)_az * _az;
 
   // Set up the next read
   Wire.beginTransmission(NUNCHUK_TWI_DEVICE_ADDRESS);
@@ -0,0 +1,243 @@
+/**
+ * @file ForwardKinematics.cpp
+ * @brief Implementation of the Newton-Raphson forward kinematics
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/ForwardKinematics.h"
+#include <math.h>
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    // Number of times a step that leaves the workspace is halved before giving up
+    static const int MAX_STEP_HALVINGS = 3;
+
+    /**
+     * Solve the 6x6 system a * x = b in place, by Gaussian elimination with partial pivoting.
+     * Returns false if the matrix is singular.
+     */
+    static bool solveLinear(float a[6][6], float *b)
+    {
+      for (int col = 0; col < 6; col++)
+      {
+        int pivot = col;
+        for (int row = col + 1; row < 6; row++)
+        {
+          if (fabsf(a[row][col]) > fabsf(a[pivot][col]))
+          {
+            pivot = row;
+          }
+        }
+
+        if (fabsf(a[pivot][col]) < 1e-9f)
+        {
+          return false;
+        }
+
+        if (pivot != col)
+        {
+          for (int k = 0; k < 6; k++)
+          {
+            const float t = a[col][k];
+            a[col][k] = a[pivot][k];
+            a[pivot][k] = t;
+          }
+          const float t = b[col];
+          b[col] = b[pivot];
+          b[pivot] = t;
+        }
+
+        for (int row = col + 1; row < 6; row++)
+        {
+          const float f = a[row][col] / a[col][col];
+          for (int k = col; k < 6; k++)
+          {
+            a[row][k] -= f * a[col][k];
+          }
+          b[row] -= f * b[col];
+        }
+      }
+
+      for (int row = 5; row >= 0; row--)
+      {
+        float sum = b[row];
+        for (int k = row + 1; k < 6; k++)
+        {
+          sum -= a[row][k] * b[k];
+        }
+        b[row] = sum / a[row][row];
+      }
+      return true;
+    }
+
+    ForwardKinematics::ForwardKinematics(int maxIterations, float tolerance, float step)
+        : _maxIterations(maxIterations), _tolerance(tolerance), _step(step)
+    {
+      memset(&_stats, 0, sizeof(_stats));
+      reset();
+    }
+
+    void ForwardKinematics::reset()
+    {
+      memset(_pose, 0, sizeof(_pose));
+    }
+
+    bool ForwardKinematics::evaluate(const IkKernel<ik_scalar_t> &kernel, const float *pose, const float *target,
+                                     float *residual)
+    {
+      int failedLeg;
+      float value;
+
+      _stats.solves++;
+      if (kernel.solveRaw(residual, pose[0], pose[1], pose[2], pose[3], pose[4], pose[5], failedLeg, value) != IK_OK)
+      {
+        return false;
+      }
+
+      for (int i = 0; i < 6; i++)
+      {
+        residual[i] -= target[i];
+      }
+      return true;
+    }
+
+    bool ForwardKinematics::estimate(const IkKernel<ik_scalar_t> &kernel, const float *servoValues, float *pose)
+    {
+      float target[6];
+      float residual[6];
+
+      kernel.unshape(servoValues, target);
+      _stats.estimates++;
+
+      // Restart from home if the previous estimate is no longer in the workspace
+      if (!evaluate(kernel, _pose, target, residual))
+      {
+        reset();
+        if (!evaluate(kernel, _pose, target, residual))
+        {
+          memcpy(pose, _pose, sizeof(_pose));
+          _stats.lastIterations = 0;
+          _stats.lastResidual = INFINITY;
+          return false;
+        }
+      }
+
+      float error = 0;
+      for (int i = 0; i < 6; i++)
+      {
+        error = fmaxf(error, fabsf(residual[i]));
+      }
+
+      int iteration = 0;
+      while (error > _tolerance && iteration < _maxIterations)
+      {
+        iteration++;
+
+        // Forward difference Jacobian of the residual
+        float jacobian[6][6];
+        float probe[6];
+        float shifted[6];
+        memcpy(probe, _pose, sizeof(probe));
+
+        bool ok = true;
+        for (int j = 0; j < 6 && ok; j++)
+        {
+          float h = _step;
+          probe[j] = _pose[j] + h;
+          if (!evaluate(kernel, probe, target, shifted))
+          {
+            h = -_step;
+            probe[j] = _pose[j] + h;
+            ok = evaluate(kernel, probe, target, shifted);
+          }
+          probe[j] = _pose[j];
+
+          for (int i = 0; i < 6; i++)
+          {
+            jacobian[i][j] = (shifted[i] - residual[i]) / h;
+          }
+        }
+
+        // Newton step: J * delta = -residual
+        float delta[6];
+        for (int i = 0; i < 6; i++)
+        {
+          delta[i] = -residual[i];
+        }
+        if (!ok || !solveLinear(jacobian, delta))
+        {
+          break;
+        }
+
+        // Take the step, halving it while it leaves the workspace
+        float next[6];
+        float nextResidual[6];
+        bool stepped = false;
+        for (int halving = 0; halving <= MAX_STEP_HALVINGS && !stepped; halving++)
+        {
+          for (int j = 0; j < 6; j++)
+          {
+            next[j] = _pose[j] + delta[j];
+            delta[j] *= 0.5f;
+          }
+          stepped = evaluate(kernel, next, target, nextResidual);
+        }
+        if (!stepped)
+        {
+          break;
+        }
+
+        memcpy(_pose, next, sizeof(_pose));
+        memcpy(residual, nextResidual, sizeof(residual));
+        error = 0;
+        for (int i = 0; i < 6; i++)
+        {
+          error = fmaxf(error, fabsf(residual[i]));
+        }
+      }
+
+      const bool converged = error <= _tolerance;
+      _stats.iterations += iteration;
+      _stats.lastIterations = iteration;
+      _stats.lastResidual = error;
+      if (converged)
+      {
+        _stats.converged++;
+      }
+
+      memcpy(pose, _pose, sizeof(_pose));
+      return converged;
+    }
+
+    const float *ForwardKinematics::getPose() const
+    {
+      return _pose;
+    }
+
+    const FkStats &ForwardKinematics::getStats() const
+    {
+      return _stats;
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,168 @@
+/**
+ * @file GeometryProfile.cpp
+ * @brief Implementation of the runtime platform geometry
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/GeometryProfile.h"
+#include <stddef.h>
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    const GeometryParam GEOMETRY_PARAMS[GEOMETRY_PARAM_COUNT] = {
+        {"P_RAD", &GeometryDescription::platformRadius},
+        {"B_RAD", &GeometryDescription::baseRadius},
+        {"ARM_LENGTH", &GeometryDescription::armLength},
+        {"ROD_LENGTH", &GeometryDescription::rodLength},
+        {"Z_HOME", &GeometryDescription::zHome},
+        {"THETA_P_DEG", &GeometryDescription::thetaPDeg},
+        {"THETA_B_DEG", &GeometryDescription::thetaBDeg},
+        {"ROTATION_POINT_OFFSET", &GeometryDescription::rotationPointOffset},
+        {"AGGRO", &GeometryDescription::aggro}};
+
+    bool GeometryProfile::isValid(const GeometryDescription &g)
+    {
+      // Written so that NaN fails every check
+      const double reach = g.armLength + g.rodLength;
+      bool valid = g.platformRadius > 0 && g.baseRadius > 0 &&
+                   g.armLength > 0 && g.rodLength > 0 &&
+                   g.zHome > 0 && g.zHome < reach &&
+                   g.thetaPDeg >= 0 && g.thetaPDeg < 60 &&
+                   g.thetaBDeg >= 0 && g.thetaBDeg < 60 &&
+                   g.rotationPointOffset > -reach && g.rotationPointOffset < reach &&
+                   g.aggro > 0;
+#if defined(IK_SCALAR_FIXED)
+      // Same limit as the static_assert on the defines, see IkKernel.h
+      valid = valid && reach < 181;
+#endif
+      return valid;
+    }
+
+    bool GeometryProfile::set(const GeometryDescription &g)
+    {
+      if (!isValid(g))
+      {
+        return false;
+      }
+
+      _description = g;
+      _ik = geometry::deriveIk<ik_scalar_t>(g);
+      _revision++;
+      return true;
+    }
+
+    bool GeometryProfile::setParam(const char *name, double value)
+    {
+      for (int i = 0; i < GEOMETRY_PARAM_COUNT; i++)
+      {
+        if (strcmp(name, GEOMETRY_PARAMS[i].name) == 0)
+        {
+          GeometryDescription g = _description;
+          g.*GEOMETRY_PARAMS[i].field = value;
+          return set(g);
+        }
+      }
+      return false;
+    }
+
+    void GeometryProfile::reset()
+    {
+      _description = DEFAULT_GEOMETRY;
+      _ik = GeometryTables<ik_scalar_t>::ik;
+      _revision++;
+    }
+
+    bool GeometryProfile::isDefault() const
+    {
+      for (int i = 0; i < GEOMETRY_PARAM_COUNT; i++)
+      {
+        if (_description.*GEOMETRY_PARAMS[i].field != DEFAULT_GEOMETRY.*GEOMETRY_PARAMS[i].field)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    const GeometryDescription &GeometryProfile::getDescription() const
+    {
+      return _description;
+    }
+
+    const IkGeometry<ik_scalar_t> &GeometryProfile::getIk() const
+    {
+      return _ik;
+    }
+
+    uint16_t GeometryProfile::getRevision() const
+    {
+      return _revision;
+    }
+
+    void GeometryProfile::toRecord(GeometryRecord &record) const
+    {
+      memset(&record, 0, sizeof(record));
+      record.magic = GEOMETRY_RECORD_MAGIC;
+      record.version = GEOMETRY_RECORD_VERSION;
+      record.size = sizeof(GeometryRecord);
+      for (int i = 0; i < GEOMETRY_PARAM_COUNT; i++)
+      {
+        record.values[i] = (float)(_description.*GEOMETRY_PARAMS[i].field);
+      }
+      record.checksum = checksum(record);
+    }
+
+    bool GeometryProfile::fromRecord(const GeometryRecord &record)
+    {
+      if (record.magic != GEOMETRY_RECORD_MAGIC || record.version != GEOMETRY_RECORD_VERSION ||
+          record.size != sizeof(GeometryRecord) || record.checksum != checksum(record))
+      {
+        return false;
+      }
+
+      GeometryDescription g = DEFAULT_GEOMETRY;
+      for (int i = 0; i < GEOMETRY_PARAM_COUNT; i++)
+      {
+        // A stored default keeps its exact value, so that isDefault() survives the trip through float
+        double &field = g.*GEOMETRY_PARAMS[i].field;
+        if (record.values[i] != (float)field)
+        {
+          field = record.values[i];
+        }
+      }
+      return set(g);
+    }
+
+    uint32_t GeometryProfile::checksum(const GeometryRecord &record)
+    {
+      const uint8_t *bytes = (const uint8_t *)&record;
+      uint32_t hash = 2166136261u;
+      for (size_t i = 0; i < offsetof(GeometryRecord, checksum); i++)
+      {
+        hash = (hash ^ bytes[i]) * 16777619u;
+      }
+      return hash;
+    }
+
+  } // namespace core
+} // namespace stewy
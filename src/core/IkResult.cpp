@@ -0,0 +1,80 @@
+/**
+ * @file IkResult.cpp
+ * @brief Implementation of the move outcome counters
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/IkResult.h"
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    const char *IK_RESULT_STRINGS[] = {
+        "OK",
+        "SLAMMED",
+        "CLIPPED",
+        "OUT_OF_RANGE",
+        "UNREACHABLE",
+        "DISTANCE_TOO_GREAT",
+        "ASYMPTOTIC"};
+
+    IkDiagnostics::IkDiagnostics(unsigned long intervalMs)
+        : _intervalMs(intervalMs), _lastReportMs(0), _pending(0)
+    {
+      memset(_counts, 0, sizeof(_counts));
+      _lastFailure.status = IK_RESULT_OK;
+      _lastFailure.leg = -1;
+      _lastFailure.margin = 0;
+    }
+
+    bool IkDiagnostics::takeReport(unsigned long nowMs, unsigned long &failures, IkResult &lastFailure)
+    {
+      // Unsigned subtraction, so that the clock wrapping around does not stall the reports
+      if (_pending == 0 || nowMs - _lastReportMs < _intervalMs)
+      {
+        return false;
+      }
+
+      failures = _pending;
+      lastFailure = _lastFailure;
+      _pending = 0;
+      _lastReportMs = nowMs;
+      return true;
+    }
+
+    unsigned long IkDiagnostics::getCount(IkResultStatus status) const
+    {
+      return _counts[status];
+    }
+
+    void IkDiagnostics::resetStats()
+    {
+      memset(_counts, 0, sizeof(_counts));
+    }
+
+    const char *IkDiagnostics::getStatusString(IkResultStatus status)
+    {
+      return IK_RESULT_STRINGS[status];
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,258 @@
+/**
+ * @file IncrementalIk.cpp
+ * @brief Implementation of the Jacobian-based incremental IK
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/IncrementalIk.h"
+#include <math.h>
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    // A Broyden update is still used up to this multiple of maxError; beyond it, J is re-estimated.
+    // The drift limit already keeps the next linearization near maxError, and a re-estimate costs 12 solves.
+    static const float REFRESH_ERROR_RATIO = 4.0f;
+
+    IncrementalIk::IncrementalIk(float maxDelta, float maxDrift, float maxError, float step)
+        : _maxDelta(maxDelta), _maxDrift(maxDrift), _maxError(maxError), _step(step), _valid(false), _linear(false), _driftLimit(maxDrift),
+          _linearSolves(0), _fullSolves(0), _refreshes(0), _rejected(0)
+    {
+      memset(_basePose, 0, sizeof(_basePose));
+      memset(_lastPose, 0, sizeof(_lastPose));
+    }
+
+    void IncrementalIk::invalidate()
+    {
+      _valid = false;
+    }
+
+    IkStatus IncrementalIk::solve(const IkKernel<ik_scalar_t> &kernel, float *servoValues, const float *pose,
+                                  int &failedLeg, float &value)
+    {
+      float d[6];
+      for (int j = 0; j < 6; j++)
+      {
+        d[j] = pose[j] - _basePose[j];
+      }
+
+      if (_valid)
+      {
+        float delta = 0;
+        float drift = 0;
+        for (int j = 0; j < 6; j++)
+        {
+          delta = fmaxf(delta, fabsf(pose[j] - _lastPose[j]));
+          drift = fmaxf(drift, fabsf(d[j]));
+        }
+
+        if (delta <= _maxDelta && drift <= _driftLimit)
+        {
+          // The prediction is only used if every leg can reach it, and it is within maxError of the exact angles.
+          // Otherwise the full solve below decides, and reports the failing leg
+          float error;
+          predict(d, servoValues);
+          if (kernel.check(servoValues, pose[0], pose[1], pose[2], pose[3], pose[4], pose[5], error, failedLeg, value) == IK_OK &&
+              error <= _maxError)
+          {
+            kernel.shape(servoValues);
+            memcpy(_lastPose, pose, sizeof(_lastPose));
+            _linear = true;
+            _linearSolves++;
+            return IK_OK;
+          }
+          _rejected++;
+        }
+      }
+
+      _linear = false;
+      _fullSolves++;
+      IkStatus status = kernel.solveRaw(servoValues, pose[0], pose[1], pose[2], pose[3], pose[4], pose[5], failedLeg, value);
+
+      if (status != IK_OK)
+      {
+        _valid = false;
+      }
+      else if (_valid && update(d, servoValues))
+      {
+        rebase(pose, servoValues);
+      }
+      else
+      {
+        _valid = refresh(kernel, pose, servoValues);
+        if (_valid)
+        {
+          rebase(pose, servoValues);
+        }
+        else
+        {
+          _driftLimit = _maxDrift;
+        }
+      }
+
+#ifdef SLAM
+      if (status == IK_OK || status == IK_ASYMPTOTIC)
+#else
+      if (status == IK_OK)
+#endif
+      {
+        kernel.shape(servoValues);
+      }
+
+      return status;
+    }
+
+    void IncrementalIk::predict(const float *d, float *angles) const
+    {
+      for (int i = 0; i < 6; i++)
+      {
+        const float *row = _jacobian[i];
+        angles[i] = _baseAngles[i] + row[0] * d[0] + row[1] * d[1] + row[2] * d[2] +
+                    row[3] * d[3] + row[4] * d[4] + row[5] * d[5];
+      }
+    }
+
+    bool IncrementalIk::update(const float *d, const float *angles)
+    {
+      float predicted[6];
+      predict(d, predicted);
+
+      float residual[6];
+      float error = 0;
+      for (int i = 0; i < 6; i++)
+      {
+        residual[i] = angles[i] - predicted[i];
+        error = fmaxf(error, fabsf(residual[i]));
+      }
+
+      // The linearization error grows with the square of the distance from the base pose,
+      // so the error seen at this distance sets how far the next base may be extrapolated
+      float distance = 0;
+      for (int j = 0; j < 6; j++)
+      {
+        distance = fmaxf(distance, fabsf(d[j]));
+      }
+      _driftLimit = (error > 0) ? fminf(_maxDrift, distance * sqrtf(_maxError / error)) : _maxDrift;
+
+      if (error > REFRESH_ERROR_RATIO * _maxError)
+      {
+        return false;
+      }
+
+      // Broyden rank-one update: the smallest change to J that maps d onto the observed change in angles
+      float norm = 0;
+      for (int j = 0; j < 6; j++)
+      {
+        norm += d[j] * d[j];
+      }
+      if (norm > 0)
+      {
+        for (int i = 0; i < 6; i++)
+        {
+          const float scale = residual[i] / norm;
+          for (int j = 0; j < 6; j++)
+          {
+            _jacobian[i][j] += scale * d[j];
+          }
+        }
+      }
+      return true;
+    }
+
+    bool IncrementalIk::refresh(const IkKernel<ik_scalar_t> &kernel, const float *pose, const float *angles)
+    {
+      int failedLeg;
+      float value;
+      float plus[6], minus[6];
+      float p[6];
+      float curvature[6] = {0, 0, 0, 0, 0, 0};
+
+      _refreshes++;
+      memcpy(p, pose, sizeof(p));
+
+      for (int j = 0; j < 6; j++)
+      {
+        p[j] = pose[j] + _step;
+        if (kernel.solveRaw(plus, p[0], p[1], p[2], p[3], p[4], p[5], failedLeg, value) != IK_OK)
+        {
+          return false;
+        }
+
+        p[j] = pose[j] - _step;
+        if (kernel.solveRaw(minus, p[0], p[1], p[2], p[3], p[4], p[5], failedLeg, value) != IK_OK)
+        {
+          return false;
+        }
+
+        p[j] = pose[j];
+
+        for (int i = 0; i < 6; i++)
+        {
+          _jacobian[i][j] = (plus[i] - minus[i]) / (2 * _step);
+          curvature[i] += fabsf(plus[i] + minus[i] - 2 * angles[i]) / (_step * _step);
+        }
+      }
+
+      // Second differences bound the linearization error at a drift of x: about curvature * x^2 / 2
+      float worst = 0;
+      for (int i = 0; i < 6; i++)
+      {
+        worst = fmaxf(worst, curvature[i]);
+      }
+      _driftLimit = (worst > 0) ? fminf(_maxDrift, sqrtf(2 * _maxError / worst)) : _maxDrift;
+      return true;
+    }
+
+    void IncrementalIk::rebase(const float *pose, const float *angles)
+    {
+      memcpy(_basePose, pose, sizeof(_basePose));
+      memcpy(_lastPose, pose, sizeof(_lastPose));
+      memcpy(_baseAngles, angles, sizeof(_baseAngles));
+    }
+
+    bool IncrementalIk::wasLinear() const
+    {
+      return _linear;
+    }
+
+    unsigned long IncrementalIk::getLinearSolves() const
+    {
+      return _linearSolves;
+    }
+
+    unsigned long IncrementalIk::getFullSolves() const
+    {
+      return _fullSolves;
+    }
+
+    unsigned long IncrementalIk::getRefreshes() const
+    {
+      return _refreshes;
+    }
+
+    unsigned long IncrementalIk::getRejected() const
+    {
+      return _rejected;
+    }
+
+  } // namespace core
+} // namespace stewy
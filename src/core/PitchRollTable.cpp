@@ -0,0 +1,160 @@
+/**
+ * @file PitchRollTable.cpp
+ * @brief Implementation of the pitch/roll IK lookup table
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/PitchRollTable.h"
+#include <math.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    // Angles are stored relative to the middle of the servo range
+    static const float MID_ANGLE = (SERVO_MIN_ANGLE + SERVO_MAX_ANGLE) / 2.0f;
+
+    // Grid spacing, in degrees
+    static const float PITCH_STEP = (float)(MAX_PITCH - MIN_PITCH) / IK_LUT_PITCH_STEPS;
+    static const float ROLL_STEP = (float)(MAX_ROLL - MIN_ROLL) / IK_LUT_ROLL_STEPS;
+
+    PitchRollTable::PitchRollTable()
+        : _rowsBuilt(0), _hits(0), _misses(0), _sway(0), _surge(0), _heave(0), _yaw(0)
+    {
+    }
+
+    void PitchRollTable::invalidate()
+    {
+      _rowsBuilt = 0;
+    }
+
+    void PitchRollTable::buildRow(const IkKernel<ik_scalar_t> &kernel, int row)
+    {
+      const float pitch = MIN_PITCH + row * PITCH_STEP;
+
+      for (int j = 0; j < ROLL_POINTS; j++)
+      {
+        const float roll = MIN_ROLL + j * ROLL_STEP;
+        float angles[6];
+        int failedLeg;
+        float value;
+
+        IkStatus status = kernel.solveRaw(angles, _sway, _surge, _heave, pitch, roll, _yaw, failedLeg, value);
+
+        for (int i = 0; i < 6; i++)
+        {
+          const float v = (angles[i] - MID_ANGLE) * 100;
+          _angles[row][j][i] = (status != IK_OK) ? INFEASIBLE
+                                                 : (int16_t)(v > INT16_MAX ? INT16_MAX : (v < -INT16_MAX ? -INT16_MAX : lroundf(v)));
+        }
+      }
+    }
+
+    bool PitchRollTable::lookup(const IkKernel<ik_scalar_t> &kernel, float *servoValues,
+                                int sway, int surge, int heave, float yaw, float pitch, float roll)
+    {
+      // The table is only valid for the translation it was built for
+      if (sway != _sway || surge != _surge || heave != _heave || yaw != _yaw)
+      {
+        _sway = sway;
+        _surge = surge;
+        _heave = heave;
+        _yaw = yaw;
+        invalidate();
+      }
+
+      if (_rowsBuilt < PITCH_POINTS)
+      {
+        for (int n = 0; n < IK_LUT_ROWS_PER_CALL && _rowsBuilt < PITCH_POINTS; n++)
+        {
+          buildRow(kernel, _rowsBuilt++);
+        }
+        _misses++;
+        return false;
+      }
+
+      if (pitch < MIN_PITCH || pitch > MAX_PITCH || roll < MIN_ROLL || roll > MAX_ROLL)
+      {
+        _misses++;
+        return false;
+      }
+
+      // Locate the grid cell and the position within it
+      const float fp = (pitch - MIN_PITCH) / PITCH_STEP;
+      const float fr = (roll - MIN_ROLL) / ROLL_STEP;
+      int p0 = (int)fp;
+      int r0 = (int)fr;
+      if (p0 >= IK_LUT_PITCH_STEPS)
+      {
+        p0 = IK_LUT_PITCH_STEPS - 1;
+      }
+      if (r0 >= IK_LUT_ROLL_STEPS)
+      {
+        r0 = IK_LUT_ROLL_STEPS - 1;
+      }
+      const float tp = fp - p0;
+      const float tr = fr - r0;
+
+      const int16_t *a = _angles[p0][r0];
+      const int16_t *b = _angles[p0 + 1][r0];
+      const int16_t *c = _angles[p0][r0 + 1];
+      const int16_t *d = _angles[p0 + 1][r0 + 1];
+
+      if (a[0] == INFEASIBLE || b[0] == INFEASIBLE || c[0] == INFEASIBLE || d[0] == INFEASIBLE)
+      {
+        _misses++;
+        return false;
+      }
+
+      // Bilinear interpolation
+      const float wa = (1 - tp) * (1 - tr);
+      const float wb = tp * (1 - tr);
+      const float wc = (1 - tp) * tr;
+      const float wd = tp * tr;
+
+      for (int i = 0; i < 6; i++)
+      {
+        servoValues[i] = MID_ANGLE + (wa * a[i] + wb * b[i] + wc * c[i] + wd * d[i]) * 0.01f;
+      }
+
+      kernel.shape(servoValues);
+
+      _hits++;
+      return true;
+    }
+
+    void PitchRollTable::resetStats()
+    {
+      _hits = 0;
+      _misses = 0;
+    }
+
+    unsigned long PitchRollTable::getHits() const
+    {
+      return _hits;
+    }
+
+    unsigned long PitchRollTable::getMisses() const
+    {
+      return _misses;
+    }
+
+  } // namespace core
+} // namespace stewy
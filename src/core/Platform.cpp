@@ -22,259 +22,435 @@
 
 #include "core/Platform.h"
 #include "Arduino.h"
+#include "hal/Store.h"
 
 namespace stewy
 {
   namespace core
   {
 
-    Platform::Platform(int servo_min_angle, int servo_max_angle)
-        : _servo_min_angle(servo_min_angle), _servo_max_angle(servo_max_angle)
+    GeometryProfile Platform::_geometry;
+
+#ifdef IK_LUT_ENABLED
+    PitchRollTable Platform::_pitchRollTable;
+#endif
+
+#ifdef WORKSPACE_MAP_ENABLED
+    WorkspaceMap Platform::_workspaceMap(WORKSPACE_MAP);
+#endif
+
+#ifdef POSE_CACHE_ENABLED
+    static PoseCacheEntry poseCacheEntries[POSE_CACHE_CAPACITY];
+    PoseCache Platform::_poseCache(poseCacheEntries, POSE_CACHE_CAPACITY, POSE_CACHE_QUANTUM_MM, POSE_CACHE_QUANTUM_DEG);
+#endif
+
+#ifdef IK_JACOBIAN_ENABLED
+    IncrementalIk Platform::_incrementalIk(IK_JACOBIAN_MAX_DELTA, IK_JACOBIAN_MAX_DRIFT, IK_JACOBIAN_MAX_ERROR, IK_JACOBIAN_STEP);
+#endif
+
+    // Allowed range of each pose component, in moveTo() order
+    static const int POSE_MIN[6] = {SWAY_MIN, SURGE_MIN, HEAVE_MIN, PITCH_MIN, ROLL_MIN, YAW_MIN};
+    static const int POSE_MAX[6] = {SWAY_MAX, SURGE_MAX, HEAVE_MAX, PITCH_MAX, ROLL_MAX, YAW_MAX};
+
+    const char *POSE_COMPONENT_STRINGS[] = {
+        "sway",
+        "surge",
+        "heave",
+        "pitch",
+        "roll",
+        "yaw"};
+
+    // How far a pose component is outside its allowed range, 0 if it is inside (or NaN)
+    static float outsideBy(int component, float value)
     {
+      if (value < POSE_MIN[component])
+      {
+        return POSE_MIN[component] - value;
+      }
+      if (value > POSE_MAX[component])
+      {
+        return value - POSE_MAX[component];
+      }
+      return 0;
     }
 
-    bool Platform::home(float *servoValues)
+    /**
+     * @struct AngleBounds
+     * @brief Sine and cosine of the limits of an angle, to range check a rotation matrix without its angles
+     */
+    struct AngleBounds
     {
-      return moveTo(servoValues, 0, 0, 0, 0, 0, 0); // HOME position. No rotation, no translation.
+      float sinMin, cosMin; ///< Of the lower limit
+      float sinMax, cosMax; ///< Of the upper limit
+    };
+
+    static AngleBounds angleBounds(int minDeg, int maxDeg)
+    {
+      const float degToRad = (float)(GEOMETRY_PI / 180.0);
+      const AngleBounds bounds = {sinf(minDeg * degToRad), cosf(minDeg * degToRad),
+                                  sinf(maxDeg * degToRad), cosf(maxDeg * degToRad)};
+      return bounds;
     }
 
-    bool Platform::moveTo(float *servoValues, int sway, int surge, int heave, float pitch, float roll, float yaw)
+    static const AngleBounds PITCH_BOUNDS = angleBounds(PITCH_MIN, PITCH_MAX);
+    static const AngleBounds ROLL_BOUNDS = angleBounds(ROLL_MIN, ROLL_MAX);
+    static const AngleBounds YAW_BOUNDS = angleBounds(YAW_MIN, YAW_MAX);
+
+    // Whether atan2(y, x) is within bounds, for x > 0: the sign of sin(angle - limit) is that of a cross product
+    static bool angleWithin(float y, float x, const AngleBounds &bounds)
     {
-      // Check if parameters are within allowed boundaries
-      if (sway < SWAY_MIN || sway > SWAY_MAX)
-      {
-        Log.error("Sway value %d is outside allowed range [%d, %d]", sway, SWAY_MIN, SWAY_MAX);
-        return false;
-      }
+      return x > 0 && y * bounds.cosMin - x * bounds.sinMin >= 0 && y * bounds.cosMax - x * bounds.sinMax <= 0;
+    }
 
-      if (surge < SURGE_MIN || surge > SURGE_MAX)
-      {
-        Log.error("Surge value %d is outside allowed range [%d, %d]", surge, SURGE_MIN, SURGE_MAX);
-        return false;
-      }
+    // Whether the Euler angles of a rotation (see orientation::toEuler) are within their limits, without computing them
+    static bool orientationInRange(const RotationMatrix &r)
+    {
+      const float sr = -r.m[2][0];
+      return sr >= ROLL_BOUNDS.sinMin && sr <= ROLL_BOUNDS.sinMax &&
+             angleWithin(r.m[2][1], r.m[2][2], PITCH_BOUNDS) &&
+             angleWithin(r.m[1][0], r.m[0][0], YAW_BOUNDS);
+    }
 
-      if (heave < HEAVE_MIN || heave > HEAVE_MAX)
+    Platform::Platform(int servo_min_angle, int servo_max_angle)
+        : _servo_min_angle(servo_min_angle), _servo_max_angle(servo_max_angle),
+          _kernel(servo_min_angle, servo_max_angle, _geometry.getIk()),
+          _geometryRevision(_geometry.getRevision()),
+          _diagnostics(IK_DIAGNOSTIC_INTERVAL_MS)
+#ifdef FK_ENABLED
+          ,
+          _forwardKinematics(FK_MAX_ITERATIONS, FK_TOLERANCE, FK_STEP)
+#endif
+    {
+#ifdef WORKSPACE_MAP_ENABLED
+      // Feasibility does not depend on the servo range, so any instance can check the map
+      if (_workspaceMap.needsVerify() && _geometry.isDefault() && !_workspaceMap.verify(_kernel))
       {
-        Log.error("Heave value %d is outside allowed range [%d, %d]", heave, HEAVE_MIN, HEAVE_MAX);
-        return false;
+        Log.warning("Workspace map does not match the platform geometry, regenerate it with tools/WorkspaceMapGenerator");
       }
+#endif
+    }
+
+    IkResult Platform::home(float *servoValues)
+    {
+      return moveTo(servoValues, 0, 0, 0, 0, 0, 0); // HOME position. No rotation, no translation.
+    }
+
+    IkResult Platform::moveTo(float *servoValues, int sway, int surge, int heave, float pitch, float roll, float yaw)
+    {
+      syncOrientation();
+
+      const float pose[6] = {(float)sway, (float)surge, (float)heave, pitch, roll, yaw};
 
-      if (pitch < PITCH_MIN || pitch > PITCH_MAX)
+      // Check if parameters are within allowed boundaries
+      for (int j = 0; j < 6; j++)
       {
-        Log.error("Pitch value %.2f is outside allowed range [%d, %d]", pitch, PITCH_MIN, PITCH_MAX);
-        return false;
+        const float margin = outsideBy(j, pose[j]);
+        if (margin > 0)
+        {
+          return record(IK_RESULT_OUT_OF_RANGE, j, margin);
+        }
       }
 
-      if (roll < ROLL_MIN || roll > ROLL_MAX)
+      // Early exit if we're already at the desired position, and the geometry has not changed since
+      if (_sp_sway == sway && _sp_surge == surge && _sp_heave == heave &&
+          _sp_pitch == pitch && _sp_roll == roll && _sp_yaw == yaw &&
+          _geometryRevision == _geometry.getRevision())
       {
-        Log.error("Roll value %.2f is outside allowed range [%d, %d]", roll, ROLL_MIN, ROLL_MAX);
-        return false;
+        return record(IK_RESULT_OK);
       }
 
-      if (yaw < YAW_MIN || yaw > YAW_MAX)
+#ifdef CLAMP
+      _clipRatio = 0;
+#endif
+
+#ifdef WORKSPACE_MAP_ENABLED
+      // Reject poses the map knows to be unreachable, before the cache and any trig
+      if (_workspaceMap.query(pose) == WORKSPACE_UNREACHABLE)
       {
-        Log.error("Yaw value %.2f is outside allowed range [%d, %d]", yaw, YAW_MIN, YAW_MAX);
-        return false;
+#ifdef CLAMP
+        return clampMove(servoValues, pose);
+#else
+        return record(IK_RESULT_UNREACHABLE);
+#endif
       }
+#endif
 
-      // Early exit if we're already at the desired position
-      if (_sp_sway == sway && _sp_surge == surge && _sp_heave == heave &&
-          _sp_pitch == pitch && _sp_roll == roll && _sp_yaw == yaw)
+#ifdef POSE_CACHE_ENABLED
+      // The cached angles are for the default servo range only
+      const bool cacheable = _servo_min_angle == SERVO_MIN_ANGLE && _servo_max_angle == SERVO_MAX_ANGLE;
+      if (cacheable && _poseCache.lookup(pose, servoValues))
       {
-        return true;
+        _geometryRevision = _geometry.getRevision();
+        _sp_sway = sway;
+        _sp_surge = surge;
+        _sp_heave = heave;
+        _sp_pitch = pitch;
+        _sp_roll = roll;
+        _sp_yaw = yaw;
+        return record(IK_RESULT_OK);
       }
+#endif
 
       // Store old values in case we need to revert
       float oldValues[6];
       memcpy(oldValues, servoValues, 6 * sizeof(float));
 
-      // Pre-compute trigonometric values (only calculate once)
-      const double cr = cos(radians(roll));
-      const double cp = cos(radians(pitch));
-      const double cy = cos(radians(yaw));
-      const double sr = sin(radians(roll));
-      const double sp = sin(radians(pitch));
-      const double sy = sin(radians(yaw));
+      int failedLeg = 0;
+      float value = 0;
+      IkStatus status;
 
-      // Pre-compute common products used in the loop
-      const double sp_sr = sp * sr;
-      const double cr_cy = cr * cy;
-      const double cr_sy = cr * sy;
-      const double sp_cr = sp * cr;
+#ifdef IK_JACOBIAN_ENABLED
+      // The Jacobian is shared, so it is only used with the default servo range
+      if (_servo_min_angle == SERVO_MIN_ANGLE && _servo_max_angle == SERVO_MAX_ANGLE)
+      {
+        status = _incrementalIk.solve(_kernel, servoValues, pose, failedLeg, value);
+      }
+      else
+#endif
+      {
+        status = _kernel.solve(servoValues, sway, surge, heave, pitch, roll, yaw, failedLeg, value);
+      }
 
-      // Pre-compute Z offset with rotation point adjustment
-      const double z_offset = Z_HOME + heave;
+#ifdef POSE_CACHE_ENABLED
+      // Only exact solutions are cached: neither linearized, slammed nor clipped angles are those of the requested pose
+      bool exact = status == IK_OK;
+#ifdef IK_JACOBIAN_ENABLED
+      exact = exact && !_incrementalIk.wasLinear(); // Cacheable poses go through the incremental IK
+#endif
+      if (exact && cacheable)
+      {
+        _poseCache.store(pose, servoValues);
+      }
+#endif
 
-      // Pre-compute servo angle mapping constants
-      const double angle_range = _servo_max_angle - _servo_min_angle;
-      const double mid_angle = _servo_min_angle + (angle_range / 2);
+#ifdef CLAMP
+      if (status != IK_OK)
+      {
+        memcpy(servoValues, oldValues, 6 * sizeof(float));
+        return clampMove(servoValues, pose);
+      }
+#endif
 
-      // Pre-compute squared rod length for distance comparison
-      const double rod_length_sq = pow(ROD_LENGTH, 2);
-      const double arm_length_sq = pow(ARM_LENGTH, 2);
-      const double max_reach_sq = pow(ARM_LENGTH + ROD_LENGTH, 2);
+      float margin;
+      const IkResultStatus result = classify(status, value, margin);
+      if (result <= IK_RESULT_SLAMMED)
+      {
+        // Update setpoints
+        _geometryRevision = _geometry.getRevision();
+        _sp_sway = sway;
+        _sp_surge = surge;
+        _sp_heave = heave;
+        _sp_pitch = pitch;
+        _sp_roll = roll;
+        _sp_yaw = yaw;
+      }
+      else
+      {
+        // Restore old values
+        memcpy(servoValues, oldValues, 6 * sizeof(float));
+      }
 
-      bool bOk = true;
+      return record(result, status == IK_OK ? -1 : failedLeg, margin);
+    }
 
-#ifdef USE_ENHANCED_IK
-      // Enhanced IK algorithm with adjustable rotation point and translation/rotation order
-      for (int i = 0; i < 6 && bOk; i++)
+#ifdef CLAMP
+    IkResult Platform::clampMove(float *servoValues, const float *pose)
+    {
+      const float from[6] = {(float)_sp_sway, (float)_sp_surge, (float)_sp_heave, _sp_pitch, _sp_roll, _sp_yaw};
+      float best[6];
+      memcpy(best, from, sizeof(best));
+      float candidate[6];
+      float solved[6];
+      int failedLeg;
+      float value;
+
+      // The current setpoints are reachable (t = 0), the requested pose is not (t = 1)
+      float lo = 0, hi = 1;
+      for (int i = 0; i < CLAMP_ITERATIONS; i++)
       {
-        double pivot_x, pivot_y, pivot_z;
+        const float t = (lo + hi) / 2;
+        for (int j = 0; j < 6; j++)
+        {
+          candidate[j] = from[j] + t * (pose[j] - from[j]);
+        }
+        for (int j = 0; j < 3; j++)
+        {
+          candidate[j] = (float)lroundf(candidate[j]);
+        }
 
-        // Get platform and base coordinates
-        const double px = P_COORDS[i][0];
-        const double py = P_COORDS[i][1];
-        const double bx = B_COORDS[i][0];
-        const double by = B_COORDS[i][1];
+        bool reachable = true;
+#ifdef WORKSPACE_MAP_ENABLED
+        reachable = _workspaceMap.query(candidate) != WORKSPACE_UNREACHABLE;
+#endif
+        if (reachable)
+        {
+          // Full solves: the candidates jump back and forth, which would only churn the incremental IK
+          reachable = _kernel.solve(solved, candidate[0], candidate[1], candidate[2],
+                                    candidate[3], candidate[4], candidate[5], failedLeg, value) == IK_OK;
+        }
 
-        // Apply rotation around adjustable point
-        if (TRANSLATION_FIRST)
+        if (reachable)
         {
-          // Apply translation first, then rotation
-          pivot_x = px;
-          pivot_y = py;
-          pivot_z = ROTATION_POINT_OFFSET;
-
-          // Apply rotation
-          double rotated_x = pivot_x * cr_cy + pivot_y * (sp_sr * cr - cp * sy) - pivot_z * (cp * sr + sp * sy * cr);
-          double rotated_y = pivot_x * cr_sy + pivot_y * (cp * cy + sp_sr * sy) - pivot_z * (sp * cy - cp * sr * sy);
-          double rotated_z = -pivot_x * sr + pivot_y * sp_cr + pivot_z * cp * cr;
-
-          // Apply translation
-          pivot_x = rotated_x + sway;
-          pivot_y = rotated_y + surge;
-          pivot_z = rotated_z + z_offset;
+          lo = t;
+          memcpy(best, candidate, sizeof(best));
+          memcpy(servoValues, solved, sizeof(solved));
         }
         else
         {
-          // Apply rotation first, then translation
-          pivot_x = px * cr_cy + py * (sp_sr * cr - cp * sy);
-          pivot_y = px * cr_sy + py * (cp * cy + sp_sr * sy);
-          pivot_z = -px * sr + py * sp_cr + z_offset + ROTATION_POINT_OFFSET;
-
-          // Apply translation
-          pivot_x += sway;
-          pivot_y += surge;
-          pivot_z += heave - ROTATION_POINT_OFFSET; // Adjust for rotation point offset
+          hi = t;
         }
+      }
 
-        // Calculate squared distance (avoid sqrt until necessary)
-        const double dx = pivot_x - bx;
-        const double dy = pivot_y - by;
-        const double d2 = dx * dx + dy * dy + pivot_z * pivot_z;
-
-        // Early exit if distance is physically impossible
-        if (d2 > max_reach_sq)
+      _clipRatio = 1 - lo;
+      if (lo == 0)
+      {
+        // No step towards the pose is reachable: nothing was applied, so fail with why the pose itself is not
+        const IkStatus status = _kernel.solve(solved, pose[0], pose[1], pose[2], pose[3], pose[4], pose[5],
+                                              failedLeg, value);
+        if (status == IK_OK)
         {
-          Log.error("Distance too great at servo %d: %.2f > %.2f", i, sqrt(d2), ARM_LENGTH + ROD_LENGTH);
-          bOk = false;
-          break;
+          return record(IK_RESULT_UNREACHABLE); // Only the WorkspaceMap rejects it
         }
+        float margin;
+        classify(status, value, margin);
+        // Not SLAMMED, even with SLAM: the servos hold the current setpoints
+        return record(status == IK_DISTANCE_TOO_GREAT ? IK_RESULT_DISTANCE_TOO_GREAT : IK_RESULT_ASYMPTOTIC,
+                      failedLeg, margin);
+      }
 
-        // Geometry calculations
-        const double k = d2 - (rod_length_sq - arm_length_sq);
-        const double l = 2 * ARM_LENGTH * pivot_z;
-        const double m = 2 * ARM_LENGTH * (cos(THETA_S[i]) * dx + sin(THETA_S[i]) * dy);
+      _geometryRevision = _geometry.getRevision();
+      _sp_sway = (int)best[0];
+      _sp_surge = (int)best[1];
+      _sp_heave = (int)best[2];
+      _sp_pitch = best[3];
+      _sp_roll = best[4];
+      _sp_yaw = best[5];
+      return record(IK_RESULT_CLIPPED, -1, _clipRatio);
+    }
 
-        // Check for asymptotic condition
-        const double divisor = sqrt(l * l + m * m);
-        const double k_ratio = k / divisor;
+    float Platform::getClipRatio() const
+    {
+      return _clipRatio;
+    }
+#endif
+
+    IkResult Platform::moveTo(float *servoValues, float pitch, float roll)
+    {
+      syncOrientation();
 
-        if (abs(k_ratio) >= 1)
+      // Check if parameters are within allowed boundaries
+      const float pitchMargin = outsideBy(3, pitch);
+      if (pitchMargin > 0)
+      {
+        return record(IK_RESULT_OUT_OF_RANGE, 3, pitchMargin);
+      }
+
+      const float rollMargin = outsideBy(4, roll);
+      if (rollMargin > 0)
+      {
+        return record(IK_RESULT_OUT_OF_RANGE, 4, rollMargin);
+      }
+
+#ifdef IK_LUT_ENABLED
+      // The table is built for the default servo range only
+      if (_servo_min_angle == SERVO_MIN_ANGLE && _servo_max_angle == SERVO_MAX_ANGLE)
+      {
+        // Early exit if we're already at the desired orientation
+        if (_sp_pitch == pitch && _sp_roll == roll && _geometryRevision == _geometry.getRevision())
         {
-          Log.error("Asymptotic condition at servo %d: |%.2f| >= 1", i, k_ratio);
-#ifdef SLAM
-          servoValues[i] = (k_ratio > 0) ? _servo_max_angle : _servo_min_angle;
-#else
-          bOk = false;
+          return record(IK_RESULT_OK);
+        }
+
+        if (_pitchRollTable.lookup(_kernel, servoValues, _sp_sway, _sp_surge, _sp_heave, _sp_yaw, pitch, roll))
+        {
+#ifdef CLAMP
+          _clipRatio = 0;
 #endif
-          break;
+          _geometryRevision = _geometry.getRevision();
+          _sp_pitch = pitch;
+          _sp_roll = roll;
+          return record(IK_RESULT_OK);
         }
+      }
+#endif
 
-        // Calculate servo angle
-        const double servo_rad = asin(k_ratio) - atan2(m, l); // Using atan2 is more robust
-        double servo_deg = map(degrees(servo_rad), -90, 90, _servo_min_angle, _servo_max_angle);
+      return moveTo(servoValues, _sp_sway, _sp_surge, _sp_heave, pitch, roll, _sp_yaw);
+    }
 
-        // Constrain to valid range
-        servo_deg = constrain(servo_deg, _servo_min_angle, _servo_max_angle);
-        servoValues[i] = servo_deg;
-      }
-#else
-      // Original IK algorithm
-      for (int i = 0; i < 6 && bOk; i++)
-      {
-        // Calculate platform pivot coordinates more efficiently
-        const double px = P_COORDS[i][0];
-        const double py = P_COORDS[i][1];
-        const double bx = B_COORDS[i][0];
-        const double by = B_COORDS[i][1];
-
-        // Calculate pivot coordinates with optimized expressions
-        const double pivot_x = px * cr_cy + py * (sp_sr * cr - cp * sy) + sway;
-        const double pivot_y = px * cr_sy + py * (cp * cy + sp_sr * sy) + surge;
-        const double pivot_z = -px * sr + py * sp_cr + z_offset;
-
-        // Calculate squared distance (avoid sqrt until necessary)
-        const double dx = pivot_x - bx;                          // x-distance
-        const double dy = pivot_y - by;                          // y-distance
-        const double d2 = dx * dx + dy * dy + pivot_z * pivot_z; // squared distance
-
-        // Early exit if distance is physically impossible
-        if (d2 > max_reach_sq)
-        { // (actually comparing the squared distance)
-          Log.error("Distance too great at servo %d: %.2f > %.2f", i, sqrt(d2), ARM_LENGTH + ROD_LENGTH);
-          bOk = false;
-          break;
+    IkResult Platform::moveTo(float *servoValues, int sway, int surge, int heave, const RotationMatrix &rotation)
+    {
+      const float translation[3] = {(float)sway, (float)surge, (float)heave};
+
+      // Check if parameters are within allowed boundaries
+      for (int j = 0; j < 3; j++)
+      {
+        const float margin = outsideBy(j, translation[j]);
+        if (margin > 0)
+        {
+          return record(IK_RESULT_OUT_OF_RANGE, j, margin);
         }
+      }
 
-        // Geometry calculations
-        const double k = d2 - (rod_length_sq - arm_length_sq);
-        const double l = 2 * ARM_LENGTH * pivot_z;
-        const double m = 2 * ARM_LENGTH * (cos(THETA_S[i]) * dx + sin(THETA_S[i]) * dy);
+      if (!orientationInRange(rotation))
+      {
+        // The angles are only needed to tell which one is out of range, and by how much
+        float angles[3];
+        orientation::toEuler(rotation, angles[0], angles[1], angles[2]);
+        for (int j = 0; j < 3; j++)
+        {
+          const float margin = outsideBy(3 + j, angles[j]);
+          if (margin > 0)
+          {
+            return record(IK_RESULT_OUT_OF_RANGE, 3 + j, margin);
+          }
+        }
+        return record(IK_RESULT_OUT_OF_RANGE);
+      }
 
-        // Check for asymptotic condition
-        const double divisor = sqrt(l * l + m * m); // Avoid division by zero
-        const double k_ratio = k / divisor;         // Ratio for asin calculation
+      // Early exit if we're already at the desired position, and the geometry has not changed since
+      if (_spFromRotation && _sp_sway == sway && _sp_surge == surge && _sp_heave == heave &&
+          memcmp(&_sp_rotation, &rotation, sizeof(rotation)) == 0 &&
+          _geometryRevision == _geometry.getRevision())
+      {
+        return record(IK_RESULT_OK);
+      }
 
-        if (abs(k_ratio) >= 1) // Is the ratio in the valid range for asin? If not, this is an "asymptotic condition".
-        {
-          Log.error("Asymptotic condition at servo %d: |%.2f| >= 1", i, k_ratio);
-#ifdef SLAM
-          servoValues[i] = (k_ratio > 0) ? _servo_max_angle : _servo_min_angle;
-#else
-          bOk = false;
+#ifdef CLAMP
+      _clipRatio = 0;
 #endif
-          break;
-        }
 
-        // Calculate servo angle
-        const double servo_rad = asin(k_ratio) - atan2(m, l); // Using atan2 is more robust
-        double servo_deg = map(degrees(servo_rad), -90, 90, _servo_min_angle, _servo_max_angle);
+      // Store old values in case we need to revert
+      float oldValues[6];
+      memcpy(oldValues, servoValues, 6 * sizeof(float));
+
+      // The lookup table, the cache, the map and the incremental IK all work on Euler angles, so this is always a full solve
+      int failedLeg = 0;
+      float value = 0;
+      const IkStatus status = _kernel.solve(servoValues, sway, surge, heave, rotation, failedLeg, value);
 
-        // Constrain to valid range
-        servo_deg = constrain(servo_deg, _servo_min_angle, _servo_max_angle);
-        servoValues[i] = servo_deg;
+#ifdef CLAMP
+      if (status != IK_OK)
+      {
+        // Clipping bisects between Euler poses: worth the trig, since the move failed anyway
+        memcpy(servoValues, oldValues, 6 * sizeof(float));
+        syncOrientation();
+        float pose[6] = {translation[0], translation[1], translation[2]};
+        orientation::toEuler(rotation, pose[3], pose[4], pose[5]);
+        return clampMove(servoValues, pose);
       }
 #endif
 
-      if (bOk)
+      float margin;
+      const IkResultStatus result = classify(status, value, margin);
+      if (result <= IK_RESULT_SLAMMED)
       {
-        // Update setpoints
+        // Update setpoints, the Euler angles are only recovered when asked for
+        _geometryRevision = _geometry.getRevision();
         _sp_sway = sway;
         _sp_surge = surge;
         _sp_heave = heave;
-        _sp_pitch = pitch;
-        _sp_roll = roll;
-        _sp_yaw = yaw;
-
-        // Apply AGGRO scaling more efficiently
-        for (int i = 0; i < 6; i++)
-        {
-          const double diff = servoValues[i] - mid_angle;
-          servoValues[i] = mid_angle + (diff * AGGRO);
-          servoValues[i] = constrain(servoValues[i], _servo_min_angle, _servo_max_angle);
-        }
+        _sp_rotation = rotation;
+        _spFromRotation = true;
       }
       else
       {
@@ -282,26 +458,260 @@ namespace stewy
         memcpy(servoValues, oldValues, 6 * sizeof(float));
       }
 
-      return bOk;
+      return record(result, status == IK_OK ? -1 : failedLeg, margin);
     }
 
-    bool Platform::moveTo(float *servoValues, float pitch, float roll)
+    IkResult Platform::moveTo(float *servoValues, int sway, int surge, int heave, const Quaternion &quaternion)
     {
-      // Check if parameters are within allowed boundaries
-      if (pitch < PITCH_MIN || pitch > PITCH_MAX)
+      RotationMatrix rotation;
+      orientation::fromQuaternion(quaternion, rotation);
+      return moveTo(servoValues, sway, surge, heave, rotation);
+    }
+
+    IkResultStatus Platform::classify(IkStatus status, float value, float &margin) const
+    {
+      margin = 0;
+      if (status == IK_DISTANCE_TOO_GREAT)
+      {
+        margin = value - _geometry.getIk().maxReach;
+        return IK_RESULT_DISTANCE_TOO_GREAT;
+      }
+      if (status == IK_ASYMPTOTIC)
+      {
+        margin = fabsf(value) - 1;
+#ifdef SLAM
+        return IK_RESULT_SLAMMED; // The failing servo was slammed to its limit
+#else
+        return IK_RESULT_ASYMPTOTIC;
+#endif
+      }
+      return IK_RESULT_OK;
+    }
+
+    void Platform::getState(PlatformState &state)
+    {
+      state.sway = _sp_sway;
+      state.surge = _sp_surge;
+      state.heave = _sp_heave;
+      state.pitch = _sp_pitch;
+      state.roll = _sp_roll;
+      state.yaw = _sp_yaw;
+      state.rotation = _sp_rotation;
+      state.fromRotation = _spFromRotation;
+      state.geometryCurrent = _geometryRevision == _geometry.getRevision();
+#ifdef CLAMP
+      state.clipRatio = _clipRatio;
+#else
+      state.clipRatio = 0;
+#endif
+    }
+
+    void Platform::setState(const PlatformState &state)
+    {
+      _sp_sway = state.sway;
+      _sp_surge = state.surge;
+      _sp_heave = state.heave;
+      _sp_pitch = state.pitch;
+      _sp_roll = state.roll;
+      _sp_yaw = state.yaw;
+      _sp_rotation = state.rotation;
+      _spFromRotation = state.fromRotation;
+      // Any other revision makes the next move solve again, as it would have
+      _geometryRevision = state.geometryCurrent ? _geometry.getRevision() : (uint16_t)(_geometry.getRevision() - 1);
+#ifdef CLAMP
+      _clipRatio = state.clipRatio;
+#endif
+    }
+
+    void Platform::syncOrientation()
+    {
+      if (_spFromRotation)
+      {
+        orientation::toEuler(_sp_rotation, _sp_pitch, _sp_roll, _sp_yaw);
+        _spFromRotation = false;
+      }
+    }
+
+    IkResult Platform::record(IkResultStatus status, int leg, float margin)
+    {
+      const IkResult result = {(uint8_t)status, (int8_t)leg, margin};
+      _diagnostics.record(result);
+      return result;
+    }
+
+    void Platform::reportDiagnostics()
+    {
+      unsigned long failures;
+      IkResult last;
+      if (!_diagnostics.takeReport(millis(), failures, last))
+      {
+        return;
+      }
+
+      const char *status = IkDiagnostics::getStatusString((IkResultStatus)last.status);
+      if (last.status == IK_RESULT_OUT_OF_RANGE && last.leg >= 0)
+      {
+        Log.error("%lu pose(s) rejected, last: %s, %s by %.2f", failures, status, POSE_COMPONENT_STRINGS[last.leg], last.margin);
+      }
+      else if (last.leg >= 0)
+      {
+        Log.error("%lu pose(s) rejected, last: %s at servo %d by %.2f", failures, status, last.leg, last.margin);
+      }
+      else
+      {
+        Log.error("%lu pose(s) rejected, last: %s", failures, status);
+      }
+    }
+
+    const IkDiagnostics &Platform::getDiagnostics() const
+    {
+      return _diagnostics;
+    }
+
+    size_t Platform::solveBatch(const Pose *poses, size_t n, ServoFrameSoA &out, FeasibilityMask &mask) const
+    {
+      size_t feasible = _kernel.solveBatch(poses, n, out, mask);
+
+      for (size_t k = 0; k < n && k < out.capacity && k < mask.capacity; k++)
+      {
+        const Pose &p = poses[k];
+        const bool inside = p.sway >= SWAY_MIN && p.sway <= SWAY_MAX && p.surge >= SURGE_MIN && p.surge <= SURGE_MAX &&
+                            p.heave >= HEAVE_MIN && p.heave <= HEAVE_MAX && p.pitch >= PITCH_MIN && p.pitch <= PITCH_MAX &&
+                            p.roll >= ROLL_MIN && p.roll <= ROLL_MAX && p.yaw >= YAW_MIN && p.yaw <= YAW_MAX;
+        if (!inside && mask.test(k))
+        {
+          mask.set(k, false);
+          feasible--;
+        }
+      }
+
+      return feasible;
+    }
+
+#ifdef WORKSPACE_MAP_ENABLED
+    WorkspaceStatus Platform::checkPose(int sway, int surge, int heave, float pitch, float roll, float yaw) const
+    {
+      const float pose[6] = {(float)sway, (float)surge, (float)heave, pitch, roll, yaw};
+      return _workspaceMap.query(pose);
+    }
+#endif
+
+    const GeometryProfile &Platform::getGeometry()
+    {
+      return _geometry;
+    }
+
+    bool Platform::setGeometryParam(const char *name, double value)
+    {
+      if (!_geometry.setParam(name, value))
       {
-        Log.error("Pitch value %.2f is outside allowed range [%d, %d]", pitch, PITCH_MIN, PITCH_MAX);
         return false;
       }
+      geometryChanged();
+      return true;
+    }
 
-      if (roll < ROLL_MIN || roll > ROLL_MAX)
+    void Platform::resetGeometry()
+    {
+      _geometry.reset();
+      geometryChanged();
+    }
+
+    bool Platform::loadGeometry()
+    {
+      GeometryRecord record;
+      hal::storeGet(GEOMETRY_EEPROM_ADDR, record);
+
+      if (!setGeometry(record))
       {
-        Log.error("Roll value %.2f is outside allowed range [%d, %d]", roll, ROLL_MIN, ROLL_MAX);
         return false;
       }
+      Log.info("Loaded platform geometry from EEPROM");
+      return true;
+    }
 
-      return moveTo(servoValues, _sp_sway, _sp_surge, _sp_heave, pitch, roll, _sp_yaw);
+    bool Platform::setGeometry(const GeometryRecord &record)
+    {
+      if (!_geometry.fromRecord(record))
+      {
+        return false;
+      }
+      geometryChanged();
+      return true;
+    }
+
+    void Platform::saveGeometry()
+    {
+      GeometryRecord record;
+      _geometry.toRecord(record);
+      hal::storePut(GEOMETRY_EEPROM_ADDR, record);
+      Log.info("Saved platform geometry to EEPROM");
+    }
+
+    void Platform::invalidateCaches()
+    {
+#ifdef IK_LUT_ENABLED
+      _pitchRollTable.invalidate();
+#endif
+
+#ifdef IK_JACOBIAN_ENABLED
+      _incrementalIk.invalidate();
+#endif
+
+#ifdef POSE_CACHE_ENABLED
+      _poseCache.invalidate();
+#endif
+    }
+
+    void Platform::geometryChanged()
+    {
+      invalidateCaches();
+
+#ifdef WORKSPACE_MAP_ENABLED
+      // The map was generated for the default geometry, and may pass its probe check for a slightly different one
+      _workspaceMap.invalidate();
+      if (_geometry.isDefault())
+      {
+        const IkKernel<ik_scalar_t> kernel(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, _geometry.getIk());
+        _workspaceMap.verify(kernel);
+      }
+      else
+      {
+        Log.warning("Workspace map disabled, it only holds for the geometry in PlatformGeometry.h");
+      }
+#endif
+    }
+
+#ifdef IK_LUT_ENABLED
+    PitchRollTable &Platform::getPitchRollTable()
+    {
+      return _pitchRollTable;
     }
+#endif
+
+#ifdef POSE_CACHE_ENABLED
+    PoseCache &Platform::getPoseCache()
+    {
+      return _poseCache;
+    }
+#endif
+
+#ifdef FK_ENABLED
+    bool Platform::estimatePose(const float *servoPositions, float *pose)
+    {
+      return _forwardKinematics.estimate(_kernel, servoPositions, pose);
+    }
+
+    const float *Platform::getEstimatedPose() const
+    {
+      return _forwardKinematics.getPose();
+    }
+
+    const FkStats &Platform::getFkStats() const
+    {
+      return _forwardKinematics.getStats();
+    }
+#endif
 
     int Platform::getSway()
     {
@@ -320,16 +730,19 @@ namespace stewy
 
     float Platform::getPitch()
     {
+      syncOrientation();
       return _sp_pitch;
     }
 
     float Platform::getRoll()
     {
+      syncOrientation();
       return _sp_roll;
     }
 
     float Platform::getYaw()
     {
+      syncOrientation();
       return _sp_yaw;
     }
 
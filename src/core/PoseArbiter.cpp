@@ -0,0 +1,294 @@
+/**
+ * @file PoseArbiter.cpp
+ * @brief Implementation of the pose request arbitration
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/PoseArbiter.h"
+#include <math.h>
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    const char *SOURCE_STRINGS[] = {
+        "COMMAND_LINE",
+        "NUNCHUCK",
+        "TOUCHSCREEN"};
+
+    PoseArbiter::PoseArbiter(Platform &platform)
+        : _platform(platform)
+#ifdef POSE_INTERPOLATION_ENABLED
+          ,
+          _interpolator(POSE_MAX_SPEED_MM, POSE_MAX_ACCEL_MM, POSE_MAX_SPEED_DEG, POSE_MAX_ACCEL_DEG)
+#endif
+    {
+      memset(_requests, 0, sizeof(_requests));
+      memset(&_stats, 0, sizeof(_stats));
+#ifdef POSE_INTERPOLATION_ENABLED
+      stopAtPlatform();
+#endif
+    }
+
+    void PoseArbiter::submit(PoseSource source, uint8_t priority, const Pose &pose, uint8_t axes, float weight)
+    {
+      PoseRequest &request = _requests[source];
+      if (request.axes != 0)
+      {
+        _stats.replaced[source]++;
+      }
+      _stats.submitted[source]++;
+
+      request.pose[0] = pose.sway;
+      request.pose[1] = pose.surge;
+      request.pose[2] = pose.heave;
+      request.pose[3] = pose.pitch;
+      request.pose[4] = pose.roll;
+      request.pose[5] = pose.yaw;
+      request.axes = axes & AXIS_ALL;
+      request.priority = priority;
+      request.weight = weight;
+    }
+
+    void PoseArbiter::submitPitchRoll(PoseSource source, uint8_t priority, float pitch, float roll)
+    {
+      const Pose pose = {0, 0, 0, pitch, roll, 0};
+      submit(source, priority, pose, AXIS_PITCH | AXIS_ROLL);
+    }
+
+    void PoseArbiter::submitHome(PoseSource source, uint8_t priority)
+    {
+      const Pose home = {0, 0, 0, 0, 0, 0};
+      submit(source, priority, home);
+    }
+
+    bool PoseArbiter::update(float *servoValues)
+    {
+#ifdef POSE_INTERPOLATION_ENABLED
+      float target[6];
+      memcpy(target, _target, sizeof(target));
+#else
+      float target[6] = {(float)_platform.getSway(), (float)_platform.getSurge(), (float)_platform.getHeave(),
+                         _platform.getPitch(), _platform.getRoll(), _platform.getYaw()};
+#endif
+      uint8_t resolved = 0;
+      bool won[SOURCE_COUNT] = {false};
+
+      for (int j = 0; j < 6; j++)
+      {
+        const uint8_t bit = 1 << j;
+
+        int best = -1;
+        for (int s = 0; s < SOURCE_COUNT; s++)
+        {
+          if ((_requests[s].axes & bit) && _requests[s].priority > best)
+          {
+            best = _requests[s].priority;
+          }
+        }
+        if (best < 0)
+        {
+          continue;
+        }
+
+        float sum = 0, weights = 0;
+        for (int s = 0; s < SOURCE_COUNT; s++)
+        {
+          const PoseRequest &request = _requests[s];
+          if ((request.axes & bit) && request.priority == best)
+          {
+            sum += request.weight * request.pose[j];
+            weights += request.weight;
+            won[s] = true;
+          }
+        }
+        if (weights > 0)
+        {
+          target[j] = sum / weights;
+          resolved |= bit;
+        }
+      }
+
+      for (int s = 0; s < SOURCE_COUNT; s++)
+      {
+        if (_requests[s].axes != 0)
+        {
+          if (won[s])
+          {
+            _stats.applied[s]++;
+          }
+          else
+          {
+            _stats.overruled[s]++;
+          }
+          _requests[s].axes = 0;
+        }
+      }
+
+#ifdef POSE_INTERPOLATION_ENABLED
+      if (resolved != 0)
+      {
+        Quaternion orientation;
+        orientation::fromEuler(target[3], target[4], target[5], orientation);
+        _interpolator.setTarget(target, orientation);
+        memcpy(_target, target, sizeof(_target));
+      }
+      else if (_interpolator.isSettled())
+      {
+        return false;
+      }
+
+      float translation[3];
+      Quaternion orientation;
+      _interpolator.step(CONTROL_INTERVAL_US * 1e-6f, translation, orientation);
+
+      // The platform keeps translations in whole mm
+      const int sway = (int)lroundf(translation[0]);
+      const int surge = (int)lroundf(translation[1]);
+      const int heave = (int)lroundf(translation[2]);
+
+      _stats.solves++;
+      IkResult result;
+      if (_interpolator.isSettled())
+      {
+        // At the target: solve it in Euler angles, so the lookup table, the workspace map, the pose cache and the
+        // incremental IK apply
+        result = moveToTarget(servoValues);
+      }
+      else if (sway == _platform.getSway() && surge == _platform.getSurge() && heave == _platform.getHeave() &&
+               _target[5] == _platform.getYaw())
+      {
+        // Only pitch and roll are moving, as when balancing the ball: the lookup table applies. The yaw the
+        // interpolation picks up on the way is left out; it is back to the target at the end.
+        RotationMatrix rotation;
+        float pitch, roll, yaw;
+        orientation::fromQuaternion(orientation, rotation);
+        orientation::toEuler(rotation, pitch, roll, yaw);
+        result = _platform.moveTo(servoValues, pitch, roll);
+      }
+      else
+      {
+        result = _platform.moveTo(servoValues, sway, surge, heave, orientation);
+      }
+      if (!result.ok())
+      {
+        stopAtPlatform();
+      }
+#else
+      if (resolved == 0)
+      {
+        return false;
+      }
+
+      _stats.solves++;
+      IkResult result;
+      if ((resolved & ~(AXIS_PITCH | AXIS_ROLL)) == 0)
+      {
+        result = _platform.moveTo(servoValues, target[3], target[4]);
+      }
+      else
+      {
+        // The platform keeps translations in whole mm
+        result = _platform.moveTo(servoValues, (int)lroundf(target[0]), (int)lroundf(target[1]), (int)lroundf(target[2]),
+                                  target[3], target[4], target[5]);
+      }
+#endif
+
+      if (!result.ok())
+      {
+        _stats.failures++;
+      }
+      return result.ok();
+    }
+
+    bool PoseArbiter::isSettled() const
+    {
+#ifdef POSE_INTERPOLATION_ENABLED
+      return _interpolator.isSettled();
+#else
+      return true;
+#endif
+    }
+
+#ifdef POSE_INTERPOLATION_ENABLED
+    IkResult PoseArbiter::moveToTarget(float *servoValues)
+    {
+      const int sway = (int)lroundf(_target[0]);
+      const int surge = (int)lroundf(_target[1]);
+      const int heave = (int)lroundf(_target[2]);
+      if (sway == _platform.getSway() && surge == _platform.getSurge() && heave == _platform.getHeave() &&
+          _target[5] == _platform.getYaw())
+      {
+        return _platform.moveTo(servoValues, _target[3], _target[4]);
+      }
+      return _platform.moveTo(servoValues, sway, surge, heave, _target[3], _target[4], _target[5]);
+    }
+
+    void PoseArbiter::stopAtPlatform()
+    {
+      _target[0] = _platform.getSway();
+      _target[1] = _platform.getSurge();
+      _target[2] = _platform.getHeave();
+      _target[3] = _platform.getPitch();
+      _target[4] = _platform.getRoll();
+      _target[5] = _platform.getYaw();
+
+      Quaternion orientation;
+      orientation::fromEuler(_target[3], _target[4], _target[5], orientation);
+      _interpolator.reset(_target, orientation);
+    }
+#endif
+
+    Platform &PoseArbiter::getPlatform()
+    {
+      return _platform;
+    }
+
+    void PoseArbiter::getState(PoseArbiterState &state) const
+    {
+      memcpy(state.requests, _requests, sizeof(_requests));
+#ifdef POSE_INTERPOLATION_ENABLED
+      _interpolator.getState(state.interpolator);
+      memcpy(state.target, _target, sizeof(_target));
+#endif
+    }
+
+    void PoseArbiter::setState(const PoseArbiterState &state)
+    {
+      memcpy(_requests, state.requests, sizeof(_requests));
+#ifdef POSE_INTERPOLATION_ENABLED
+      _interpolator.setState(state.interpolator);
+      memcpy(_target, state.target, sizeof(_target));
+#endif
+    }
+
+    const PoseArbiterStats &PoseArbiter::getStats() const
+    {
+      return _stats;
+    }
+
+    const char *PoseArbiter::getSourceString(PoseSource source)
+    {
+      return SOURCE_STRINGS[source];
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,171 @@
+/**
+ * @file PoseCache.cpp
+ * @brief Implementation of the quantized pose cache
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/PoseCache.h"
+#include <math.h>
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    PoseCache::PoseCache(PoseCacheEntry *entries, size_t capacity, float quantumMm, float quantumDeg)
+        : _entries(entries), _capacity(capacity), _clock(0), _hits(0), _misses(0)
+    {
+      for (int j = 0; j < 6; j++)
+      {
+        _quantum[j] = (j < 3) ? quantumMm : quantumDeg;
+      }
+      invalidate();
+    }
+
+    bool PoseCache::lookup(const float *pose, float *servoValues)
+    {
+      int32_t key[6];
+      quantize(pose, key);
+
+      PoseCacheEntry *entry = find(key);
+      if (entry == nullptr)
+      {
+        _misses++;
+        return false;
+      }
+
+      memcpy(servoValues, entry->servoValues, sizeof(entry->servoValues));
+      tick(*entry);
+      _hits++;
+      return true;
+    }
+
+    void PoseCache::store(const float *pose, const float *servoValues)
+    {
+      if (_capacity == 0)
+      {
+        return;
+      }
+
+      int32_t key[6];
+      quantize(pose, key);
+
+      PoseCacheEntry *entry = find(key);
+      if (entry == nullptr)
+      {
+        // Empty entries have lastUse 0, so they are taken before any entry in use
+        entry = &_entries[0];
+        for (size_t i = 1; i < _capacity; i++)
+        {
+          if (_entries[i].lastUse < entry->lastUse)
+          {
+            entry = &_entries[i];
+          }
+        }
+        memcpy(entry->key, key, sizeof(entry->key));
+      }
+
+      memcpy(entry->servoValues, servoValues, sizeof(entry->servoValues));
+      tick(*entry);
+    }
+
+    void PoseCache::invalidate()
+    {
+      for (size_t i = 0; i < _capacity; i++)
+      {
+        _entries[i].lastUse = 0;
+      }
+      _clock = 0;
+    }
+
+    void PoseCache::resetStats()
+    {
+      _hits = 0;
+      _misses = 0;
+    }
+
+    unsigned long PoseCache::getHits() const
+    {
+      return _hits;
+    }
+
+    unsigned long PoseCache::getMisses() const
+    {
+      return _misses;
+    }
+
+    size_t PoseCache::getSize() const
+    {
+      size_t size = 0;
+      for (size_t i = 0; i < _capacity; i++)
+      {
+        if (_entries[i].lastUse != 0)
+        {
+          size++;
+        }
+      }
+      return size;
+    }
+
+    size_t PoseCache::getCapacity() const
+    {
+      return _capacity;
+    }
+
+    void PoseCache::quantize(const float *pose, int32_t *key) const
+    {
+      for (int j = 0; j < 6; j++)
+      {
+        key[j] = (int32_t)lroundf(pose[j] / _quantum[j]);
+      }
+    }
+
+    PoseCacheEntry *PoseCache::find(const int32_t *key)
+    {
+      for (size_t i = 0; i < _capacity; i++)
+      {
+        PoseCacheEntry &entry = _entries[i];
+        if (entry.lastUse != 0 && memcmp(entry.key, key, sizeof(entry.key)) == 0)
+        {
+          return &entry;
+        }
+      }
+      return nullptr;
+    }
+
+    void PoseCache::tick(PoseCacheEntry &entry)
+    {
+      if (++_clock == 0)
+      {
+        // The counter wrapped: keep the entries, but forget their order
+        for (size_t i = 0; i < _capacity; i++)
+        {
+          if (_entries[i].lastUse != 0)
+          {
+            _entries[i].lastUse = 1;
+          }
+        }
+        _clock = 1;
+      }
+      entry.lastUse = _clock;
+    }
+
+  } // namespace core
+} // namespace stewy
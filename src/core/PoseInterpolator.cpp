@@ -0,0 +1,265 @@
+/**
+ * @file PoseInterpolator.cpp
+ * @brief Implementation of the pose-space motion
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/PoseInterpolator.h"
+#include <math.h>
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    // Below this, slerp degenerates to a normalized lerp
+    static const float MIN_SIN_ARC = 1e-4f;
+
+    static float norm3(const float *v)
+    {
+      return sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    }
+
+    PoseInterpolator::PoseInterpolator(float maxSpeedMm, float maxAccelMm, float maxSpeedDeg, float maxAccelDeg)
+        : _maxSpeedMm(maxSpeedMm), _maxAccelMm(maxAccelMm), _maxSpeedDeg(maxSpeedDeg), _maxAccelDeg(maxAccelDeg)
+    {
+      const float home[3] = {0, 0, 0};
+      const Quaternion level = {1, 0, 0, 0};
+      reset(home, level);
+    }
+
+    void PoseInterpolator::reset(const float *translation, const Quaternion &orientation)
+    {
+      memcpy(_from, translation, sizeof(_from));
+      memcpy(_to, translation, sizeof(_to));
+      memcpy(_current, translation, sizeof(_current));
+      _fromQ = _toQ = _targetQ = _currentQ = orientation;
+      _arc = 0;
+      _sinArc = 0;
+      memset(_delta, 0, sizeof(_delta));
+      _maxSpeed = 0;
+      _maxAccel = 0;
+      _s = 1;
+      _speed = 0;
+    }
+
+    void PoseInterpolator::setTarget(const float *translation, const Quaternion &orientation)
+    {
+      if (memcmp(translation, _to, sizeof(_to)) == 0 && memcmp(&orientation, &_targetQ, sizeof(_targetQ)) == 0)
+      {
+        return;
+      }
+
+      // Velocity of the previous segment, in the same units as _delta
+      float velocity[6];
+      for (int j = 0; j < 6; j++)
+      {
+        velocity[j] = _speed * _delta[j];
+      }
+
+      memcpy(_from, _current, sizeof(_from));
+      memcpy(_to, translation, sizeof(_to));
+      _fromQ = _currentQ;
+      _targetQ = orientation;
+
+      // Take the shorter way round: q and -q are the same orientation
+      _toQ = orientation;
+      float dot = _fromQ.w * _toQ.w + _fromQ.x * _toQ.x + _fromQ.y * _toQ.y + _fromQ.z * _toQ.z;
+      if (dot < 0)
+      {
+        _toQ.w = -_toQ.w;
+        _toQ.x = -_toQ.x;
+        _toQ.y = -_toQ.y;
+        _toQ.z = -_toQ.z;
+        dot = -dot;
+      }
+      _arc = acosf(dot > 1 ? 1 : dot);
+      _sinArc = sinf(_arc);
+
+      // Rotation vector of the segment, in base coordinates: the vector part of toQ * conj(fromQ), scaled to degrees
+      const float rotation[3] = {
+          _fromQ.w * _toQ.x - _toQ.w * _fromQ.x - (_toQ.y * _fromQ.z - _toQ.z * _fromQ.y),
+          _fromQ.w * _toQ.y - _toQ.w * _fromQ.y - (_toQ.z * _fromQ.x - _toQ.x * _fromQ.z),
+          _fromQ.w * _toQ.z - _toQ.w * _fromQ.z - (_toQ.x * _fromQ.y - _toQ.y * _fromQ.x)};
+      const float degrees = (float)(2 * _arc * 180.0 / GEOMETRY_PI);
+      const float toDegrees = _sinArc > MIN_SIN_ARC ? degrees / _sinArc : (float)(2 * 180.0 / GEOMETRY_PI);
+
+      const float change[3] = {_to[0] - _from[0], _to[1] - _from[1], _to[2] - _from[2]};
+      for (int j = 0; j < 3; j++)
+      {
+        _delta[j] = change[j] / _maxSpeedMm;
+        _delta[3 + j] = rotation[j] * toDegrees / _maxSpeedDeg;
+      }
+
+      // The tighter of the translation and rotation limits, for the length of this segment
+      const float lengthMm = norm3(change);
+      const float speedTime = fmaxf(lengthMm / _maxSpeedMm, degrees / _maxSpeedDeg);
+      const float accelTime = fmaxf(lengthMm / _maxAccelMm, degrees / _maxAccelDeg);
+      if (speedTime <= 0 || accelTime <= 0)
+      {
+        // Nowhere to go
+        _maxSpeed = 0;
+        _maxAccel = 0;
+        _s = 1;
+        _speed = 0;
+        memset(_delta, 0, sizeof(_delta));
+        return;
+      }
+      _maxSpeed = 1 / speedTime;
+      _maxAccel = 1 / accelTime;
+
+      // Keep the part of the previous velocity that goes the new way
+      float along = 0, lengthSq = 0;
+      for (int j = 0; j < 6; j++)
+      {
+        along += velocity[j] * _delta[j];
+        lengthSq += _delta[j] * _delta[j];
+      }
+      const float speed = along / lengthSq;
+      _speed = speed < 0 ? 0 : (speed > _maxSpeed ? _maxSpeed : speed);
+      _s = 0;
+    }
+
+    void PoseInterpolator::step(float dt, float *translation, Quaternion &orientation)
+    {
+      if (_s < 1)
+      {
+        // Fastest speed from which the target can still be reached at rest
+        const float stopping = sqrtf(2 * _maxAccel * (1 - _s));
+        const float wanted = stopping < _maxSpeed ? stopping : _maxSpeed;
+        if (_speed < wanted)
+        {
+          _speed = fminf(_speed + _maxAccel * dt, wanted);
+        }
+        else
+        {
+          _speed = fmaxf(_speed - _maxAccel * dt, wanted);
+        }
+
+        _s += _speed * dt;
+        if (_s >= 1)
+        {
+          _s = 1;
+          _speed = 0;
+        }
+        evaluate(_s, _current, _currentQ);
+      }
+
+      memcpy(translation, _current, sizeof(_current));
+      orientation = _currentQ;
+    }
+
+    bool PoseInterpolator::isSettled() const
+    {
+      return _s >= 1;
+    }
+
+    float PoseInterpolator::getSpeedFraction() const
+    {
+      return _maxSpeed > 0 ? _speed / _maxSpeed : 0;
+    }
+
+    void PoseInterpolator::getState(PoseInterpolatorState &state) const
+    {
+      for (int i = 0; i < 3; i++)
+      {
+        state.from[i] = _from[i];
+        state.to[i] = _to[i];
+        state.current[i] = _current[i];
+      }
+      for (int i = 0; i < 6; i++)
+      {
+        state.delta[i] = _delta[i];
+      }
+      state.fromQ = _fromQ;
+      state.toQ = _toQ;
+      state.targetQ = _targetQ;
+      state.currentQ = _currentQ;
+      state.arc = _arc;
+      state.sinArc = _sinArc;
+      state.maxSpeed = _maxSpeed;
+      state.maxAccel = _maxAccel;
+      state.s = _s;
+      state.speed = _speed;
+    }
+
+    void PoseInterpolator::setState(const PoseInterpolatorState &state)
+    {
+      for (int i = 0; i < 3; i++)
+      {
+        _from[i] = state.from[i];
+        _to[i] = state.to[i];
+        _current[i] = state.current[i];
+      }
+      for (int i = 0; i < 6; i++)
+      {
+        _delta[i] = state.delta[i];
+      }
+      _fromQ = state.fromQ;
+      _toQ = state.toQ;
+      _targetQ = state.targetQ;
+      _currentQ = state.currentQ;
+      _arc = state.arc;
+      _sinArc = state.sinArc;
+      _maxSpeed = state.maxSpeed;
+      _maxAccel = state.maxAccel;
+      _s = state.s;
+      _speed = state.speed;
+    }
+
+    void PoseInterpolator::evaluate(float s, float *translation, Quaternion &orientation) const
+    {
+      if (s >= 1)
+      {
+        memcpy(translation, _to, sizeof(_to));
+        orientation = _targetQ;
+        return;
+      }
+
+      for (int j = 0; j < 3; j++)
+      {
+        translation[j] = _from[j] + s * (_to[j] - _from[j]);
+      }
+
+      float a, b;
+      if (_sinArc > MIN_SIN_ARC)
+      {
+        a = sinf((1 - s) * _arc) / _sinArc;
+        b = sinf(s * _arc) / _sinArc;
+      }
+      else
+      {
+        a = 1 - s;
+        b = s;
+      }
+      Quaternion q = {a * _fromQ.w + b * _toQ.w, a * _fromQ.x + b * _toQ.x,
+                      a * _fromQ.y + b * _toQ.y, a * _fromQ.z + b * _toQ.z};
+
+      // Exact for slerp, but keeps the lerp fallback and the rounding on the unit sphere
+      const float n = sqrtf(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+      q.w /= n;
+      q.x /= n;
+      q.y /= n;
+      q.z /= n;
+      orientation = q;
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,94 @@
+/**
+ * @file Profiler.cpp
+ * @brief Implementation of the per-stage profiler
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/Profiler.h"
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    const char *STAGE_STRINGS[] = {
+        "shell",
+        "nunchuck",
+        "touch read",
+        "filter",
+        "pid",
+        "ik",
+        "servo write",
+        "estimate"};
+
+    Profiler::Profiler(uint32_t (*counter)(), uint32_t cyclesPerUs)
+        : _counter(counter), _cyclesPerUs(cyclesPerUs)
+    {
+      reset();
+    }
+
+    void Profiler::record(ProfileStage stage, uint32_t cycles)
+    {
+      StageStats &stats = _stats[stage];
+      stats.count++;
+      stats.totalCycles += cycles;
+      if (cycles < stats.minCycles)
+      {
+        stats.minCycles = cycles;
+      }
+      if (cycles > stats.maxCycles)
+      {
+        stats.maxCycles = cycles;
+      }
+      stats.histogram[getBucket(cycles)]++;
+    }
+
+    const StageStats &Profiler::getStats(ProfileStage stage) const
+    {
+      return _stats[stage];
+    }
+
+    void Profiler::reset()
+    {
+      memset(_stats, 0, sizeof(_stats));
+      for (int i = 0; i < STAGE_COUNT; i++)
+      {
+        _stats[i].minCycles = UINT32_MAX;
+      }
+    }
+
+    float Profiler::toMicroseconds(double cycles) const
+    {
+      return (float)(cycles / _cyclesPerUs);
+    }
+
+    int Profiler::getBucket(uint32_t cycles)
+    {
+      // Index of the highest bit set, one instruction (CLZ) on the Cortex-M4
+      return cycles == 0 ? 0 : 31 - __builtin_clz(cycles);
+    }
+
+    const char *Profiler::getStageString(ProfileStage stage)
+    {
+      return STAGE_STRINGS[stage];
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,238 @@
+/**
+ * @file Recorder.cpp
+ * @brief Implementation of the recorder of the loop inputs
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/Recorder.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    const char *RECORD_TYPE_STRINGS[] = {
+        "time",
+        "touch",
+        "nunchuck",
+        "ball control",
+        "control",
+        "estimate",
+        "keyframe",
+        "state",
+        "data"};
+
+    const char *RECORD_KEYFRAME_REASON_STRINGS[] = {
+        "start",
+        "periodic",
+        "change"};
+
+    Recorder::Recorder(RecordEntry *buffer, int capacity, uint32_t keyframeIntervalUs)
+        : _buffer(buffer), _capacity(capacity), _oldest(0), _count(0), _overwritten(0),
+          _firstUs(0), _lastUs(0), _recording(false), _keyframeIntervalUs(keyframeIntervalUs), _keyframeUs(0),
+          _keyframeRequested(false), _keyframeReason(RECORD_KEYFRAME_START)
+    {
+    }
+
+    void Recorder::start()
+    {
+      _oldest = 0;
+      _count = 0;
+      _overwritten = 0;
+      _recording = true;
+      requestKeyframe(RECORD_KEYFRAME_START);
+    }
+
+    void Recorder::stop()
+    {
+      _recording = false;
+    }
+
+    bool Recorder::isRecording() const
+    {
+      return _recording;
+    }
+
+    void Recorder::record(RecordType type, uint32_t timeUs, int16_t a, int16_t b, uint8_t flags)
+    {
+      if (!_recording || _capacity < 2)
+      {
+        return;
+      }
+
+      uint32_t delta = timeUs - _lastUs;
+      if (_count == 0 || delta > 0xFFFF)
+      {
+        // The first entry, or a gap too long for a delta: give the time in full
+        RecordEntry time = {0, RECORD_TIME, 0, (int16_t)(timeUs >> 16), (int16_t)(timeUs & 0xFFFF)};
+        if (_count == 0)
+        {
+          _firstUs = timeUs;
+        }
+        append(time);
+        delta = 0;
+      }
+
+      RecordEntry entry = {(uint16_t)delta, (uint8_t)type, flags, a, b};
+      append(entry);
+      _lastUs = timeUs;
+    }
+
+    void Recorder::requestKeyframe(RecordKeyframeReason reason)
+    {
+      // The keyframe that starts the record stays one, whatever else asks before it is recorded
+      if (!_keyframeRequested || _keyframeReason != RECORD_KEYFRAME_START)
+      {
+        _keyframeReason = reason;
+      }
+      _keyframeRequested = true;
+    }
+
+    bool Recorder::isKeyframeDue(uint32_t timeUs) const
+    {
+      if (!_recording)
+      {
+        return false;
+      }
+      return _keyframeRequested || (_keyframeIntervalUs > 0 && timeUs - _keyframeUs >= _keyframeIntervalUs);
+    }
+
+    void Recorder::recordKeyframe(uint32_t timeUs, int states)
+    {
+      record(RECORD_KEYFRAME, timeUs, (int16_t)states, 0,
+             _keyframeRequested ? _keyframeReason : (uint8_t)RECORD_KEYFRAME_PERIODIC);
+      _keyframeRequested = false;
+      _keyframeUs = timeUs;
+    }
+
+    void Recorder::recordState(RecordState state, uint32_t timeUs, const void *data, uint16_t size)
+    {
+      record(RECORD_STATE, timeUs, (int16_t)size, 0, (uint8_t)state);
+
+      // Five bytes to an entry, the last one padded with zeros
+      const uint8_t *bytes = (const uint8_t *)data;
+      for (uint16_t i = 0; i < size; i += RECORD_DATA_BYTES)
+      {
+        uint8_t chunk[RECORD_DATA_BYTES] = {0, 0, 0, 0, 0};
+        for (int j = 0; j < RECORD_DATA_BYTES && i + j < size; j++)
+        {
+          chunk[j] = bytes[i + j];
+        }
+        record(RECORD_DATA, timeUs, (int16_t)(chunk[1] | (chunk[2] << 8)), (int16_t)(chunk[3] | (chunk[4] << 8)),
+               chunk[0]);
+      }
+    }
+
+    void Recorder::append(const RecordEntry &entry)
+    {
+      if (_count < _capacity)
+      {
+        _buffer[(_oldest + _count) % _capacity] = entry;
+        _count++;
+        return;
+      }
+
+      // Full: the second oldest becomes the oldest, and its time the first time
+      const RecordEntry &next = _buffer[(_oldest + 1) % _capacity];
+      if (next.type == RECORD_TIME)
+      {
+        _firstUs = ((uint32_t)(uint16_t)next.a << 16) | (uint16_t)next.b;
+      }
+      else
+      {
+        _firstUs += next.deltaUs;
+      }
+      _buffer[_oldest] = entry;
+      _oldest = (_oldest + 1) % _capacity;
+      _overwritten++;
+    }
+
+    int Recorder::getCount() const
+    {
+      return _count;
+    }
+
+    int Recorder::getCapacity() const
+    {
+      return _capacity;
+    }
+
+    unsigned long Recorder::getOverwritten() const
+    {
+      return _overwritten;
+    }
+
+    const RecordEntry &Recorder::getEntry(int index) const
+    {
+      return _buffer[(_oldest + index) % _capacity];
+    }
+
+    uint32_t Recorder::getFirstTime() const
+    {
+      return _firstUs;
+    }
+
+    uint32_t Recorder::getLastTime() const
+    {
+      return _lastUs;
+    }
+
+    void Recorder::encode(const RecordEntry &entry, uint8_t *bytes)
+    {
+      bytes[0] = entry.deltaUs & 0xFF;
+      bytes[1] = entry.deltaUs >> 8;
+      bytes[2] = entry.type;
+      bytes[3] = entry.flags;
+      bytes[4] = (uint16_t)entry.a & 0xFF;
+      bytes[5] = (uint16_t)entry.a >> 8;
+      bytes[6] = (uint16_t)entry.b & 0xFF;
+      bytes[7] = (uint16_t)entry.b >> 8;
+    }
+
+    void Recorder::decode(const uint8_t *bytes, RecordEntry &entry)
+    {
+      entry.deltaUs = bytes[0] | (bytes[1] << 8);
+      entry.type = bytes[2];
+      entry.flags = bytes[3];
+      entry.a = (int16_t)(bytes[4] | (bytes[5] << 8));
+      entry.b = (int16_t)(bytes[6] | (bytes[7] << 8));
+    }
+
+    uint32_t Recorder::checksum(uint32_t hash, const uint8_t *bytes, size_t size)
+    {
+      for (size_t i = 0; i < size; i++)
+      {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+      }
+      return hash;
+    }
+
+    const char *Recorder::getTypeString(RecordType type)
+    {
+      return type < RECORD_TYPE_COUNT ? RECORD_TYPE_STRINGS[type] : "unknown";
+    }
+
+    const char *Recorder::getKeyframeReasonString(RecordKeyframeReason reason)
+    {
+      return reason <= RECORD_KEYFRAME_CHANGE ? RECORD_KEYFRAME_REASON_STRINGS[reason] : "unknown";
+    }
+
+  } // namespace core
+} // namespace stewy
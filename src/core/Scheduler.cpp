@@ -0,0 +1,162 @@
+/**
+ * @file Scheduler.cpp
+ * @brief Implementation of the multi-rate cooperative scheduler
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/Scheduler.h"
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    Scheduler::Scheduler(const SchedulerTask *tasks, int count, uint32_t (*clock)(), void (*idle)(uint32_t untilUs))
+        : _tasks(tasks), _count(count < SCHEDULER_MAX_TASKS ? count : SCHEDULER_MAX_TASKS), _clock(clock), _idle(idle)
+    {
+      memset(_release, 0, sizeof(_release));
+      resetStats();
+    }
+
+    void Scheduler::begin()
+    {
+      const uint32_t now = _clock();
+      for (int i = 0; i < _count; i++)
+      {
+        _release[i] = now + _tasks[i].phaseUs;
+      }
+      resetStats();
+    }
+
+    void Scheduler::runOnce()
+    {
+      uint32_t now = _clock();
+
+      // The highest priority task due, the earliest released between equals
+      int due = -1;
+      for (int i = 0; i < _count; i++)
+      {
+        if (_tasks[i].periodUs == 0 || (int32_t)(now - _release[i]) < 0)
+        {
+          continue;
+        }
+        if (due < 0 || _tasks[i].priority > _tasks[due].priority ||
+            (_tasks[i].priority == _tasks[due].priority && (int32_t)(_release[i] - _release[due]) < 0))
+        {
+          due = i;
+        }
+      }
+
+      if (due >= 0)
+      {
+        const uint32_t period = _tasks[due].periodUs;
+        const uint32_t latency = now - _release[due];
+        if (latency > _stats[due].maxLatencyUs)
+        {
+          _stats[due].maxLatencyUs = latency;
+        }
+
+        // Skip the releases missed, and stay on the grid
+        const uint32_t missed = latency / period;
+        _stats[due].overruns += missed;
+        _release[due] += (missed + 1) * period;
+        run(due);
+        return;
+      }
+
+      // Nothing due: the background tasks, then wait for the next release
+      bool periodic = false;
+      for (int i = 0; i < _count; i++)
+      {
+        if (_tasks[i].periodUs == 0)
+        {
+          run(i);
+        }
+        else
+        {
+          periodic = true;
+        }
+      }
+      if (!periodic)
+      {
+        return;
+      }
+
+      now = _clock();
+      int32_t wait = INT32_MAX;
+      for (int i = 0; i < _count; i++)
+      {
+        if (_tasks[i].periodUs != 0 && (int32_t)(_release[i] - now) < wait)
+        {
+          wait = (int32_t)(_release[i] - now);
+        }
+      }
+      if (wait <= 0)
+      {
+        return;
+      }
+
+      const uint32_t next = now + wait;
+      if (_idle != nullptr)
+      {
+        _idle(next);
+      }
+      else
+      {
+        while ((int32_t)(next - _clock()) > 0)
+        {
+        }
+      }
+    }
+
+    void Scheduler::run(int task)
+    {
+      const uint32_t start = _clock();
+      _tasks[task].run();
+      const uint32_t duration = _clock() - start;
+      _stats[task].runs++;
+      if (duration > _stats[task].maxRunUs)
+      {
+        _stats[task].maxRunUs = duration;
+      }
+    }
+
+    int Scheduler::getTaskCount() const
+    {
+      return _count;
+    }
+
+    const SchedulerTask &Scheduler::getTask(int task) const
+    {
+      return _tasks[task];
+    }
+
+    const TaskStats &Scheduler::getStats(int task) const
+    {
+      return _stats[task];
+    }
+
+    void Scheduler::resetStats()
+    {
+      memset(_stats, 0, sizeof(_stats));
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,126 @@
+/**
+ * @file ServoController.cpp
+ * @brief Implementation of the timer-driven servo update
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/ServoController.h"
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    // Profile copied to each servo; without one, the servos are not profiled and it is never used
+    static ServoProfile prototype(const ServoProfile *profile)
+    {
+      return profile != nullptr ? *profile : ServoProfile(0, 0, 0);
+    }
+
+    ServoController::ServoController(const ServoOutput &output, ServoWriter writer, const ServoProfile *profile)
+        : _output(output), _writer(writer), _profiled(profile != nullptr),
+          _profiles{prototype(profile), prototype(profile), prototype(profile),
+                    prototype(profile), prototype(profile), prototype(profile)},
+          _published(0), _targetSequence(0), _takenSequence(0), _positionSequence(0)
+    {
+      memset(_targets, 0, sizeof(_targets));
+      memset(_positions, 0, sizeof(_positions));
+      memset(&_stats, 0, sizeof(_stats));
+    }
+
+    void ServoController::begin(const float *angles, uint32_t nowUs)
+    {
+      for (int i = 0; i < 6; i++)
+      {
+        _profiles[i].reset(angles[i], nowUs);
+      }
+      memcpy(_targets[0], angles, sizeof(_targets[0]));
+      memcpy(_targets[1], angles, sizeof(_targets[1]));
+      memcpy(_positions, angles, sizeof(_positions));
+      memset(&_stats, 0, sizeof(_stats));
+      _output.invalidate();
+      _takenSequence = _targetSequence.load(std::memory_order_relaxed);
+    }
+
+    void ServoController::setTargets(const float *angles)
+    {
+      // The timer reads the published slot only, and never runs halfway through
+      // this, so the other slot is free to fill
+      const uint8_t slot = 1 - _published.load(std::memory_order_relaxed);
+      memcpy(_targets[slot], angles, sizeof(_targets[slot]));
+      _published.store(slot, std::memory_order_release);
+      _targetSequence.store(_targetSequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    void ServoController::tick(uint32_t nowUs)
+    {
+      const uint32_t sequence = _targetSequence.load(std::memory_order_acquire);
+      const float *targets = _targets[_published.load(std::memory_order_acquire)];
+      if (sequence != _takenSequence)
+      {
+        _takenSequence = sequence;
+        _stats.targets++;
+      }
+
+      for (int i = 0; i < 6; i++)
+      {
+        float angle = targets[i];
+        if (_profiled)
+        {
+          _profiles[i].setTarget(angle, nowUs);
+          angle = _profiles[i].update(nowUs);
+        }
+        _positions[i] = angle;
+
+        if (_output.update(i, angle))
+        {
+          _writer(i, _output.getMicroseconds(i));
+          _stats.writes++;
+        }
+      }
+      _stats.ticks++;
+
+      _positionSequence.store(_positionSequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    void ServoController::getPositions(float *angles) const
+    {
+      uint32_t sequence;
+      do
+      {
+        sequence = _positionSequence.load(std::memory_order_acquire);
+        memcpy(angles, _positions, sizeof(_positions));
+      } while (_positionSequence.load(std::memory_order_acquire) != sequence);
+    }
+
+    ServoControllerStats ServoController::getStats() const
+    {
+      ServoControllerStats stats;
+      uint32_t sequence;
+      do
+      {
+        sequence = _positionSequence.load(std::memory_order_acquire);
+        stats = _stats;
+      } while (_positionSequence.load(std::memory_order_acquire) != sequence);
+      return stats;
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,83 @@
+/**
+ * @file ServoOutput.cpp
+ * @brief Implementation of the servo output stage
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/ServoOutput.h"
+#include <string.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    ServoOutput::ServoOutput(int minAngle, int maxAngle, int minUs, int maxUs, const int *reverse, const int *trim)
+        : _minRaw(minUs * Fixed16::ONE), _maxRaw(maxUs * Fixed16::ONE)
+    {
+      const double scale = (double)(maxUs - minUs) / (maxAngle - minAngle);
+      for (int i = 0; i < 6; i++)
+      {
+        if (reverse[i])
+        {
+          // minUs + (maxAngle - angle) * scale + trim
+          _scale[i] = Fixed16(-scale);
+          _offset[i] = Fixed16(minUs + maxAngle * scale + trim[i]);
+        }
+        else
+        {
+          // minUs + (angle - minAngle) * scale + trim
+          _scale[i] = Fixed16(scale);
+          _offset[i] = Fixed16(minUs - minAngle * scale + trim[i]);
+        }
+      }
+      invalidate();
+    }
+
+    uint16_t ServoOutput::toMicroseconds(int servo, float angle) const
+    {
+      const Fixed16 a = Fixed16::fromRaw((int32_t)(angle * Fixed16::ONE));
+      int32_t us = (_offset[servo] + _scale[servo] * a).raw;
+      us = us < _minRaw ? _minRaw : (us > _maxRaw ? _maxRaw : us);
+      return (uint16_t)((us + Fixed16::ONE / 2) >> Fixed16::FRACTION_BITS);
+    }
+
+    bool ServoOutput::update(int servo, float angle)
+    {
+      const uint16_t pulse = toMicroseconds(servo, angle);
+      if (pulse == _pulse[servo])
+      {
+        return false;
+      }
+      _pulse[servo] = pulse;
+      return true;
+    }
+
+    uint16_t ServoOutput::getMicroseconds(int servo) const
+    {
+      return _pulse[servo];
+    }
+
+    void ServoOutput::invalidate()
+    {
+      memset(_pulse, 0, sizeof(_pulse));
+    }
+
+  } // namespace core
+} // namespace stewy
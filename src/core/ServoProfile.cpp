@@ -0,0 +1,191 @@
+/**
+ * @file ServoProfile.cpp
+ * @brief Implementation of the jerk-limited servo motion profile
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/ServoProfile.h"
+#include <math.h>
+
+namespace stewy
+{
+  namespace core
+  {
+
+    static const float STEP_S = SERVO_PROFILE_STEP_US * 1e-6f;
+
+    // Within these of the target and of rest, the servo is put on the target
+    static const float SETTLE_ANGLE = 0.01f; // Degrees
+    static const float SETTLE_SPEED = 0.5f;  // Degrees/s
+    static const float SETTLE_ACCEL = 10.0f; // Degrees/s^2, less than one step at the jerk limit
+
+    static float clampf(float value, float limit)
+    {
+      return value > limit ? limit : (value < -limit ? -limit : value);
+    }
+
+    static float signf(float value)
+    {
+      return value < 0 ? -1.0f : 1.0f;
+    }
+
+    ServoProfile::ServoProfile(float maxSpeed, float maxAccel, float maxJerk)
+        : _maxSpeed(maxSpeed), _maxAccel(maxAccel), _maxJerk(maxJerk)
+    {
+      reset(0, 0);
+    }
+
+    void ServoProfile::reset(float angle, uint32_t nowUs)
+    {
+      _target = angle;
+      _angle = angle;
+      _speed = 0;
+      _accel = 0;
+      _jerk = 0;
+      _gridUs = nowUs;
+    }
+
+    void ServoProfile::setTarget(float target, uint32_t nowUs)
+    {
+      // The step in progress keeps its jerk, so the motion up to now is unchanged
+      update(nowUs);
+      _target = target;
+    }
+
+    float ServoProfile::update(uint32_t nowUs)
+    {
+      uint32_t steps = (nowUs - _gridUs) / SERVO_PROFILE_STEP_US;
+      if (steps > SERVO_PROFILE_MAX_STEPS)
+      {
+        _gridUs += (steps - SERVO_PROFILE_MAX_STEPS) * SERVO_PROFILE_STEP_US;
+        steps = SERVO_PROFILE_MAX_STEPS;
+      }
+
+      for (uint32_t i = 0; i < steps; i++)
+      {
+        // Exact integration of constant jerk over the step
+        _angle += STEP_S * (_speed + STEP_S * (_accel / 2 + STEP_S * _jerk / 6));
+        _speed += STEP_S * (_accel + STEP_S * _jerk / 2);
+        _accel += STEP_S * _jerk;
+        _gridUs += SERVO_PROFILE_STEP_US;
+
+        if (fabsf(_target - _angle) < SETTLE_ANGLE && fabsf(_speed) < SETTLE_SPEED && fabsf(_accel) < SETTLE_ACCEL)
+        {
+          _angle = _target;
+          _speed = 0;
+          _accel = 0;
+        }
+        _jerk = chooseJerk();
+      }
+
+      // Part of the way into the current step
+      const float t = (nowUs - _gridUs) * 1e-6f;
+      return _angle + t * (_speed + t * (_accel / 2 + t * _jerk / 6));
+    }
+
+    float ServoProfile::chooseJerk() const
+    {
+      if (isSettled())
+      {
+        return 0;
+      }
+
+      // Work in the direction of the target
+      const float direction = signf(_target - _angle);
+      const float distance = fabsf(_target - _angle);
+      const float speed = direction * _speed;
+      const float accel = direction * _accel;
+
+      // Jerk towards the largest speed: the acceleration that can still be ramped
+      // down to zero by the time the speed reaches the limit
+      const float error = _maxSpeed - speed;
+      const float cruise = signf(error) * fminf(_maxAccel, sqrtf(2 * _maxJerk * fabsf(error)));
+      const float jerk = clampf((cruise - accel) / STEP_S, _maxJerk);
+
+      // Take it if the servo can still stop at the target after this step, or else
+      // hold the acceleration if that can, or else brake down to the acceleration limit
+      if (canStop(distance, speed, accel, jerk))
+      {
+        return direction * jerk;
+      }
+      if (jerk > 0 && canStop(distance, speed, accel, 0))
+      {
+        return 0;
+      }
+      return direction * fmaxf(-_maxJerk, (-_maxAccel - accel) / STEP_S);
+    }
+
+    bool ServoProfile::canStop(float distance, float speed, float accel, float jerk) const
+    {
+      const float nextSpeed = speed + STEP_S * (accel + STEP_S * jerk / 2);
+      const float nextAccel = fmaxf(accel + STEP_S * jerk, -_maxAccel);
+      const float travel = STEP_S * (speed + STEP_S * (accel / 2 + STEP_S * jerk / 6));
+      return nextSpeed <= 0 || stoppingDistance(nextSpeed, nextAccel) <= distance - travel;
+    }
+
+    float ServoProfile::stoppingDistance(float speed, float accel) const
+    {
+      const float j = _maxJerk;
+
+      // Already braking harder than a stop needs: release the brake at the jerk
+      // limit, and the speed reaches zero on the way
+      if (accel < 0 && speed <= accel * accel / (2 * j))
+      {
+        // Solve speed + accel t + j t^2 / 2 = 0 for its first root
+        const float t = (-accel - sqrtf(fmaxf(accel * accel - 2 * j * speed, 0))) / j;
+        return t * (speed + t * (accel / 2 + t * j / 6));
+      }
+
+      // Otherwise ramp the acceleration down to the peak deceleration, hold it,
+      // and ramp it back up to zero as the speed reaches zero. The peak is the
+      // acceleration limit, or lower if the speed runs out before reaching it.
+      const float peak = fminf(_maxAccel, sqrtf(j * speed + accel * accel / 2));
+      const float t1 = fmaxf(accel + peak, 0) / j;
+      const float v1 = speed + t1 * (accel - j * t1 / 2);
+      const float d1 = t1 * (speed + t1 * (accel / 2 - t1 * j / 6));
+      const float t2 = fmaxf(v1 - peak * peak / (2 * j), 0) / peak;
+      const float v2 = v1 - peak * t2;
+      const float d2 = t2 * (v1 - peak * t2 / 2);
+      const float t3 = peak / j;
+      const float d3 = t3 * (v2 + t3 * (-peak / 2 + t3 * j / 6));
+      return d1 + d2 + d3;
+    }
+
+    bool ServoProfile::isSettled() const
+    {
+      return _angle == _target && _speed == 0 && _accel == 0;
+    }
+
+    float ServoProfile::getTarget() const
+    {
+      return _target;
+    }
+
+    float ServoProfile::getSpeed() const
+    {
+      return _speed;
+    }
+
+    float ServoProfile::getAcceleration() const
+    {
+      return _accel;
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,107 @@
+/**
+ * @file WorkspaceMap.cpp
+ * @brief Implementation of the workspace reachability map
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "core/WorkspaceMap.h"
+
+namespace stewy
+{
+  namespace core
+  {
+
+    WorkspaceMap::WorkspaceMap(const WorkspaceMapLayout &layout)
+        : _layout(layout), _state(UNVERIFIED)
+    {
+      uint32_t stride = 1;
+      for (int i = 5; i >= 0; i--)
+      {
+        _scale[i] = layout.cells[i] / (layout.max[i] - layout.min[i]);
+        _stride[i] = stride;
+        stride *= layout.cells[i];
+      }
+    }
+
+    bool WorkspaceMap::verify(const IkKernel<ik_scalar_t> &kernel)
+    {
+#ifdef SLAM
+      const bool slam = true;
+#else
+      const bool slam = false;
+#endif
+
+      _state = _layout.slam == slam ? VALID : STALE;
+
+      float servoValues[6];
+      int failedLeg;
+      float value;
+      for (int i = 0; i < _layout.probeCount && _state == VALID; i++)
+      {
+        const float *p = _layout.probes[i].pose;
+        const IkStatus status = kernel.solveRaw(servoValues, p[0], p[1], p[2], p[3], p[4], p[5], failedLeg, value);
+        const bool reachable = status == IK_OK || (slam && status == IK_ASYMPTOTIC);
+        if (reachable != _layout.probes[i].reachable)
+        {
+          _state = STALE;
+        }
+      }
+
+      return _state == VALID;
+    }
+
+    void WorkspaceMap::invalidate()
+    {
+      _state = UNVERIFIED;
+    }
+
+    bool WorkspaceMap::needsVerify() const
+    {
+      return _state == UNVERIFIED;
+    }
+
+    WorkspaceStatus WorkspaceMap::query(const float *pose) const
+    {
+      if (_state != VALID)
+      {
+        return WORKSPACE_UNKNOWN;
+      }
+
+      uint32_t index = 0;
+      for (int i = 0; i < 6; i++)
+      {
+        if (pose[i] < _layout.min[i] || pose[i] > _layout.max[i])
+        {
+          return WORKSPACE_UNKNOWN;
+        }
+
+        // The upper bound belongs to the last cell
+        int cell = (int)((pose[i] - _layout.min[i]) * _scale[i]);
+        if (cell >= _layout.cells[i])
+        {
+          cell = _layout.cells[i] - 1;
+        }
+        index += cell * _stride[i];
+      }
+
+      return (WorkspaceStatus)((_layout.bits[index >> 2] >> ((index & 3) * 2)) & 3);
+    }
+
+  } // namespace core
+} // namespace stewy
@@ -0,0 +1,160 @@
+/**
+ * @file FtmServoPwm.cpp
+ * @brief Implementation of the FTM0 servo output driver
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "drivers/FtmServoPwm.h"
+#include <string.h>
+
+namespace stewy
+{
+  namespace drivers
+  {
+
+    FtmServoPwm::FtmServoPwm(FtmRegisters &ftm, uint32_t busHz)
+        : _ftm(ftm), _busHz(busHz), _countsPerUs(0), _frameCounts(0), _guardCounts(0), _dirty(false)
+    {
+      memset(_channel, 0, sizeof(_channel));
+      memset(_pending, 0, sizeof(_pending));
+    }
+
+    int FtmServoPwm::channelOf(int pin)
+    {
+      // FTM0 channels 0-7 are on pins 22, 23, 9, 10, 6, 20, 21 and 5 (PTC1-4, PTD4-7, mux 4)
+      switch (pin)
+      {
+      case 22:
+        return 0;
+      case 23:
+        return 1;
+      case 9:
+        return 2;
+      case 10:
+        return 3;
+      case 6:
+        return 4;
+      case 20:
+        return 5;
+      case 21:
+        return 6;
+      case 5:
+        return 7;
+      default:
+        return -1;
+      }
+    }
+
+    bool FtmServoPwm::begin(const int *pins, uint16_t frameHz)
+    {
+      if (frameHz < SERVO_PWM_MIN_FRAME_HZ || frameHz > SERVO_PWM_MAX_FRAME_HZ)
+      {
+        return false;
+      }
+      for (int i = 0; i < 6; i++)
+      {
+        const int channel = channelOf(pins[i]);
+        if (channel < 0)
+        {
+          return false;
+        }
+        _channel[i] = (uint8_t)channel;
+      }
+
+      // The smallest prescaler that fits a frame in the 16-bit counter, for the finest pulses
+      uint32_t prescale = 0;
+      while ((_busHz >> prescale) / frameHz > 65536 && prescale < ftm::SC_PS_MASK)
+      {
+        prescale++;
+      }
+      _frameCounts = (_busHz >> prescale) / frameHz;
+      _countsPerUs = (uint32_t)(((uint64_t)_busHz << 16) / (1000000ull << prescale));
+      _guardCounts = (SERVO_PWM_FLUSH_GUARD_US * _countsPerUs) >> 16;
+
+      // With the clock stopped, MOD and CnV take their values as they are written
+      _ftm.SC = 0;
+      _ftm.MODE = ftm::MODE_WPDIS | ftm::MODE_FTMEN;
+      _ftm.CNTIN = 0;
+      _ftm.MOD = _frameCounts - 1;
+      for (int i = 0; i < 6; i++)
+      {
+        _ftm.C[_channel[i]].SC = ftm::CSC_EDGE_PWM;
+        _ftm.C[_channel[i]].V = 0;
+        _pending[i] = 0;
+      }
+
+      // From now on, CnV is only loaded on a software trigger, at the end of a frame
+      _ftm.COMBINE = ftm::COMBINE_SYNCEN;
+      _ftm.SYNCONF = ftm::SYNCONF_SYNCMODE | ftm::SYNCONF_SWWRBUF;
+      _ftm.SYNC = ftm::SYNC_CNTMAX;
+      _ftm.CNT = 0;
+      _ftm.SC = ftm::SC_CLKS_BUS | prescale;
+      _dirty = false;
+      return true;
+    }
+
+    void FtmServoPwm::write(int servo, uint16_t us)
+    {
+      uint32_t counts = (uint32_t)(((uint64_t)us * _countsPerUs + 0x8000) >> 16);
+      if (counts > _frameCounts)
+      {
+        counts = _frameCounts;
+      }
+      if (counts != _pending[servo])
+      {
+        _pending[servo] = counts;
+        _dirty = true;
+      }
+    }
+
+    bool FtmServoPwm::flush()
+    {
+      if (!_dirty)
+      {
+        return true;
+      }
+
+      // While SWSYNC is set, the timer loads the values at the end of the frame.
+      // They can still be replaced well before it, but not close to it: the
+      // frame could get some new and some old ones
+      if ((_ftm.SYNC & ftm::SYNC_SWSYNC) && _ftm.MOD - _ftm.CNT < _guardCounts)
+      {
+        return false;
+      }
+      for (int i = 0; i < 6; i++)
+      {
+        _ftm.C[_channel[i]].V = _pending[i];
+      }
+      _ftm.SYNC = ftm::SYNC_CNTMAX | ftm::SYNC_SWSYNC;
+      _dirty = false;
+      return true;
+    }
+
+    uint32_t FtmServoPwm::getFrameCounts() const
+    {
+      return _frameCounts;
+    }
+
+    float FtmServoPwm::getCountsPerMicrosecond() const
+    {
+      return _countsPerUs / 65536.0f;
+    }
+
+  } // namespace drivers
+} // namespace stewy
@@ -21,8 +21,8 @@
  */
 
 #include "drivers/Nunchuck.h"
-#include "core/Platform.h"
 #include <Blinker.h>
+#include "hal/Clock.h"
 
 namespace stewy
 {
@@ -50,7 +50,7 @@ namespace stewy
 
     NunchuckDriver::NunchuckDriver()
     {
-      nunchuck = new Accessory();
+      state = {0, 0, false, false};
       mode = SETPOINT;
       subMode = PITCH_ROLL;
       direction = CW;
@@ -59,6 +59,7 @@ namespace stewy
       lastButtonTime = 0;
       zPressed = false;
       cPressed = false;
+      recorder = nullptr;
 
       // Set deadband for joystick
       deadBand.x = 2;
@@ -71,22 +72,13 @@ namespace stewy
 
     NunchuckDriver::~NunchuckDriver()
     {
-      // Clean up dynamically allocated objects
-      if (nunchuck != nullptr)
-      {
-        delete nunchuck;
-        nunchuck = nullptr;
-      }
-
       Log.trace("NunchuckDriver destroyed");
     }
 
     void NunchuckDriver::init()
     {
       // Initialize nunchuck
-      nunchuck->begin();
-
-      if (nunchuck->type == UnknownChuck)
+      if (!hal::nunchuckBegin())
       {
         Log.error("Nunchuck not detected!");
       }
@@ -96,10 +88,49 @@ namespace stewy
       }
     }
 
-    core::xy_coordf NunchuckDriver::process(float *servoValues)
+    void NunchuckDriver::setRecorder(core::Recorder *recorder)
+    {
+      this->recorder = recorder;
+    }
+
+    void NunchuckDriver::getState(NunchuckDriverState &state) const
+    {
+      state.state = this->state;
+      state.mode = mode;
+      state.subMode = subMode;
+      state.direction = direction;
+      state.zPressed = zPressed;
+      state.cPressed = cPressed;
+      state.speed = speed;
+      state.radius = radius;
+      state.lastButtonTime = lastButtonTime;
+      state.setpoint = setpoint;
+    }
+
+    void NunchuckDriver::setState(const NunchuckDriverState &state)
     {
-      // Update nunchuck data
-      nunchuck->readData();
+      this->state = state.state;
+      mode = static_cast<ControlMode>(state.mode);
+      subMode = static_cast<ControlSubMode>(state.subMode);
+      direction = static_cast<Direction>(state.direction);
+      zPressed = state.zPressed;
+      cPressed = state.cPressed;
+      speed = state.speed;
+      radius = state.radius;
+      lastButtonTime = state.lastButtonTime;
+      setpoint = state.setpoint;
+    }
+
+    core::xy_coordf NunchuckDriver::process(core::PoseArbiter &arbiter)
+    {
+      // Update nunchuck data (the last state is kept if the read fails)
+      const bool ok = hal::nunchuckRead(state);
+      if (recorder)
+      {
+        recorder->record(core::RECORD_NUNCHUCK, hal::micros(), state.joyX, state.joyY,
+                         (state.buttonZ ? core::RECORD_NUNCHUCK_Z : 0) | (state.buttonC ? core::RECORD_NUNCHUCK_C : 0) |
+                             (ok ? core::RECORD_NUNCHUCK_OK : 0));
+      }
 
       // Handle button presses
       handleButtons();
@@ -107,9 +138,7 @@ namespace stewy
       // Update setpoint based on mode
       updateSetpoint();
 
-      // Apply platform movement based on mode
-      core::Platform platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
-
+      // Request platform movement based on mode
       switch (mode)
       {
       case SETPOINT:
@@ -119,30 +148,36 @@ namespace stewy
 
       case CONTROL:
         // In CONTROL mode, the joystick directly controls the platform
-        if (abs(nunchuck->getJoyX()) > deadBand.x || abs(nunchuck->getJoyY()) > deadBand.y)
+        if (abs(state.joyX) > deadBand.x || abs(state.joyY) > deadBand.y)
         {
-          float joyX = nunchuck->getJoyX() / 127.0f; // Normalize to -1.0 to 1.0
-          float joyY = nunchuck->getJoyY() / 127.0f; // Normalize to -1.0 to 1.0
+          float joyX = state.joyX / 127.0f; // Normalize to -1.0 to 1.0
+          float joyY = state.joyY / 127.0f; // Normalize to -1.0 to 1.0
 
           switch (subMode)
           {
           case PITCH_ROLL:
-            platform.moveTo(servoValues, joyY * MAX_PITCH, joyX * MAX_ROLL);
+            arbiter.submitPitchRoll(core::SOURCE_NUNCHUCK, PRIORITY_NUNCHUCK, joyY * MAX_PITCH, joyX * MAX_ROLL);
             break;
 
           case HEAVE_YAW:
-            platform.moveTo(servoValues, 0, 0, joyY * MAX_HEAVE, 0, 0, joyX * MAX_YAW);
+          {
+            const core::Pose pose = {0, 0, (float)(int)(joyY * MAX_HEAVE), 0, 0, joyX * MAX_YAW};
+            arbiter.submit(core::SOURCE_NUNCHUCK, PRIORITY_NUNCHUCK, pose);
             break;
+          }
 
           case SWAY_SURGE:
-            platform.moveTo(servoValues, joyX * MAX_SWAY, joyY * MAX_SURGE, 0, 0, 0, 0);
+          {
+            const core::Pose pose = {(float)(int)(joyX * MAX_SWAY), (float)(int)(joyY * MAX_SURGE), 0, 0, 0, 0};
+            arbiter.submit(core::SOURCE_NUNCHUCK, PRIORITY_NUNCHUCK, pose);
             break;
           }
+          }
         }
         else
         {
           // If joystick is in deadband, return to home position
-          platform.home(servoValues);
+          arbiter.submitHome(core::SOURCE_NUNCHUCK, PRIORITY_NUNCHUCK);
         }
         break;
 
@@ -168,8 +203,8 @@ namespace stewy
     void NunchuckDriver::handleButtons()
     {
       // Check for button presses
-      bool zNow = nunchuck->getButtonZ();
-      bool cNow = nunchuck->getButtonC();
+      bool zNow = state.buttonZ;
+      bool cNow = state.buttonC;
 
       // Z button handling
       if (zNow && !zPressed)
@@ -258,15 +293,15 @@ namespace stewy
       {
       case SETPOINT:
         // In SETPOINT mode, the joystick moves the setpoint
-        if (abs(nunchuck->getJoyX()) > deadBand.x)
+        if (abs(state.joyX) > deadBand.x)
         {
-          setpoint.x += (nunchuck->getJoyX() / 127.0f) * 0.001f; // Slow movement
+          setpoint.x += (state.joyX / 127.0f) * 0.001f; // Slow movement
           setpoint.x = constrain(setpoint.x, -1.0f, 1.0f);
         }
 
-        if (abs(nunchuck->getJoyY()) > deadBand.y)
+        if (abs(state.joyY) > deadBand.y)
         {
-          setpoint.y += (nunchuck->getJoyY() / 127.0f) * 0.001f; // Slow movement
+          setpoint.y += (state.joyY / 127.0f) * 0.001f; // Slow movement
           setpoint.y = constrain(setpoint.y, -1.0f, 1.0f);
         }
         break;
@@ -274,9 +309,9 @@ namespace stewy
       case CIRCLE:
         // In CIRCLE mode, the setpoint moves in a circle
         // The joystick Y-axis controls the speed
-        if (abs(nunchuck->getJoyY()) > deadBand.y)
+        if (abs(state.joyY) > deadBand.y)
         {
-          speed = map(nunchuck->getJoyY(), -127, 127, 0.05f, 0.5f);
+          speed = map(state.joyY, -127, 127, 0.05f, 0.5f);
         }
 
         // This is a placeholder for the actual implementation
@@ -285,9 +320,9 @@ namespace stewy
       case EIGHT:
         // In EIGHT mode, the setpoint moves in a figure eight
         // The joystick Y-axis controls the speed
-        if (abs(nunchuck->getJoyY()) > deadBand.y)
+        if (abs(state.joyY) > deadBand.y)
         {
-          speed = map(nunchuck->getJoyY(), -127, 127, 0.05f, 0.5f);
+          speed = map(state.joyY, -127, 127, 0.05f, 0.5f);
         }
 
         // This is a placeholder for the actual implementation
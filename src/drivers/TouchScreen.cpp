@@ -21,7 +21,7 @@
  */
 
 #include "drivers/TouchScreen.h"
-#include "core/Platform.h"
+#include "hal/Clock.h"
 
 namespace stewy
 {
@@ -94,7 +94,7 @@ namespace stewy
     // TouchScreenDriver implementation
     TouchScreenDriver::TouchScreenDriver(uint8_t xp, uint8_t yp, uint8_t xm, uint8_t ym, uint16_t ohms)
     {
-      ts = new TouchScreen(xp, yp, xm, ym, ohms);
+      hal::touchBegin(xp, yp, xm, ym, ohms);
 
       // Initialize variables to safe defaults
       inputX = 0.0;
@@ -103,6 +103,13 @@ namespace stewy
       outputY = 0.0;
       setpointX = 0.0;
       setpointY = 0.0;
+      touched = false;
+      lastInputX = 0;
+      lastInputY = 0;
+      rollState = TouchPidState();
+      pitchState = TouchPidState();
+      profiler = nullptr;
+      recorder = nullptr;
 
       // Initialize PID controllers with pointers to our variables
       rollPID = new PID(&inputX, &outputX, &setpointX, 3, 0, 0, P_ON_E, DIRECT);
@@ -117,12 +124,6 @@ namespace stewy
     TouchScreenDriver::~TouchScreenDriver()
     {
       // Clean up dynamically allocated objects
-      if (ts != nullptr)
-      {
-        delete ts;
-        ts = nullptr;
-      }
-
       if (rollPID != nullptr)
       {
         delete rollPID;
@@ -147,8 +148,7 @@ namespace stewy
       pitchPID->SetSampleTime(PITCH_PID_SAMPLE_TIME);
 
       // Start with PID controllers in automatic mode
-      rollPID->SetMode(AUTOMATIC);
-      pitchPID->SetMode(AUTOMATIC);
+      setAutomatic();
 
       // Try to load calibration data
       if (!loadCalibration())
@@ -172,8 +172,8 @@ namespace stewy
 
     bool TouchScreenDriver::loadCalibration()
     {
-      // Read calibration data from EEPROM
-      EEPROM.get(TOUCH_CALIBRATION_ADDR, calibration);
+      // Read calibration data from the store (EEPROM)
+      hal::storeGet(TOUCH_CALIBRATION_ADDR, calibration);
 
       // Validate calibration data
       if (calibration.isCalibrated &&
@@ -191,7 +191,7 @@ namespace stewy
 
     bool TouchScreenDriver::saveCalibration()
     {
-      EEPROM.put(TOUCH_CALIBRATION_ADDR, calibration);
+      hal::storePut(TOUCH_CALIBRATION_ADDR, calibration);
       Log.info("Saved touchscreen calibration: X[%d-%d], Y[%d-%d]",
                calibration.minX, calibration.maxX,
                calibration.minY, calibration.maxY);
@@ -221,7 +221,7 @@ namespace stewy
       return isCalibrating;
     }
 
-    void TouchScreenDriver::processCalibrationPoint(int step, TSPoint p)
+    void TouchScreenDriver::processCalibrationPoint(int step, hal::TouchPoint p)
     {
       // Store the sample
       if (p.z > 0 && calibrationSampleCount < CALIBRATION_SAMPLES)
@@ -319,19 +319,42 @@ namespace stewy
       setpointY = calibration.minY + (calibration.maxY - calibration.minY) / 2;
 
       // Re-enable PID
-      rollPID->SetMode(AUTOMATIC);
-      pitchPID->SetMode(AUTOMATIC);
+      setAutomatic();
 
       isCalibrating = false;
       Log.info("Touchscreen calibration complete!");
     }
 
-    void TouchScreenDriver::process(float setpoint_x, float setpoint_y, float *servoValues)
+    void TouchScreenDriver::process(float setpoint_x, float setpoint_y, core::PoseArbiter &arbiter)
+    {
+      sample();
+      control(setpoint_x, setpoint_y, arbiter);
+    }
+
+    void TouchScreenDriver::setProfiler(core::Profiler *profiler)
     {
-      static float lastInputX = 0, lastInputY = 0;
+      this->profiler = profiler;
+    }
+
+    void TouchScreenDriver::setRecorder(core::Recorder *recorder)
+    {
+      this->recorder = recorder;
+    }
 
+    void TouchScreenDriver::sample()
+    {
       // Get a point from the touchscreen
-      TSPoint p = ts->getPoint();
+      uint32_t start = profiler ? profiler->start() : 0;
+      hal::TouchPoint p = hal::touchRead();
+      if (profiler)
+      {
+        profiler->stop(core::STAGE_TOUCH_READ, start);
+        start = profiler->start();
+      }
+      if (recorder)
+      {
+        recorder->record(core::RECORD_TOUCH, hal::micros(), p.x, p.y, (uint8_t)constrain(p.z, 0, 255));
+      }
 
       // Handle calibration if in progress
       if (isCalibrating)
@@ -355,19 +378,37 @@ namespace stewy
         }
 
         // Add to filter
-        if (p.z > 0)
+        touched = p.z > 0;
+        if (touched)
         { // Only add valid points (when pressure is detected)
           filter.addSample(p.x, p.y);
           lastInputX = p.x;
           lastInputY = p.y;
         }
 
+        if (profiler)
+        {
+          profiler->stop(core::STAGE_FILTER, start);
+        }
+      }
+    }
+
+    void TouchScreenDriver::control(float setpoint_x, float setpoint_y, core::PoseArbiter &arbiter)
+    {
+      if (isCalibrating)
+      {
+        return;
+      }
+
+      // we should NOT process the touchscreen output if the PID is in MANUAL mode.
+      if (pitchPID->GetMode() != MANUAL && rollPID->GetMode() != MANUAL)
+      {
         // Get filtered values
         inputX = filter.getFilteredX();
         inputY = filter.getFilteredY();
 
         // Check if the ball is within the calibrated area
-        if (p.z > 0 &&
+        if (touched &&
             inputX >= calibration.minX && inputX <= calibration.maxX &&
             inputY >= calibration.minY && inputY <= calibration.maxY)
         {
@@ -392,8 +433,25 @@ namespace stewy
 
           // Compute PID values - the PID library automatically uses the input, output, and setpoint
           // values that were provided during construction
+          const uint32_t start = profiler ? profiler->start() : 0;
           bool computedX = rollPID->Compute();
           bool computedY = pitchPID->Compute();
+          if (profiler)
+          {
+            profiler->stop(core::STAGE_PID, start);
+          }
+          if (computedX)
+          {
+            rollState.lastInput = inputX;
+            rollState.lastMs = millis();
+            rollState.computed = true;
+          }
+          if (computedY)
+          {
+            pitchState.lastInput = inputY;
+            pitchState.lastMs = millis();
+            pitchState.computed = true;
+          }
 
           // Only update platform position if PID values have changed
           if (computedX || computedY)
@@ -410,9 +468,8 @@ namespace stewy
             Log.trace("Time/InX/InY/OutX/OutY/roll/pitch:\t%d\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f",
                       m, inputX, inputY, outputX, outputY, roll, pitch);
 
-            // Move the platform
-            core::Platform platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
-            platform.moveTo(servoValues, pitch, roll);
+            // Request the platform movement
+            arbiter.submitPitchRoll(core::SOURCE_TOUCHSCREEN, PRIORITY_TOUCHSCREEN, pitch, roll);
           }
         }
         else
@@ -422,8 +479,7 @@ namespace stewy
           if (m - ballLastSeen >= LOST_BALL_TIMEOUT)
           {
             // Return to home position
-            core::Platform platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
-            platform.home(servoValues);
+            arbiter.submitHome(core::SOURCE_TOUCHSCREEN, PRIORITY_TOUCHSCREEN);
           }
         }
       }
@@ -483,6 +539,11 @@ namespace stewy
       }
     }
 
+    const TouchCalibration &TouchScreenDriver::getCalibration() const
+    {
+      return calibration;
+    }
+
     void TouchScreenDriver::resetPID()
     {
       // Reset to default PID values
@@ -498,8 +559,7 @@ namespace stewy
       pitchPID->SetSampleTime(PITCH_PID_SAMPLE_TIME);
 
       // Reset to automatic mode
-      rollPID->SetMode(AUTOMATIC);
-      pitchPID->SetMode(AUTOMATIC);
+      setAutomatic();
 
       // Reset internal variables
       outputX = 0.0;
@@ -508,5 +568,114 @@ namespace stewy
       Log.info("PID controllers reset to default values");
     }
 
+    void TouchScreenDriver::setAutomatic()
+    {
+      if (rollPID->GetMode() == MANUAL)
+      {
+        rollState.lastInput = inputX;
+      }
+      if (pitchPID->GetMode() == MANUAL)
+      {
+        pitchState.lastInput = inputY;
+      }
+      rollPID->SetMode(AUTOMATIC);
+      pitchPID->SetMode(AUTOMATIC);
+    }
+
+    bool TouchScreenDriver::readPID(PID *pid, double &input, double &output, double &setpoint, TouchPidState &state)
+    {
+      state.p = pid->GetKp();
+      state.i = pid->GetKi();
+      state.d = pid->GetKd();
+
+      // With no error and no change of input, a compute adds nothing to the integral, and outputs it. The copy
+      // computes a millisecond after the last compute, rather than a sample time, which only scales the zero terms
+      PID probe = *pid;
+      probe.SetSampleTime(1);
+      const double savedInput = input, savedOutput = output, savedSetpoint = setpoint;
+      input = state.lastInput;
+      setpoint = state.lastInput;
+      const bool computed = probe.Compute();
+      state.outputSum = output;
+      input = savedInput;
+      output = savedOutput;
+      setpoint = savedSetpoint;
+      return computed;
+    }
+
+    bool TouchScreenDriver::getState(TouchState &state)
+    {
+      if (isCalibrating ||
+          !readPID(rollPID, inputX, outputX, setpointX, rollState) ||
+          !readPID(pitchPID, inputY, outputY, setpointY, pitchState))
+      {
+        return false;
+      }
+
+      state.calibration = calibration;
+      state.filter = filter;
+      state.inputX = inputX;
+      state.inputY = inputY;
+      state.outputX = outputX;
+      state.outputY = outputY;
+      state.setpointX = setpointX;
+      state.setpointY = setpointY;
+      state.lastInputX = lastInputX;
+      state.lastInputY = lastInputY;
+      state.touched = touched;
+      state.ballLastSeen = ballLastSeen;
+      state.roll = rollState;
+      state.pitch = pitchState;
+      return true;
+    }
+
+    void TouchScreenDriver::setState(const TouchState &state)
+    {
+      calibration = state.calibration;
+      filter = state.filter;
+      inputX = state.inputX;
+      inputY = state.inputY;
+      outputX = state.outputX;
+      outputY = state.outputY;
+      setpointX = state.setpointX;
+      setpointY = state.setpointY;
+      lastInputX = state.lastInputX;
+      lastInputY = state.lastInputY;
+      touched = state.touched;
+      ballLastSeen = state.ballLastSeen;
+    }
+
+    void TouchScreenDriver::setPIDState(char axis, const TouchPidState &pid)
+    {
+      const bool roll = axis == 'x' || axis == 'X';
+      PID *controller = roll ? rollPID : pitchPID;
+      double &input = roll ? inputX : inputY;
+      double &output = roll ? outputX : outputY;
+      double &setpoint = roll ? setpointX : setpointY;
+      const int sampleTime = roll ? ROLL_PID_SAMPLE_TIME : PITCH_PID_SAMPLE_TIME;
+      const double savedInput = input, savedOutput = output, savedSetpoint = setpoint;
+
+      // From manual mode, the library starts the integral from the output, and the derivative from the input
+      input = pid.lastInput;
+      setpoint = pid.lastInput;
+      output = pid.outputSum;
+      controller->SetMode(MANUAL);
+      controller->SetMode(AUTOMATIC);
+
+      // Then a compute with no error and no change of input takes the time, and changes nothing else
+      if (pid.computed)
+      {
+        controller->SetSampleTime(1);
+        controller->Compute();
+        controller->SetSampleTime(sampleTime);
+      }
+      controller->SetTunings(pid.p, pid.i, pid.d);
+
+      input = savedInput;
+      output = savedOutput;
+      setpoint = savedSetpoint;
+      (roll ? rollState : pitchState) = pid;
+    }
+
   } // namespace drivers
 } // namespace stewy
@@ -0,0 +1,161 @@
+/**
+ * @file Arduino.cpp
+ * @brief Arduino compatibility for the native build: Print, Serial and pins
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <thread>
+#include "hal/SerialStream.h"
+
+NativeSerial Serial;
+
+static uint8_t pinStates[64];
+
+void delayMicroseconds(unsigned int us)
+{
+  // Whole milliseconds through the HAL, which runs the timer interrupt on the way
+  stewy::hal::delay(us / 1000);
+  std::this_thread::sleep_for(std::chrono::microseconds(us % 1000));
+}
+
+long random(long howBig)
+{
+  return howBig <= 0 ? 0 : rand() % howBig;
+}
+
+long random(long howSmall, long howBig)
+{
+  return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+void randomSeed(unsigned long seed)
+{
+  srand(seed);
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  pinStates[pin % sizeof(pinStates)] = value;
+}
+
+int digitalRead(uint8_t pin)
+{
+  return pinStates[pin % sizeof(pinStates)];
+}
+
+int analogRead(uint8_t pin)
+{
+  return 0;
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--)
+  {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::print(long n, int base)
+{
+  if (base == DEC && n < 0)
+  {
+    return print('-') + print((unsigned long)-n, base);
+  }
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+  char buffer[8 * sizeof(long) + 1];
+  char *s = &buffer[sizeof(buffer) - 1];
+  *s = '\0';
+  base = base < 2 ? DEC : base;
+  do
+  {
+    const int digit = n % base;
+    *--s = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    n /= base;
+  } while (n != 0);
+  return write(s);
+}
+
+size_t Print::print(double n, int digits)
+{
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", digits, n);
+  return write(buffer);
+}
+
+int Print::printf(const char *format, ...)
+{
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  const int n = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  write(buffer);
+  return n;
+}
+
+void NativeSerial::begin(unsigned long baud)
+{
+  stewy::hal::serialBegin(baud);
+}
+
+int NativeSerial::available()
+{
+  if (_next < 0)
+  {
+    _next = stewy::hal::serialRead();
+  }
+  return _next < 0 ? 0 : 1;
+}
+
+int NativeSerial::read()
+{
+  const int c = peek();
+  _next = -1;
+  return c;
+}
+
+int NativeSerial::peek()
+{
+  available();
+  return _next;
+}
+
+void NativeSerial::flush()
+{
+  fflush(stdout);
+}
+
+size_t NativeSerial::write(uint8_t c)
+{
+  stewy::hal::serialWrite((char)c);
+  return 1;
+}
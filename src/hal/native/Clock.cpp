@@ -0,0 +1,187 @@
+/**
+ * @file Clock.cpp
+ * @brief Host implementation of the clock HAL, on std::chrono or on simulated time
+ *
+ * The host has no interrupts, and a thread would run the timer concurrently
+ * with the loop, which the Teensy never does. The timer interrupt is run
+ * from the loop thread instead, whenever a tick is due and the loop reads
+ * the clock, waits or sleeps: in real time, from micros(), delay(),
+ * delayMicroseconds() and waitForInterrupt(); on simulated time, from
+ * native::advanceClock().
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <thread>
+#include "hal/Clock.h"
+#include "hal/Native.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    // Simulated time, once native::useVirtualClock() has been called
+    static bool virtualClock = false;
+    static uint64_t virtualUs = 0;
+
+    // Timer interrupt on simulated time, run by native::advanceClock()
+    static void (*virtualIsr)() = nullptr;
+    static uint32_t virtualPeriodUs = 0;
+    static uint64_t virtualNextUs = 0;
+
+    // Timer interrupt in real time, run from the loop thread when a tick is due
+    static void (*timerIsr)() = nullptr;
+    static std::chrono::microseconds timerPeriod;
+    static std::chrono::steady_clock::time_point timerNext;
+    static bool inTimerIsr = false;
+
+    // Run the timer interrupt, if a tick is due. A tick the loop held off runs once, late, as a pending interrupt
+    // does, and the next one is back on the grid
+    static void runTimer()
+    {
+      if (timerIsr == nullptr || inTimerIsr)
+      {
+        return;
+      }
+      const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+      if (now < timerNext)
+      {
+        return;
+      }
+      while (timerNext <= now)
+      {
+        timerNext += timerPeriod;
+      }
+      inTimerIsr = true; // The interrupt reads the clock
+      timerIsr();
+      inTimerIsr = false;
+    }
+
+    // Sleep until a given time, running the timer interrupt at its ticks on the way
+    static void sleepUntil(std::chrono::steady_clock::time_point until)
+    {
+      runTimer();
+      while (timerIsr != nullptr && timerNext < until)
+      {
+        std::this_thread::sleep_until(timerNext);
+        runTimer();
+      }
+      std::this_thread::sleep_until(until);
+      runTimer();
+    }
+
+    // Time since the first call, which comes before setup() (static constructors read the clock)
+    static std::chrono::steady_clock::duration elapsed()
+    {
+      if (virtualClock)
+      {
+        return std::chrono::microseconds(virtualUs);
+      }
+      static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      return std::chrono::steady_clock::now() - start;
+    }
+
+    void clockBegin()
+    {
+      elapsed();
+    }
+
+    uint32_t millis()
+    {
+      return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(elapsed()).count();
+    }
+
+    uint32_t micros()
+    {
+      if (!virtualClock)
+      {
+        runTimer();
+      }
+      return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed()).count();
+    }
+
+    void delay(uint32_t ms)
+    {
+      if (virtualClock)
+      {
+        native::advanceClock(ms * 1000);
+        return;
+      }
+      sleepUntil(std::chrono::steady_clock::now() + std::chrono::milliseconds(ms));
+    }
+
+    uint32_t cycleCount()
+    {
+      return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed()).count();
+    }
+
+    uint32_t cyclesPerMicrosecond()
+    {
+      return 1000;
+    }
+
+    bool timerBegin(void (*isr)(), uint32_t periodUs)
+    {
+      if (virtualClock)
+      {
+        virtualIsr = isr;
+        virtualPeriodUs = periodUs;
+        virtualNextUs = virtualUs + periodUs;
+        return true;
+      }
+
+      // The loop thread runs the ticks, from the clock calls, so that the interrupt never runs halfway through the
+      // loop code, as on a single core
+      timerIsr = isr;
+      timerPeriod = std::chrono::microseconds(periodUs);
+      timerNext = std::chrono::steady_clock::now() + timerPeriod;
+      return true;
+    }
+
+    void waitForInterrupt()
+    {
+      if (virtualClock)
+      {
+        return;
+      }
+      sleepUntil(std::chrono::steady_clock::now() + std::chrono::microseconds(250));
+    }
+
+    void native::useVirtualClock()
+    {
+      virtualClock = true;
+      virtualUs = 0;
+      virtualIsr = nullptr;
+    }
+
+    void native::advanceClock(uint32_t us)
+    {
+      const uint64_t until = virtualUs + us;
+      while (virtualIsr != nullptr && virtualNextUs <= until)
+      {
+        virtualUs = virtualNextUs;
+        virtualNextUs += virtualPeriodUs;
+        virtualIsr();
+      }
+      virtualUs = until;
+    }
+
+  } // namespace hal
+} // namespace stewy
@@ -0,0 +1,57 @@
+/**
+ * @file NunchuckBus.cpp
+ * @brief Host implementation of the Nunchuck HAL
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "hal/Native.h"
+#include "hal/NunchuckBus.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    // State set by native::setNunchuckState(), which also connects the Nunchuck
+    static NunchuckState nunchuckState = {0, 0, false, false};
+    static bool connected = false;
+
+    bool nunchuckBegin()
+    {
+      return connected;
+    }
+
+    bool nunchuckRead(NunchuckState &state)
+    {
+      if (!connected)
+      {
+        return false;
+      }
+      state = nunchuckState;
+      return true;
+    }
+
+    void native::setNunchuckState(const NunchuckState &state)
+    {
+      nunchuckState = state;
+      connected = true;
+    }
+
+  } // namespace hal
+} // namespace stewy
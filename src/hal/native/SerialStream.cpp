@@ -0,0 +1,76 @@
+/**
+ * @file SerialStream.cpp
+ * @brief Host implementation of the serial console HAL, on stdin and stdout
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <poll.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <string>
+#include "hal/Native.h"
+#include "hal/SerialStream.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    // Characters typed with native::setSerialInput(), not read yet
+    static std::string typed;
+
+    void serialBegin(uint32_t baud)
+    {
+    }
+
+    int serialRead()
+    {
+      if (!typed.empty())
+      {
+        const char c = typed[0];
+        typed.erase(0, 1);
+        return (unsigned char)c;
+      }
+
+      // Only read when a character is waiting, as Serial.available() would tell
+      pollfd input = {STDIN_FILENO, POLLIN, 0};
+      char c;
+      if (poll(&input, 1, 0) <= 0 || !(input.revents & POLLIN) || read(STDIN_FILENO, &c, 1) != 1)
+      {
+        return -1;
+      }
+      return (unsigned char)c;
+    }
+
+    void serialWrite(char c)
+    {
+      putchar(c);
+      if (c == '\n')
+      {
+        fflush(stdout);
+      }
+    }
+
+    void native::setSerialInput(const char *text)
+    {
+      typed += text;
+    }
+
+  } // namespace hal
+} // namespace stewy
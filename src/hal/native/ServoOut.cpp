@@ -0,0 +1,54 @@
+/**
+ * @file ServoOut.cpp
+ * @brief Host implementation of the servo output HAL
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include "hal/ServoOut.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    // Pulse widths last written, from the loop or from the servo timer
+    static std::atomic<uint16_t> pulses[SERVO_OUTPUTS];
+
+    bool servoBegin(const int *pins)
+    {
+      return true;
+    }
+
+    void servoWrite(int servo, uint16_t us)
+    {
+      pulses[servo] = us;
+    }
+
+    void servoFlush()
+    {
+    }
+
+    uint16_t servoRead(int servo)
+    {
+      return pulses[servo];
+    }
+
+  } // namespace hal
+} // namespace stewy
@@ -0,0 +1,85 @@
+/**
+ * @file Store.cpp
+ * @brief Host implementation of the non-volatile store HAL, in a file
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "hal/Native.h"
+#include "hal/Store.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    static const char *storePath = "stewy_eeprom.bin";
+    static uint8_t store[STORE_SIZE];
+    static bool loaded = false;
+
+    // Read the file once, as an erased EEPROM where it is missing or short
+    static void load()
+    {
+      if (loaded)
+      {
+        return;
+      }
+      memset(store, 0xff, sizeof(store));
+      FILE *file = fopen(storePath, "rb");
+      if (file != nullptr)
+      {
+        fread(store, 1, sizeof(store), file);
+        fclose(file);
+      }
+      loaded = true;
+    }
+
+    void storeRead(int address, void *data, size_t size)
+    {
+      load();
+      memcpy(data, store + address, size);
+    }
+
+    void storeWrite(int address, const void *data, size_t size)
+    {
+      load();
+      if (memcmp(store + address, data, size) == 0)
+      {
+        return;
+      }
+      memcpy(store + address, data, size);
+
+      FILE *file = fopen(storePath, "wb");
+      if (file != nullptr)
+      {
+        fwrite(store, 1, sizeof(store), file);
+        fclose(file);
+      }
+    }
+
+    void native::setStorePath(const char *path)
+    {
+      storePath = path;
+      loaded = false;
+    }
+
+  } // namespace hal
+} // namespace stewy
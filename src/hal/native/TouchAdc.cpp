@@ -0,0 +1,49 @@
+/**
+ * @file TouchAdc.cpp
+ * @brief Host implementation of the touchscreen HAL
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "hal/Native.h"
+#include "hal/TouchAdc.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    // Reading set by native::setTouchPoint(), nothing on the screen until then
+    static TouchPoint touchPoint = {0, 0, 0};
+
+    void touchBegin(uint8_t xp, uint8_t yp, uint8_t xm, uint8_t ym, uint16_t ohms)
+    {
+    }
+
+    TouchPoint touchRead()
+    {
+      return touchPoint;
+    }
+
+    void native::setTouchPoint(const TouchPoint &point)
+    {
+      touchPoint = point;
+    }
+
+  } // namespace hal
+} // namespace stewy
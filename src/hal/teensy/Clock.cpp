@@ -0,0 +1,77 @@
+/**
+ * @file Clock.cpp
+ * @brief Teensy implementation of the clock HAL
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include "hal/Clock.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    // Runs the function of timerBegin()
+    static IntervalTimer timer;
+
+    void clockBegin()
+    {
+      // Start the DWT cycle counter
+      ARM_DEMCR |= ARM_DEMCR_TRCENA;
+      ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+    }
+
+    uint32_t millis()
+    {
+      return ::millis();
+    }
+
+    uint32_t micros()
+    {
+      return ::micros();
+    }
+
+    void delay(uint32_t ms)
+    {
+      ::delay(ms);
+    }
+
+    uint32_t cycleCount()
+    {
+      return ARM_DWT_CYCCNT;
+    }
+
+    uint32_t cyclesPerMicrosecond()
+    {
+      return F_CPU / 1000000;
+    }
+
+    bool timerBegin(void (*isr)(), uint32_t periodUs)
+    {
+      return timer.begin(isr, periodUs);
+    }
+
+    void waitForInterrupt()
+    {
+      asm volatile("wfi");
+    }
+
+  } // namespace hal
+} // namespace stewy
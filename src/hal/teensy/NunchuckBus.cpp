@@ -0,0 +1,55 @@
+/**
+ * @file NunchuckBus.cpp
+ * @brief Teensy implementation of the Nunchuck HAL
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include <WiiChuck.h> // https://github.com/madhephaestus/WiiChuck.git
+#include "hal/NunchuckBus.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    // Nunchuck, on Wire
+    static Accessory nunchuck;
+
+    bool nunchuckBegin()
+    {
+      nunchuck.begin();
+      return nunchuck.type != UnknownChuck;
+    }
+
+    bool nunchuckRead(NunchuckState &state)
+    {
+      if (!nunchuck.readData())
+      {
+        return false;
+      }
+      state.joyX = nunchuck.getJoyX();
+      state.joyY = nunchuck.getJoyY();
+      state.buttonZ = nunchuck.getButtonZ();
+      state.buttonC = nunchuck.getButtonC();
+      return true;
+    }
+
+  } // namespace hal
+} // namespace stewy
@@ -0,0 +1,47 @@
+/**
+ * @file SerialStream.cpp
+ * @brief Teensy implementation of the serial console HAL
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include "hal/SerialStream.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    void serialBegin(uint32_t baud)
+    {
+      Serial.begin(baud);
+    }
+
+    int serialRead()
+    {
+      return Serial.available() ? Serial.read() : -1;
+    }
+
+    void serialWrite(char c)
+    {
+      Serial.write(c);
+    }
+
+  } // namespace hal
+} // namespace stewy
@@ -0,0 +1,94 @@
+/**
+ * @file ServoOut.cpp
+ * @brief Teensy implementation of the servo output HAL
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include "hal/ServoOut.h"
+#include "core/Config.h"
+
+#ifdef SERVO_PWM_ENABLED
+#include "drivers/FtmServoPwm.h"
+#else
+#include <Servo.h>
+#endif
+
+namespace stewy
+{
+  namespace hal
+  {
+
+#ifdef SERVO_PWM_ENABLED
+    // Servo pulses from the FTM0 hardware PWM, SERVO_PWM_FRAME_HZ frames
+    static drivers::FtmServoPwm servoPwm(*(drivers::FtmRegisters *)&FTM0_SC, F_BUS);
+#else
+    // Servo pulses from the Servo library, every 20 ms
+    static Servo servos[SERVO_OUTPUTS];
+#endif
+
+    // Pulse widths last written
+    static volatile uint16_t pulses[SERVO_OUTPUTS];
+
+    bool servoBegin(const int *pins)
+    {
+#ifdef SERVO_PWM_ENABLED
+      if (!servoPwm.begin(pins, SERVO_PWM_FRAME_HZ))
+      {
+        return false;
+      }
+
+      // Route the pins to their FTM0 channels, once the timer runs with the pulses off
+      for (int i = 0; i < SERVO_OUTPUTS; i++)
+      {
+        *portConfigRegister(pins[i]) = PORT_PCR_MUX(4) | PORT_PCR_DSE | PORT_PCR_SRE;
+      }
+#else
+      for (int i = 0; i < SERVO_OUTPUTS; i++)
+      {
+        servos[i].attach(pins[i]);
+      }
+#endif
+      return true;
+    }
+
+    void servoWrite(int servo, uint16_t us)
+    {
+      pulses[servo] = us;
+#ifdef SERVO_PWM_ENABLED
+      servoPwm.write(servo, us);
+#else
+      servos[servo].writeMicroseconds(us);
+#endif
+    }
+
+    void servoFlush()
+    {
+#ifdef SERVO_PWM_ENABLED
+      servoPwm.flush();
+#endif
+    }
+
+    uint16_t servoRead(int servo)
+    {
+      return pulses[servo];
+    }
+
+  } // namespace hal
+} // namespace stewy
@@ -0,0 +1,55 @@
+/**
+ * @file Store.cpp
+ * @brief Teensy implementation of the non-volatile store HAL
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "hal/Store.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    void storeRead(int address, void *data, size_t size)
+    {
+      uint8_t *bytes = (uint8_t *)data;
+      for (size_t i = 0; i < size; i++)
+      {
+        bytes[i] = EEPROM.read(address + i);
+      }
+    }
+
+    void storeWrite(int address, const void *data, size_t size)
+    {
+      // Only write the bytes that change, to spare the EEPROM
+      const uint8_t *bytes = (const uint8_t *)data;
+      for (size_t i = 0; i < size; i++)
+      {
+        if (EEPROM.read(address + i) != bytes[i])
+        {
+          EEPROM.write(address + i, bytes[i]);
+        }
+      }
+    }
+
+  } // namespace hal
+} // namespace stewy
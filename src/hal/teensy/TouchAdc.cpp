@@ -0,0 +1,51 @@
+/**
+ * @file TouchAdc.cpp
+ * @brief Teensy implementation of the touchscreen HAL
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include <TouchScreen.h> // from https://github.com/adafruit/Touch-Screen-Library
+#include "hal/TouchAdc.h"
+
+namespace stewy
+{
+  namespace hal
+  {
+
+    // Touchscreen, once started
+    static TouchScreen *touchscreen = nullptr;
+
+    void touchBegin(uint8_t xp, uint8_t yp, uint8_t xm, uint8_t ym, uint16_t ohms)
+    {
+      if (touchscreen == nullptr)
+      {
+        touchscreen = new TouchScreen(xp, yp, xm, ym, ohms);
+      }
+    }
+
+    TouchPoint touchRead()
+    {
+      const TSPoint p = touchscreen->getPoint();
+      const TouchPoint point = {p.x, p.y, p.z};
+      return point;
+    }
+
+  } // namespace hal
+} // namespace stewy
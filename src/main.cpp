@@ -24,9 +24,15 @@
 
 #include <Arduino.h>
 #include <ArduinoLog.h>
-#include <Servo.h>
 #include "core/Config.h"
 #include "core/Platform.h"
+#include "core/PoseArbiter.h"
+#include "core/Profiler.h"
+#include "core/Recorder.h"
+#include "core/Scheduler.h"
+#include "core/ServoController.h"
+#include "core/ServoOutput.h"
+#include "core/ServoProfile.h"
 #ifdef ENABLE_TOUCHSCREEN
 #include "drivers/TouchScreen.h"
 #endif
@@ -38,11 +44,16 @@
 #ifdef ENABLE_SERIAL_COMMANDS
 #include "ui/CommandLine.h"
 #endif
+#include "hal/Clock.h"
+#include "hal/SerialStream.h"
+#include "hal/ServoOut.h"
 
+#ifndef STEWY_NATIVE
 // this is the magic trick for printf to support float
 asm(".global _printf_float");
 // this is the magic trick for scanf to support float
 asm(".global _scanf_float");
+#endif
 
 // Define the namespace for the Stewart platform
 using namespace stewy;
@@ -50,10 +61,8 @@ using namespace stewy;
 // Create platform object
 core::Platform *platform;
 
-#ifdef ENABLE_SERVOS
-// Create servo objects
-Servo servos[6];
-#endif
+// Combines the pose requests of each loop into one IK solve on the platform
+core::PoseArbiter *arbiter;
 
 // Servo setpoints in degrees
 float servoValues[6];
@@ -61,9 +70,6 @@ float servoValues[6];
 // Current actual servo positions (for acceleration/deceleration)
 float currentServoPositions[6];
 
-// Current servo velocities (for acceleration/deceleration)
-float servoVelocities[6];
-
 // Create driver objects
 drivers::TouchScreenDriver *touchscreen;
 drivers::NunchuckDriver *nunchuck;
@@ -71,124 +77,374 @@ drivers::NunchuckDriver *nunchuck;
 // Create UI objects
 ui::CommandLine *commandLine;
 
-// Function to convert angle to microseconds
-float toMicroseconds(int angle)
+#ifdef PROFILER_ENABLED
+// Times the stages of the loop, for the stats command, on the cycle counter (started in setup())
+core::Profiler profiler(hal::cycleCount, hal::cyclesPerMicrosecond());
+core::Profiler *const loopProfiler = &profiler;
+#else
+core::Profiler *const loopProfiler = nullptr;
+#endif
+
+// Start timing a stage of the loop
+uint32_t startStage()
+{
+#ifdef PROFILER_ENABLED
+  return profiler.start();
+#else
+  return 0;
+#endif
+}
+
+// Record a stage of the loop, started with startStage()
+void stopStage(core::ProfileStage stage, uint32_t start)
+{
+#ifdef PROFILER_ENABLED
+  profiler.stop(stage, start);
+#endif
+}
+
+#ifdef RECORDER_ENABLED
+// Records the sensor inputs and task runs, for the record command
+core::RecordEntry recordBuffer[RECORDER_ENTRIES];
+core::Recorder recorder(recordBuffer, RECORDER_ENTRIES, RECORDER_KEYFRAME_INTERVAL_MS * 1000UL);
+core::Recorder *const loopRecorder = &recorder;
+#else
+core::Recorder *const loopRecorder = nullptr;
+#endif
+
+// Record the run of a task, started at startUs, with the checksum of the servo setpoints it output if any
+void recordTask(core::RecordType type, uint32_t startUs, const float *outputs = nullptr)
+{
+#ifdef RECORDER_ENABLED
+  if (!recorder.isRecording())
+  {
+    return;
+  }
+  const uint32_t checksum =
+      outputs ? core::Recorder::checksum(core::RECORD_CHECKSUM_SEED, (const uint8_t *)outputs, 6 * sizeof(float)) : 0;
+  recorder.record(type, startUs, (int16_t)(checksum >> 16), (int16_t)(checksum & 0xFFFF));
+#endif
+}
+
+// Ball setpoint, normalized (-1.0 to 1.0), moved by the nunchuck
+core::xy_coordf setpoint = core::DEFAULT_SETPOINT;
+
+// Record the state of the loop, for the replay to start from, when the recorder asks for a keyframe. Runs just
+// before the pose solve, so that it holds what a shell command changed since the last one
+void recordKeyframe(uint32_t now)
+{
+#ifdef RECORDER_ENABLED
+  if (!recorder.isKeyframeDue(now))
+  {
+    return;
+  }
+
+  // The ball controller may not be readable now: the keyframe stays due, until the next pose solve
+#ifdef ENABLE_TOUCHSCREEN
+  drivers::TouchState touchState;
+  if (!touchscreen->getState(touchState))
+  {
+    return;
+  }
+#endif
+
+  core::RecordLoopState loopState;
+  memcpy(loopState.servoValues, servoValues, sizeof(loopState.servoValues));
+  loopState.setpointX = setpoint.x;
+  loopState.setpointY = setpoint.y;
+  loopState.ms = hal::millis();
+  core::GeometryRecord geometry;
+  core::Platform::getGeometry().toRecord(geometry);
+  core::PlatformState platformState;
+  platform->getState(platformState);
+  core::PoseArbiterState arbiterState;
+  arbiter->getState(arbiterState);
+
+  int states = 4;
+#ifdef ENABLE_TOUCHSCREEN
+  states++;
+#endif
+#ifdef ENABLE_NUNCHUCK
+  drivers::NunchuckDriverState nunchuckState;
+  nunchuck->getState(nunchuckState);
+  states++;
+#endif
+
+  // The solve caches start afresh, as they do in the replay
+  core::Platform::invalidateCaches();
+
+  recorder.recordKeyframe(now, states);
+  recorder.recordState(core::RECORD_STATE_LOOP, now, &loopState, sizeof(loopState));
+  recorder.recordState(core::RECORD_STATE_GEOMETRY, now, &geometry, sizeof(geometry));
+  recorder.recordState(core::RECORD_STATE_PLATFORM, now, &platformState, sizeof(platformState));
+  recorder.recordState(core::RECORD_STATE_ARBITER, now, &arbiterState, sizeof(arbiterState));
+#ifdef ENABLE_TOUCHSCREEN
+  recorder.recordState(core::RECORD_STATE_TOUCH, now, &touchState, sizeof(touchState));
+#endif
+#ifdef ENABLE_NUNCHUCK
+  recorder.recordState(core::RECORD_STATE_NUNCHUCK, now, &nunchuckState, sizeof(nunchuckState));
+#endif
+#endif
+}
+
+// Servo angle to pulse width mapping, with reversal and trim, and the pulse widths written
+core::ServoOutput servoOutput(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, SERVO_MIN_US, SERVO_MAX_US, core::SERVO_REVERSE,
+                              core::SERVO_TRIM);
+
+// Write a pulse width to a servo (from the servo timer interrupt, with SERVO_CONTROLLER_ENABLED)
+void writeServo(int servo, uint16_t us)
+{
+#ifdef ENABLE_SERVOS
+  hal::servoWrite(servo, us);
+#endif
+}
+
+// Send the pulse widths written since the last call, to all servos in the same frame
+void flushServos()
+{
+#ifdef ENABLE_SERVOS
+  hal::servoFlush();
+#endif
+}
+
+#ifdef SERVO_CONTROLLER_ENABLED
+
+#ifdef SERVO_ACCELERATION_ENABLED
+// Motion of each servo towards its setpoint, in time rather than in loop iterations
+const core::ServoProfile servoProfile(SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG);
+core::ServoController servoController(servoOutput, writeServo, &servoProfile);
+#else
+core::ServoController servoController(servoOutput, writeServo, nullptr);
+#endif
+
+// Moves and writes the servos every SERVO_UPDATE_INTERVAL_US, whatever the loop is doing
+void servoTimerIsr()
 {
-  return map(angle, SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, SERVO_MIN_US, SERVO_MAX_US);
+  servoController.tick(hal::micros());
+  flushServos();
 }
+#elif defined(SERVO_ACCELERATION_ENABLED)
+// Motion of each servo towards its setpoint, in time rather than in loop iterations
+core::ServoProfile servoProfiles[6] = {
+    {SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG},
+    {SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG},
+    {SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG},
+    {SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG},
+    {SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG},
+    {SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG}};
+#endif
 
 // Update servo positions
 void updateServos()
 {
+#ifdef SERVO_CONTROLLER_ENABLED
+  // The servo timer moves and writes the servos: hand it the setpoints, and see where it is
+  servoController.setTargets(servoValues);
+  servoController.getPositions(currentServoPositions);
+#else
+#ifdef SERVO_ACCELERATION_ENABLED
+  const uint32_t now = hal::micros();
+#endif
+
   for (int i = 0; i < 6; i++)
   {
     float targetPosition = servoValues[i];
-    float currentPosition = currentServoPositions[i];
+    float currentPosition;
 
 #ifdef SERVO_ACCELERATION_ENABLED
 
-    // Calculate the distance to the target
-    float distance = targetPosition - currentPosition;
-
-    if (abs(distance) > 0.01f) // Small threshold to avoid tiny movements
-    {
-      // Determine the direction of movement
-      float direction = (distance > 0) ? 1.0f : -1.0f;
-
-      // Calculate the desired velocity based on distance
-      float desiredVelocity = direction * min(abs(distance), SERVO_MAX_SPEED);
-
-      // Apply acceleration/deceleration
-      if (servoVelocities[i] < desiredVelocity)
-      {
-        // Accelerate
-        servoVelocities[i] = min(servoVelocities[i] + SERVO_ACCELERATION, desiredVelocity);
-      }
-      else if (servoVelocities[i] > desiredVelocity)
-      {
-        // Decelerate
-        servoVelocities[i] = max(servoVelocities[i] - SERVO_ACCELERATION, desiredVelocity);
-      }
-
-      // Apply velocity to position
-      currentPosition += servoVelocities[i];
-
-      // Check if we've reached or overshot the target
-      if ((direction > 0 && currentPosition >= targetPosition) ||
-          (direction < 0 && currentPosition <= targetPosition))
-      {
-        currentPosition = targetPosition;
-        servoVelocities[i] = 0;
-      }
-    }
-    else
-    {
-      // We're at the target, ensure velocity is zero
-      servoVelocities[i] = 0;
-    }
-
-    // Update the current position
-    currentServoPositions[i] = currentPosition;
+    // Follow the S-curve towards the target. The profile is a function of time, so
+    // a long loop iteration moves the servo no faster than a short one
+    servoProfiles[i].setTarget(targetPosition, now);
+    currentPosition = servoProfiles[i].update(now);
 #else
 
     // No acceleration/deceleration, just use the target position
     currentPosition = targetPosition;
-    currentServoPositions[i] = currentPosition;
 #endif // SERVO_ACCELERATION_ENABLED
 
-    // Apply reverse if needed
-    float val = currentPosition;
-    if (core::SERVO_REVERSE[i])
+    // Update the current position
+    currentServoPositions[i] = currentPosition;
+
+    // Write to servo, only when the pulse width changes
+#ifdef ENABLE_SERVOS
+    if (servoOutput.update(i, currentPosition))
     {
-      val = SERVO_MIN_ANGLE + (SERVO_MAX_ANGLE - val);
+      writeServo(i, servoOutput.getMicroseconds(i));
     }
+#endif
+  }
+  flushServos();
+#endif // SERVO_CONTROLLER_ENABLED
+}
 
-    // Convert to microseconds and apply trim
-    val = toMicroseconds(val) + core::SERVO_TRIM[i];
+#ifdef ENABLE_TOUCHSCREEN
+// Read the ball position into the touchscreen filter
+void touchSampleTask()
+{
+  touchscreen->sample();
+}
 
-// Write to servo
-#ifdef ENABLE_SERVOS
-    servos[i].writeMicroseconds(constrain(val, SERVO_MIN_US, SERVO_MAX_US));
+// Tilt the platform towards the setpoint, from the filtered ball position
+void ballControlTask()
+{
+  recordTask(core::RECORD_BALL_CONTROL, hal::micros());
+  touchscreen->control(setpoint.x, setpoint.y, *arbiter);
+}
+#endif
+
+#ifdef ENABLE_NUNCHUCK
+// Process nunchuck input
+void nunchuckTask()
+{
+  const uint32_t start = startStage();
+  setpoint = nunchuck->process(*arbiter);
+  stopStage(core::STAGE_NUNCHUCK, start);
+
+  // Process the Blinker to handle LED blinking
+  stewy::drivers::modeBlinker.loop();
+}
+#endif
+
+// Solve the pose requested by the sources, once, and move the servos
+void controlTask()
+{
+  const uint32_t now = hal::micros();
+  recordKeyframe(now);
+  uint32_t start = startStage();
+  arbiter->update(servoValues);
+  stopStage(core::STAGE_IK, start);
+  recordTask(core::RECORD_CONTROL, now, servoValues);
+
+  start = startStage();
+  updateServos();
+  stopStage(core::STAGE_SERVO_WRITE, start);
+
+  // Report rejected poses, rate limited, now that the solve is done
+  platform->reportDiagnostics();
+}
+
+#ifdef FK_ENABLED
+// Estimate where the platform actually is, from where the servos actually are
+void estimateTask()
+{
+  recordTask(core::RECORD_ESTIMATE, hal::micros());
+  // The platform keeps the estimate, for the dump command
+  float estimatedPose[6];
+  const uint32_t start = startStage();
+  platform->estimatePose(currentServoPositions, estimatedPose);
+  stopStage(core::STAGE_ESTIMATE, start);
+}
+#endif
+
+#ifdef ENABLE_SERIAL_COMMANDS
+// Process command line
+void shellTask()
+{
+  const uint32_t start = startStage();
+  commandLine->process();
+  stopStage(core::STAGE_SHELL, start);
+}
 #endif
+
+// Clock of the scheduler
+uint32_t schedulerClock()
+{
+  return hal::micros();
+}
+
+// Wait for the next task of the scheduler
+void schedulerIdle(uint32_t untilUs)
+{
+#ifdef SCHEDULER_IDLE_WFI
+  // Sleep while the SysTick interrupt (every ms) is sure to wake us up before the deadline
+  while ((int32_t)(untilUs - hal::micros()) > 1000)
+  {
+    hal::waitForInterrupt();
+  }
+#endif
+  while ((int32_t)(untilUs - hal::micros()) > 0)
+  {
   }
 }
 
+// Task table, periods and phases in microseconds. The phases run the ball
+// controller just after a touch sample, and the pose solve just after the
+// ball controller. They also keep the ball controller mid-millisecond, as
+// the PID library times its samples with millis()
+const core::SchedulerTask tasks[] = {
+#ifdef ENABLE_TOUCHSCREEN
+    {"touch", touchSampleTask, TOUCH_SAMPLE_INTERVAL_US, 0, 5},
+    {"ball", ballControlTask, BALL_CONTROL_INTERVAL_US, 1500, 4},
+#endif
+    {"control", controlTask, CONTROL_INTERVAL_US, 3000, 3},
+#ifdef ENABLE_NUNCHUCK
+    {"nunchuck", nunchuckTask, NUNCHUCK_INTERVAL_US, 4000, 2},
+#endif
+#ifdef FK_ENABLED
+    {"estimate", estimateTask, ESTIMATE_INTERVAL_US, 6000, 1},
+#endif
+#ifdef ENABLE_SERIAL_COMMANDS
+    {"shell", shellTask, 0, 0, 0},
+#endif
+};
+
+// Runs the tasks, each at its own rate
+core::Scheduler scheduler(tasks, sizeof(tasks) / sizeof(tasks[0]), schedulerClock, schedulerIdle);
+
 void setup()
 {
-  // Initialize serial communication
-  Serial.begin(115200);
-  delay(100);
+  // Start the clock (and the cycle counter), and the serial console
+  hal::clockBegin();
+  hal::serialBegin(115200);
+  hal::delay(100);
 
   Log.begin(LOG_LEVEL, &Serial);
   Log.info("Stewy Platform Starting...");
   Log.info("Built %s, %s", __DATE__, __TIME__);
 
-  // Initialize platform
+  // Initialize platform, with the geometry saved by the "geom" command if there is one
+  core::Platform::loadGeometry();
   platform = new core::Platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+  arbiter = new core::PoseArbiter(*platform);
 
-  // Initialize servo position and velocity arrays
+  // Initialize servo positions, at rest
   for (int i = 0; i < 6; i++)
   {
     currentServoPositions[i] = core::SERVO_MID_ANGLE;
-    servoVelocities[i] = 0.0f;
+#if defined(SERVO_ACCELERATION_ENABLED) && !defined(SERVO_CONTROLLER_ENABLED)
+    servoProfiles[i].reset(core::SERVO_MID_ANGLE, hal::micros());
+#endif
   }
 
 // Initialize servos
 #ifdef ENABLE_SERVOS
   Log.info("Initializing servos...");
-  for (int i = 0; i < 6; i++)
+  if (!hal::servoBegin(core::SERVO_PINS))
   {
-    servos[i].attach(core::SERVO_PINS[i]);
+#ifdef SERVO_PWM_ENABLED
+    Log.error("Servo PWM not started: SERVO_PINS must be FTM0 pins, and SERVO_PWM_FRAME_HZ within 50-333");
+#else
+    Log.error("Servos not started");
+#endif
   }
 #else
   Log.info("Servo control is DISABLED");
 #endif
 
+#ifdef SERVO_CONTROLLER_ENABLED
+  // From now on, the servos are moved and written from a timer interrupt
+  servoController.begin(currentServoPositions, hal::micros());
+  hal::timerBegin(servoTimerIsr, SERVO_UPDATE_INTERVAL_US);
+#endif
+
 // Initialize touchscreen
 #ifdef ENABLE_TOUCHSCREEN
   Log.info("Initializing touchscreen...");
   touchscreen = new drivers::TouchScreenDriver(XP, YP, XM, YM, TS_OHMS);
   touchscreen->init();
+  touchscreen->setProfiler(loopProfiler);
+  touchscreen->setRecorder(loopRecorder);
 #else
   Log.info("Touchscreen support is DISABLED");
 #endif
@@ -198,6 +454,7 @@ void setup()
   Log.info("Initializing nunchuck...");
   nunchuck = new drivers::NunchuckDriver();
   nunchuck->init();
+  nunchuck->setRecorder(loopRecorder);
 #else
   Log.info("Nunchuck support is DISABLED");
 #endif
@@ -205,7 +462,7 @@ void setup()
 // Initialize command line
 #ifdef ENABLE_SERIAL_COMMANDS
   Log.info("Initializing command line interface...");
-  commandLine = new ui::CommandLine(touchscreen, nunchuck, servoValues);
+  commandLine = new ui::CommandLine(touchscreen, nunchuck, servoValues, updateServos, arbiter, loopProfiler, &scheduler, loopRecorder);
   commandLine->init();
 #else
   Log.info("Command line interface is DISABLED");
@@ -221,57 +478,23 @@ void setup()
     }
 
     updateServos();
-    delay(10);
+    hal::delay(10);
   }
 
   // Move to home position
   platform->home(servoValues);
   updateServos();
 
+  // Start the tasks, from now
+  scheduler.begin();
+
   Log.info("Initialization complete");
 }
 
 void loop()
 {
-  // Record the start time of this loop iteration
-  unsigned long loopStartTime = millis();
-
-// Process command line
-#ifdef ENABLE_SERIAL_COMMANDS
-  commandLine->process();
-#endif
-
-// Process nunchuck input
-#ifdef ENABLE_NUNCHUCK
-  core::xy_coordf setpoint = nunchuck->process(servoValues);
-
-  // Process the Blinker to handle LED blinking
-  stewy::drivers::modeBlinker.loop();
-#else
-  core::xy_coordf setpoint = core::DEFAULT_SETPOINT;
-#endif
-
-// Process touchscreen
-#ifdef ENABLE_TOUCHSCREEN
-  touchscreen->process(setpoint.x, setpoint.y, servoValues);
-#endif
-
-  // Update servos
-  updateServos();
-
-  // Calculate how long this iteration took
-  unsigned long loopDuration = millis() - loopStartTime;
-
-  // If we completed faster than our target interval, delay the remaining time
-  if (loopDuration < MAIN_LOOP_INTERVAL_MS)
-  {
-    delay(MAIN_LOOP_INTERVAL_MS - loopDuration);
-  }
-  else if (loopDuration > MAIN_LOOP_INTERVAL_MS)
-  {
-    // Log a warning if we're exceeding our target loop time
-    Log.trace("Loop time exceeded target: %lu ms (target: %d ms)", loopDuration, MAIN_LOOP_INTERVAL_MS);
-  }
+  // Run the next task due, or wait for it
+  scheduler.runOnce();
 }
 
 // Clean up function to be called when the program exits
@@ -279,6 +502,12 @@ void loop()
 void cleanup()
 {
   // Clean up dynamically allocated objects
+  if (arbiter != nullptr)
+  {
+    delete arbiter;
+    arbiter = nullptr;
+  }
+
   if (platform != nullptr)
   {
     delete platform;
@@ -22,9 +22,8 @@
 
 #include <Shell.h> // Include the Shell.h header first to get the full definition
 #include "ui/CommandLine.h"
-#include "core/Platform.h"
 #include "platform/TeensyHardware.h"
-#include <Servo.h>
+#include "hal/SerialStream.h"
 
 namespace stewy
 {
@@ -34,11 +33,18 @@ namespace stewy
     // Static instance for command handlers
     static CommandLine *instance = nullptr;
 
-    CommandLine::CommandLine(drivers::TouchScreenDriver *touchscreen, drivers::NunchuckDriver *nunchuck, float *servoValues)
+    CommandLine::CommandLine(drivers::TouchScreenDriver *touchscreen, drivers::NunchuckDriver *nunchuck, float *servoValues,
+                             void (*moveServos)(), core::PoseArbiter *arbiter, core::Profiler *profiler, core::Scheduler *scheduler,
+                             core::Recorder *recorder)
     {
       this->touchscreen = touchscreen;
       this->nunchuck = nunchuck;
       this->servoValues = servoValues;
+      this->moveServos = moveServos;
+      this->arbiter = arbiter;
+      this->profiler = profiler;
+      this->scheduler = scheduler;
+      this->recorder = recorder;
 
       // Store instance for static handlers
       instance = this;
@@ -53,15 +59,19 @@ namespace stewy
         // Register commands
         shell_register(handleHelp, "help");
         shell_register(handleHelp, "?");
+        shell_register(handleCache, "cache");
         shell_register(handleDemo, "demo");
         shell_register(handleDump, "dump");
+        shell_register(handleGeometry, "geom");
         shell_register(handleLog, "log");
         shell_register(handleMoveTo, "moveto");
         shell_register(handleMSet, "mset");
         shell_register(handleMSetAll, "msetall");
+        shell_register(handleRecord, "record");
         shell_register(handleReset, "reset");
         shell_register(handleSet, "set");
         shell_register(handleSetAll, "setall");
+        shell_register(handleStats, "stats");
 
 #ifdef ENABLE_TOUCHSCREEN
         shell_register(handlePID, "px");
@@ -92,19 +102,20 @@ namespace stewy
     // Shell I/O functions
     int CommandLine::shellReader(char *data)
     {
-      // Read from Serial
-      if (Serial.available())
+      // Read from the serial console
+      const int c = hal::serialRead();
+      if (c < 0)
       {
-        *data = Serial.read();
-        return 1;
+        return 0;
       }
-      return 0;
+      *data = (char)c;
+      return 1;
     }
 
     void CommandLine::shellWriter(char data)
     {
-      // Write to Serial
-      Serial.write(data);
+      // Write to the serial console
+      hal::serialWrite(data);
     }
 
     // Command handlers
@@ -115,7 +126,7 @@ namespace stewy
 
       // This would normally list all commands
       // For now, just print a message
-      Log.info("  help, ?, demo, dump, log, moveto, mset, msetall, reset, set, setall");
+      Log.info("  help, ?, cache, demo, dump, geom, log, moveto, mset, msetall, record, reset, set, setall, stats");
 
 #ifdef ENABLE_TOUCHSCREEN
       Log.info("  px, ix, dx, py, iy, dy, calibrate");
@@ -150,6 +161,7 @@ namespace stewy
       // Set servo angle
       instance->servoValues[servo] = angle;
       Log.info("Set servo %d to %d degrees", servo, angle);
+      loopChanged();
 
       return SHELL_RET_SUCCESS;
     }
@@ -181,6 +193,7 @@ namespace stewy
       float angle = map(micros, SERVO_MIN_US, SERVO_MAX_US, SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
       instance->servoValues[servo] = angle;
       Log.info("Set servo %d to %d microseconds (%.2f degrees)", servo, micros, angle);
+      loopChanged();
 
       return SHELL_RET_SUCCESS;
     }
@@ -208,6 +221,7 @@ namespace stewy
       }
 
       Log.info("Set all servos to %d degrees", angle);
+      loopChanged();
 
       return SHELL_RET_SUCCESS;
     }
@@ -238,6 +252,7 @@ namespace stewy
       }
 
       Log.info("Set all servos to %d microseconds (%.2f degrees)", micros, angle);
+      loopChanged();
 
       return SHELL_RET_SUCCESS;
     }
@@ -257,7 +272,7 @@ namespace stewy
       }
 
       // Display platform state
-      core::Platform platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+      core::Platform &platform = instance->arbiter->getPlatform();
       Log.info("Platform State:");
       Log.info("  Sway: %d", platform.getSway());
       Log.info("  Surge: %d", platform.getSurge());
@@ -266,6 +281,46 @@ namespace stewy
       Log.info("  Roll: %.2f", platform.getRoll());
       Log.info("  Yaw: %.2f", platform.getYaw());
 
+#ifdef FK_ENABLED
+      // Display the pose estimated from the servo positions, and how far it is from the setpoints
+      const float *estimate = platform.getEstimatedPose();
+      const float setpoints[6] = {(float)platform.getSway(), (float)platform.getSurge(), (float)platform.getHeave(),
+                                  platform.getPitch(), platform.getRoll(), platform.getYaw()};
+      const char *axes[6] = {"Sway", "Surge", "Heave", "Pitch", "Roll", "Yaw"};
+      Log.info("Estimated Pose (estimate / error from setpoint):");
+      for (int j = 0; j < 6; j++)
+      {
+        Log.info("  %s: %.2f / %.2f", axes[j], estimate[j], estimate[j] - setpoints[j]);
+      }
+
+      const core::FkStats &fk = platform.getFkStats();
+      if (fk.estimates > 0)
+      {
+        Log.info("  Estimates: %lu, converged: %lu, iterations: %.2f, solves: %.2f per estimate",
+                 fk.estimates, fk.converged, (double)fk.iterations / fk.estimates, (double)fk.solves / fk.estimates);
+        Log.info("  Last residual: %.4f degrees", fk.lastResidual);
+      }
+#endif
+
+      // Display move outcomes
+      const core::IkDiagnostics &diagnostics = platform.getDiagnostics();
+      Log.info("Move Results:");
+      for (int r = 0; r < core::IK_RESULT_STATUS_COUNT; r++)
+      {
+        Log.info("  %s: %lu", core::IkDiagnostics::getStatusString((core::IkResultStatus)r),
+                 diagnostics.getCount((core::IkResultStatus)r));
+      }
+
+      // Display pose requests
+      const core::PoseArbiterStats &stats = instance->arbiter->getStats();
+      Log.info("Pose Requests (submitted / applied / overruled / replaced):");
+      for (int s = 0; s < core::SOURCE_COUNT; s++)
+      {
+        Log.info("  %s: %lu / %lu / %lu / %lu", core::PoseArbiter::getSourceString((core::PoseSource)s),
+                 stats.submitted[s], stats.applied[s], stats.overruled[s], stats.replaced[s]);
+      }
+      Log.info("  Solves: %lu, rejected: %lu", stats.solves, stats.failures);
+
 #ifdef ENABLE_NUNCHUCK
       // Display nunchuck state
       Log.info("Nunchuck State:");
@@ -292,46 +347,47 @@ namespace stewy
     {
       Log.info("Running demo sequence...");
 
-      core::Platform platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+      const core::Pose home = {0, 0, 0, 0, 0, 0};
 
       // Home position
-      platform.home(instance->servoValues);
-      delay(1000);
+      moveNow(home);
+      hold(1000);
 
       // Pitch forward
       Log.info("Pitching forward...");
-      platform.moveTo(instance->servoValues, 0, 0, 0, 15, 0, 0);
-      delay(1000);
+      moveNow({0, 0, 0, 15, 0, 0});
+      hold(1000);
 
       // Return to home
-      platform.home(instance->servoValues);
-      delay(500);
+      moveNow(home);
+      hold(500);
 
       // Roll right
       Log.info("Rolling right...");
-      platform.moveTo(instance->servoValues, 0, 0, 0, 0, 15, 0);
-      delay(1000);
+      moveNow({0, 0, 0, 0, 15, 0});
+      hold(1000);
 
       // Return to home
-      platform.home(instance->servoValues);
-      delay(500);
+      moveNow(home);
+      hold(500);
 
       // Combined pitch and roll
       Log.info("Combined pitch and roll...");
-      platform.moveTo(instance->servoValues, 0, 0, 0, 10, 10, 0);
-      delay(1000);
+      moveNow({0, 0, 0, 10, 10, 0});
+      hold(1000);
 
       // Return to home
-      platform.home(instance->servoValues);
-      delay(500);
+      moveNow(home);
+      hold(500);
 
       // Heave up
       Log.info("Heaving up...");
-      platform.moveTo(instance->servoValues, 0, 0, 20, 0, 0, 0);
-      delay(1000);
+      moveNow({0, 0, 20, 0, 0, 0});
+      hold(1000);
 
       // Return to home
-      platform.home(instance->servoValues);
+      moveNow(home);
+      loopChanged();
 
       Log.info("Demo complete");
 
@@ -353,33 +409,61 @@ namespace stewy
       int heave = (argc > 5) ? atoi(argv[5]) : 0;
       float yaw = (argc > 6) ? atof(argv[6]) : 0;
 
-      core::Platform platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
-
       if (argc <= 3)
       {
         // Just pitch and roll
-        if (!platform.moveTo(instance->servoValues, pitch, roll))
-        {
-          Log.error("Failed to move platform");
-          return SHELL_RET_FAILURE;
-        }
+        instance->arbiter->submitPitchRoll(core::SOURCE_COMMAND_LINE, PRIORITY_COMMAND_LINE, pitch, roll);
       }
       else
       {
         // Full 6DOF movement
-        if (!platform.moveTo(instance->servoValues, sway, surge, heave, pitch, roll, yaw))
-        {
-          Log.error("Failed to move platform");
-          return SHELL_RET_FAILURE;
-        }
+        const core::Pose pose = {(float)sway, (float)surge, (float)heave, pitch, roll, yaw};
+        instance->arbiter->submit(core::SOURCE_COMMAND_LINE, PRIORITY_COMMAND_LINE, pose);
       }
 
-      Log.info("Platform moved to pitch=%.2f, roll=%.2f, sway=%d, surge=%d, heave=%d, yaw=%.2f",
+      // Solved with the other requests of this tick; a rejected pose is logged by the platform
+      loopChanged();
+      Log.info("Platform move requested to pitch=%.2f, roll=%.2f, sway=%d, surge=%d, heave=%d, yaw=%.2f",
                pitch, roll, sway, surge, heave, yaw);
 
       return SHELL_RET_SUCCESS;
     }
 
+    void CommandLine::loopChanged()
+    {
+      if (instance->recorder != nullptr)
+      {
+        instance->recorder->requestKeyframe(core::RECORD_KEYFRAME_CHANGE);
+      }
+    }
+
+    bool CommandLine::moveNow(const core::Pose &pose)
+    {
+      core::PoseArbiter *arbiter = instance->arbiter;
+      arbiter->submit(core::SOURCE_COMMAND_LINE, PRIORITY_COMMAND_LINE, pose);
+      bool moved = arbiter->update(instance->servoValues);
+      instance->moveServos();
+
+      // With POSE_INTERPOLATION_ENABLED, the platform gets there over several control ticks
+      while (moved && !arbiter->isSettled())
+      {
+        delayMicroseconds(CONTROL_INTERVAL_US);
+        moved = arbiter->update(instance->servoValues);
+        instance->moveServos();
+      }
+      return moved;
+    }
+
+    void CommandLine::hold(unsigned long ms)
+    {
+      const unsigned long start = millis();
+      while (millis() - start < ms)
+      {
+        delayMicroseconds(CONTROL_INTERVAL_US);
+        instance->moveServos();
+      }
+    }
+
     int CommandLine::handleLog(int argc, char **argv)
     {
       if (argc != 2)
@@ -429,6 +513,271 @@ namespace stewy
       return SHELL_RET_SUCCESS;
     }
 
+    int CommandLine::handleCache(int argc, char **argv)
+    {
+#if defined(POSE_CACHE_ENABLED) || defined(IK_LUT_ENABLED)
+      if (argc > 2 || (argc == 2 && strcmp(argv[1], "clear") != 0))
+      {
+        Log.error("Usage: cache [clear]");
+        return SHELL_RET_FAILURE;
+      }
+
+#ifdef POSE_CACHE_ENABLED
+      core::PoseCache &cache = core::Platform::getPoseCache();
+#endif
+#ifdef IK_LUT_ENABLED
+      core::PitchRollTable &table = core::Platform::getPitchRollTable();
+#endif
+
+      if (argc == 2)
+      {
+#ifdef POSE_CACHE_ENABLED
+        cache.invalidate();
+        cache.resetStats();
+        Log.info("Pose cache cleared");
+#endif
+#ifdef IK_LUT_ENABLED
+        table.resetStats();
+#endif
+        return SHELL_RET_SUCCESS;
+      }
+
+#ifdef POSE_CACHE_ENABLED
+      const unsigned long hits = cache.getHits();
+      const unsigned long lookups = hits + cache.getMisses();
+      Log.info("Pose cache:");
+      Log.info("  Entries: %d / %d", (int)cache.getSize(), (int)cache.getCapacity());
+      Log.info("  Hits: %lu", hits);
+      Log.info("  Misses: %lu", cache.getMisses());
+      Log.info("  Hit rate: %.2f%%", lookups ? 100.0f * hits / lookups : 0.0f);
+#endif
+#ifdef IK_LUT_ENABLED
+      const unsigned long tableHits = table.getHits();
+      const unsigned long tableLookups = tableHits + table.getMisses();
+      Log.info("Pitch/roll lookup table:");
+      Log.info("  Hits: %lu", tableHits);
+      Log.info("  Misses: %lu", table.getMisses());
+      Log.info("  Hit rate: %.2f%%", tableLookups ? 100.0f * tableHits / tableLookups : 0.0f);
+#endif
+
+      return SHELL_RET_SUCCESS;
+#else
+      Log.error("Neither the pose cache nor the lookup table is enabled");
+      return SHELL_RET_FAILURE;
+#endif
+    }
+
+    int CommandLine::handleStats(int argc, char **argv)
+    {
+      if (argc != 1)
+      {
+        Log.error("Usage: stats");
+        return SHELL_RET_FAILURE;
+      }
+
+      if (instance->profiler != nullptr)
+      {
+        core::Profiler &profiler = *instance->profiler;
+        Log.info("Stages (runs: min / mean / max us):");
+        for (int s = 0; s < core::STAGE_COUNT; s++)
+        {
+          const core::StageStats &stats = profiler.getStats((core::ProfileStage)s);
+          const char *name = core::Profiler::getStageString((core::ProfileStage)s);
+          if (stats.count == 0)
+          {
+            Log.info("  %s: 0", name);
+            continue;
+          }
+
+          Log.info("  %s: %lu: %.2f / %.2f / %.2f", name, (unsigned long)stats.count,
+                   profiler.toMicroseconds(stats.minCycles), profiler.toMicroseconds((double)stats.totalCycles / stats.count),
+                   profiler.toMicroseconds(stats.maxCycles));
+
+          // Bucket b holds the runs of 2^b to 2^(b+1) cycles
+          for (int b = 0; b < core::PROFILE_BUCKETS; b++)
+          {
+            if (stats.histogram[b] != 0)
+            {
+              Log.info("    %.2f - %.2f us: %lu", profiler.toMicroseconds(b == 0 ? 0.0 : (double)(1ul << b)),
+                       profiler.toMicroseconds(2.0 * (1ul << b)), (unsigned long)stats.histogram[b]);
+            }
+          }
+        }
+        profiler.reset();
+      }
+      else
+      {
+        Log.info("Stage timings are not enabled");
+      }
+
+      if (instance->scheduler != nullptr)
+      {
+        core::Scheduler &scheduler = *instance->scheduler;
+        Log.info("Tasks (runs / overruns / max latency us / max run us):");
+        for (int t = 0; t < scheduler.getTaskCount(); t++)
+        {
+          const core::TaskStats &stats = scheduler.getStats(t);
+          Log.info("  %s: %lu / %lu / %lu / %lu", scheduler.getTask(t).name, stats.runs, stats.overruns,
+                   (unsigned long)stats.maxLatencyUs, (unsigned long)stats.maxRunUs);
+        }
+        scheduler.resetStats();
+      }
+
+      return SHELL_RET_SUCCESS;
+    }
+
+    int CommandLine::handleRecord(int argc, char **argv)
+    {
+      if (argc > 2)
+      {
+        Log.error("Usage: record [start | stop | send]");
+        return SHELL_RET_FAILURE;
+      }
+
+      if (instance->recorder == nullptr)
+      {
+        Log.error("The recorder is not enabled");
+        return SHELL_RET_FAILURE;
+      }
+
+      core::Recorder &recorder = *instance->recorder;
+      if (argc == 2 && strcmp(argv[1], "start") == 0)
+      {
+        recorder.start();
+        Log.info("Recording, the last %d entries are kept", recorder.getCapacity());
+        return SHELL_RET_SUCCESS;
+      }
+
+      if (argc == 2 && strcmp(argv[1], "send") == 0)
+      {
+        recorder.stop();
+
+        // Header: what the replay needs besides the entries, as the touchscreen driver has it now
+        drivers::TouchCalibration calibration = {0, 0, 0, 0, false};
+        double gains[6] = {0, 0, 0, 0, 0, 0};
+        if (instance->touchscreen != nullptr)
+        {
+          calibration = instance->touchscreen->getCalibration();
+          instance->touchscreen->getPID('x', gains[0], gains[1], gains[2]);
+          instance->touchscreen->getPID('y', gains[3], gains[4], gains[5]);
+        }
+
+        char line[256];
+        snprintf(line, sizeof(line), "STEWY-RECORD 2 %d %lu %lu %d %d %d %d %d %.17g %.17g %.17g %.17g %.17g %.17g",
+                 recorder.getCount(), (unsigned long)recorder.getFirstTime(), recorder.getOverwritten(),
+                 calibration.isCalibrated ? 1 : 0, calibration.minX, calibration.maxX, calibration.minY, calibration.maxY,
+                 gains[0], gains[1], gains[2], gains[3], gains[4], gains[5]);
+        writeLine(line);
+
+        // Entries, oldest first, four to a line
+        static const char HEX_DIGITS[] = "0123456789abcdef";
+        uint32_t checksum = core::RECORD_CHECKSUM_SEED;
+        for (int i = 0; i < recorder.getCount(); i += 4)
+        {
+          char *out = line + snprintf(line, sizeof(line), "STEWY-DATA ");
+          for (int e = i; e < i + 4 && e < recorder.getCount(); e++)
+          {
+            uint8_t bytes[core::RECORD_ENTRY_BYTES];
+            core::Recorder::encode(recorder.getEntry(e), bytes);
+            checksum = core::Recorder::checksum(checksum, bytes, sizeof(bytes));
+            for (uint8_t byte : bytes)
+            {
+              *out++ = HEX_DIGITS[byte >> 4];
+              *out++ = HEX_DIGITS[byte & 0x0F];
+            }
+          }
+          *out = '\0';
+          writeLine(line);
+        }
+
+        snprintf(line, sizeof(line), "STEWY-END %08lx", (unsigned long)checksum);
+        writeLine(line);
+        return SHELL_RET_SUCCESS;
+      }
+
+      if (argc == 2 && strcmp(argv[1], "stop") == 0)
+      {
+        recorder.stop();
+      }
+      else if (argc == 2)
+      {
+        Log.error("Usage: record [start | stop | send]");
+        return SHELL_RET_FAILURE;
+      }
+
+      Log.info("Recorder %s: %d of %d entries (%.2f s), %lu overwritten", recorder.isRecording() ? "recording" : "stopped",
+               recorder.getCount(), recorder.getCapacity(),
+               recorder.getCount() > 0 ? (recorder.getLastTime() - recorder.getFirstTime()) * 1e-6f : 0.0f,
+               recorder.getOverwritten());
+      return SHELL_RET_SUCCESS;
+    }
+
+    void CommandLine::writeLine(const char *line)
+    {
+      while (*line != '\0')
+      {
+        hal::serialWrite(*line++);
+      }
+      hal::serialWrite('\r');
+      hal::serialWrite('\n');
+    }
+
+    int CommandLine::handleGeometry(int argc, char **argv)
+    {
+      if (argc == 2 && strcmp(argv[1], "save") == 0)
+      {
+        core::Platform::saveGeometry();
+        return SHELL_RET_SUCCESS;
+      }
+
+      if (argc == 2 && strcmp(argv[1], "load") == 0)
+      {
+        if (!core::Platform::loadGeometry())
+        {
+          Log.error("No valid geometry saved in EEPROM");
+          return SHELL_RET_FAILURE;
+        }
+        loopChanged();
+        return SHELL_RET_SUCCESS;
+      }
+
+      if (argc == 2 && strcmp(argv[1], "reset") == 0)
+      {
+        core::Platform::resetGeometry();
+        Log.info("Platform geometry reset to defaults");
+        loopChanged();
+        return SHELL_RET_SUCCESS;
+      }
+
+      if (argc == 3)
+      {
+        if (!core::Platform::setGeometryParam(argv[1], atof(argv[2])))
+        {
+          Log.error("Unknown parameter %s, or value %s gives an invalid geometry", argv[1], argv[2]);
+          return SHELL_RET_FAILURE;
+        }
+        Log.info("Set %s to %s (not saved, use \"geom save\")", argv[1], argv[2]);
+        loopChanged();
+        return SHELL_RET_SUCCESS;
+      }
+
+      if (argc != 1)
+      {
+        Log.error("Usage: geom [<parameter> <value> | save | load | reset]");
+        return SHELL_RET_FAILURE;
+      }
+
+      const core::GeometryProfile &geometry = core::Platform::getGeometry();
+      Log.info("Platform geometry%s:", geometry.isDefault() ? " (defaults)" : "");
+      for (int i = 0; i < core::GEOMETRY_PARAM_COUNT; i++)
+      {
+        const core::GeometryParam &param = core::GEOMETRY_PARAMS[i];
+        Log.info("  %s: %.2f", param.name, geometry.getDescription().*param.field);
+      }
+
+      return SHELL_RET_SUCCESS;
+    }
+
     int CommandLine::handlePID(int argc, char **argv)
     {
 #ifdef ENABLE_TOUCHSCREEN
@@ -472,6 +821,7 @@ namespace stewy
 
       // Set the new PID values
       instance->touchscreen->setPID(axis, p, i, d);
+      loopChanged();
 
       Log.info("%c-axis PID values: P=%.2f, I=%.2f, D=%.2f", toupper(axis), p, i, d);
 
@@ -487,6 +837,7 @@ namespace stewy
 #ifdef ENABLE_TOUCHSCREEN
       Log.info("Starting touchscreen calibration...");
       instance->touchscreen->startCalibration();
+      loopChanged();
       return SHELL_RET_SUCCESS;
 #else
       Log.error("Touchscreen support is not enabled");
@@ -499,6 +850,7 @@ namespace stewy
 #ifdef ENABLE_TOUCHSCREEN
       Log.info("Resetting PID controllers to default values...");
       instance->touchscreen->resetPID();
+      loopChanged();
       return SHELL_RET_SUCCESS;
 #else
       Log.error("Touchscreen support is not enabled");
@@ -0,0 +1,663 @@
+/**
+ * @file BallSim.cpp
+ * @brief Ball-on-plate simulator, to evaluate the ball controller faster than real time
+ *
+ * This tool runs the firmware's ball control path, unchanged, against a
+ * model of the rig: TouchScreenDriver samples the touchscreen, filters it
+ * and runs its PIDs, and the PoseArbiter solves the resulting pitch and roll
+ * on a Platform, with the task periods and phases of main.cpp. Everything
+ * runs on the native HAL (src/hal/native/), with the clock on simulated
+ * time, so a run takes a fraction of its simulated duration and gives the
+ * same result every time.
+ *
+ * The servo setpoints go out as in main.cpp: with SERVO_CONTROLLER_ENABLED,
+ * through a ServoController ticked by the servo timer (on simulated time),
+ * otherwise written at the end of each control tick; either way mapped to
+ * pulse widths by a ServoOutput with SERVO_REVERSE and SERVO_TRIM, and
+ * written to the native servo outputs. Without SERVO_CONTROLLER_ENABLED,
+ * the profiles of SERVO_ACCELERATION_ENABLED are not modelled.
+ *
+ * The model of the rig:
+ * - servos that only see a new pulse width at the start of a PWM frame
+ *   (20 ms with the Servo library, SERVO_PWM_FRAME_HZ with SERVO_PWM_ENABLED),
+ *   take it as the angle it stands for (trims that match the horns), and
+ *   slew towards it at a limited speed;
+ * - the plate attitude, from where the servos actually are, with the
+ *   forward kinematics of a second Platform;
+ * - a solid ball rolling without slipping on the tilted plate, pulled by
+ *   the component of gravity off the plate normal, with some rolling
+ *   resistance, that falls off at the edges;
+ * - the touchscreen ADC, with gaussian noise and missed readings, its axes
+ *   laid on the plate axes as TOUCH_X_AXIS and TOUCH_Y_AXIS say.
+ *
+ * For each scenario, it reports how long the ball takes to settle within
+ * SETTLE_BAND_MM of the setpoint for good, how far it overshoots, and the RMS
+ * distance to the setpoint over the run. The gains are those of the firmware
+ * (resetPID()), or P, I and D from the command line for both axes, as the
+ * px/ix/dx and py/iy/dy commands would set them on the rig.
+ *
+ * It then runs the moves of the demo command and a few moveto commands, and
+ * reports how many solves the pitch/roll lookup table and the pose cache
+ * served over all the runs. It exits with 1 if either is enabled in
+ * Config.h and never served one, i.e. if the arbiter no longer routes its
+ * solves through them.
+ *
+ * Finally, it types `demo` on the shell, and checks the pulse widths written
+ * while the command blocks the loop: it exits with 1 unless the servos get
+ * to each pose of the demo before the command returns.
+ *
+ * It needs the PID and ArduinoLog libraries, so it is built by PlatformIO,
+ * from the repository root:
+ *   pio run -e ballsim
+ *   .pio/build/ballsim/program [P I D]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include "core/Config.h"
+#include "core/Orientation.h"
+#include "core/Platform.h"
+#include "core/PoseArbiter.h"
+#include "core/Scheduler.h"
+#include "core/ServoController.h"
+#include "core/ServoOutput.h"
+#include "drivers/TouchScreen.h"
+#include "hal/Clock.h"
+#include "hal/Native.h"
+#include "hal/ServoOut.h"
+#include "ui/CommandLine.h"
+
+#ifndef ENABLE_TOUCHSCREEN
+#error "The ball simulator needs ENABLE_TOUCHSCREEN"
+#endif
+
+using namespace stewy;
+
+// The rig (adjust to the screen and servos actually fitted)
+const float PLATE_WIDTH_MM = 228.0f;  // Touch area along the X reading
+const float PLATE_HEIGHT_MM = 175.0f; // Touch area along the Y reading
+const float SERVO_SLEW = 1000.0f;     // Servo speed, in servo angle units per second (about 0.15 s/60 degrees over 755-2250 us)
+#ifdef SERVO_PWM_ENABLED
+const uint32_t SERVO_FRAME_US = 1000000 / SERVO_PWM_FRAME_HZ;
+#else
+const uint32_t SERVO_FRAME_US = 20000; // Servo library frames
+#endif
+const float ROLLING_RESISTANCE = 0.3f; // Deceleration per unit of speed (1/s)
+const float TOUCH_NOISE_ADC = 4.0f;    // Standard deviation of a reading, in ADC counts
+const float TOUCH_DROPOUT = 0.01f;     // Chance that a reading misses the ball
+const int TOUCH_PRESSURE = 400;        // Pressure of the ball on the screen
+
+// Touchscreen axes, as unit vectors on the plate axes: the X reading grows
+// along plate +X, the Y reading along plate -Y. The PIDs (both DIRECT) answer
+// a ball at a larger reading than the setpoint with a negative roll or pitch,
+// which must bring it back. With the IK rotation Rz(yaw) * Ry(roll) *
+// Rx(pitch), negative roll raises plate +X, and negative pitch lowers plate
+// +Y, so this is how the screen must be laid on the plate for the loop to be
+// stable.
+const float TOUCH_X_AXIS[2] = {1, 0};
+const float TOUCH_Y_AXIS[2] = {0, -1};
+
+const float GRAVITY_MM = 9810.0f;
+const float ROLLING_FACTOR = 5.0f / 7.0f; // Solid sphere rolling without slipping
+
+const uint32_t PHYSICS_STEP_US = 1000;
+const float SETTLE_BAND_MM = 5.0f;
+
+/**
+ * @struct Scenario
+ * @brief Starting state of the ball, and setpoint
+ */
+struct Scenario
+{
+  const char *name;
+  float x, y;                 ///< Ball position, mm from the center along plate X and Y
+  float vx, vy;               ///< Ball velocity, mm/s along plate X and Y
+  float setpointX, setpointY; ///< Setpoint, normalized (-1.0 to 1.0) as from the nunchuck
+  float noiseScale;           ///< Multiplier of TOUCH_NOISE_ADC
+  uint32_t durationUs;
+};
+
+const Scenario SCENARIOS[] = {
+    {"release off-center", 60, 40, 0, 0, 0, 0, 1, 10000000},
+    {"rolling in", -90, 0, 150, 0, 0, 0, 1, 10000000},
+    {"setpoint step", 0, 0, 0, 0, 0.5f, -0.4f, 1, 10000000},
+    {"release, 3x noise", 60, 40, 0, 0, 0, 0, 3, 10000000},
+};
+
+/**
+ * @struct Result
+ * @brief Response to one scenario
+ */
+struct Result
+{
+  bool fell;           ///< The ball left the plate
+  uint32_t fellUs;     ///< When it did
+  uint32_t settledUs;  ///< Last time the ball was outside the band, 0 if never
+  bool settled;        ///< The ball ended inside the band
+  float overshootMm;   ///< Furthest past the setpoint, against the initial error
+  float rmsMm;         ///< RMS distance to the setpoint
+  uint32_t runUs;      ///< Simulated time of the run
+  double wallSeconds;  ///< Host time of the run
+};
+
+// Servo outputs, as in main.cpp
+static core::ServoOutput servoOutput(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, SERVO_MIN_US, SERVO_MAX_US, core::SERVO_REVERSE,
+                                     core::SERVO_TRIM);
+
+static void writeServo(int servo, uint16_t us)
+{
+  hal::servoWrite(servo, us);
+}
+
+#ifdef SERVO_CONTROLLER_ENABLED
+#ifdef SERVO_ACCELERATION_ENABLED
+static const core::ServoProfile servoProfile(SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG);
+static core::ServoController servoController(servoOutput, writeServo, &servoProfile);
+#else
+static core::ServoController servoController(servoOutput, writeServo, nullptr);
+#endif
+
+static void servoTimerIsr()
+{
+  servoController.tick(hal::micros());
+  hal::servoFlush();
+}
+#endif
+
+// Firmware objects of the run, for the tasks
+static core::Platform *platform;
+static core::PoseArbiter *arbiter;
+static drivers::TouchScreenDriver *touchscreen;
+static float servoValues[6];
+static core::xy_coordf setpoint;
+
+// Model state
+static core::Platform *rig; // Forward kinematics of the plate, apart from the controller's platform
+static float servoLatched[6];
+static float servoPositions[6];
+static uint32_t nextFrameUs;
+static float ballX, ballY, ballVx, ballVy; // On the plate axes
+static bool onPlate;
+static std::mt19937 noise;
+static float noiseScale;
+
+// Metrics of the run
+static uint32_t startUs;
+static float targetX, targetY, initialX, initialY;
+static double squaredErrors;
+static unsigned long errorSamples;
+static Result result;
+
+static void touchSampleTask()
+{
+  touchscreen->sample();
+}
+
+static void ballControlTask()
+{
+  touchscreen->control(setpoint.x, setpoint.y, *arbiter);
+}
+
+// Hand the setpoints over to the servos, as updateServos() of main.cpp
+static void updateServos()
+{
+#ifdef SERVO_CONTROLLER_ENABLED
+  servoController.setTargets(servoValues);
+#else
+  for (int i = 0; i < 6; i++)
+  {
+    if (servoOutput.update(i, servoValues[i]))
+    {
+      writeServo(i, servoOutput.getMicroseconds(i));
+    }
+  }
+  hal::servoFlush();
+#endif
+}
+
+static void controlTask()
+{
+  arbiter->update(servoValues);
+  updateServos();
+}
+
+// The task periods and phases of main.cpp
+const core::SchedulerTask TASKS[] = {
+    {"touch", touchSampleTask, TOUCH_SAMPLE_INTERVAL_US, 0, 5},
+    {"ball", ballControlTask, BALL_CONTROL_INTERVAL_US, 1500, 4},
+    {"control", controlTask, CONTROL_INTERVAL_US, 3000, 3},
+};
+
+/**
+ * Angle a servo goes to for a pulse width: the inverse of ServoOutput, with trims that match the horns.
+ */
+static float pulseToAngle(int servo, uint16_t us)
+{
+  const float scale = (float)(SERVO_MAX_US - SERVO_MIN_US) / (SERVO_MAX_ANGLE - SERVO_MIN_ANGLE);
+  const float travel = (us - core::SERVO_TRIM[servo] - SERVO_MIN_US) / scale;
+  return core::SERVO_REVERSE[servo] ? SERVO_MAX_ANGLE - travel : SERVO_MIN_ANGLE + travel;
+}
+
+/**
+ * Position of a point of the plate along the touchscreen axes, in mm from the center.
+ */
+static void toTouch(float x, float y, float &u, float &v)
+{
+  u = x * TOUCH_X_AXIS[0] + y * TOUCH_X_AXIS[1];
+  v = x * TOUCH_Y_AXIS[0] + y * TOUCH_Y_AXIS[1];
+}
+
+/**
+ * Touchscreen reading of the ball where it is now.
+ */
+static void updateTouchPoint()
+{
+  hal::TouchPoint point = {0, 0, 0};
+  std::normal_distribution<float> gaussian(0.0f, TOUCH_NOISE_ADC * noiseScale);
+  std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+  if (onPlate && uniform(noise) >= TOUCH_DROPOUT)
+  {
+    float u, v;
+    toTouch(ballX, ballY, u, v);
+    const float x = TS_DEFAULT_MIN_X + (u / PLATE_WIDTH_MM + 0.5f) * (TS_DEFAULT_MAX_X - TS_DEFAULT_MIN_X);
+    const float y = TS_DEFAULT_MIN_Y + (v / PLATE_HEIGHT_MM + 0.5f) * (TS_DEFAULT_MAX_Y - TS_DEFAULT_MIN_Y);
+    point.x = (int16_t)constrain(lroundf(x + gaussian(noise)), 0L, 1023L);
+    point.y = (int16_t)constrain(lroundf(y + gaussian(noise)), 0L, 1023L);
+    point.z = TOUCH_PRESSURE;
+  }
+  hal::native::setTouchPoint(point);
+}
+
+/**
+ * Move the servos, the plate and the ball one step forward.
+ */
+static void stepPhysics(uint32_t stepUs)
+{
+  const uint32_t now = hal::micros();
+  const float dt = stepUs * 1e-6f;
+
+  // A servo takes a new pulse width at the start of a frame only
+  if ((int32_t)(now - nextFrameUs) >= 0)
+  {
+    for (int i = 0; i < 6; i++)
+    {
+      servoLatched[i] = pulseToAngle(i, hal::servoRead(i));
+    }
+    nextFrameUs += SERVO_FRAME_US;
+  }
+  for (int i = 0; i < 6; i++)
+  {
+    const float step = SERVO_SLEW * dt;
+    servoPositions[i] += constrain(servoLatched[i] - servoPositions[i], -step, step);
+  }
+
+  // Plate attitude, from where the servos are, as the rotation of the IK: its columns are the plate axes
+  float pose[6];
+  rig->estimatePose(servoPositions, pose);
+  core::RotationMatrix r;
+  core::orientation::fromEuler(pose[3], pose[4], pose[5], r);
+
+  if (onPlate)
+  {
+    // Gravity off the plate normal pulls the ball along the plate
+    const float normal[3] = {r.m[0][2], r.m[1][2], r.m[2][2]};
+    const float gravity[3] = {0, 0, -GRAVITY_MM};
+    const float normalGravity = gravity[2] * normal[2];
+    float along[3];
+    for (int k = 0; k < 3; k++)
+    {
+      along[k] = gravity[k] - normalGravity * normal[k];
+    }
+    const float ax = along[0] * r.m[0][0] + along[1] * r.m[1][0] + along[2] * r.m[2][0];
+    const float ay = along[0] * r.m[0][1] + along[1] * r.m[1][1] + along[2] * r.m[2][1];
+
+    ballVx += (ROLLING_FACTOR * ax - ROLLING_RESISTANCE * ballVx) * dt;
+    ballVy += (ROLLING_FACTOR * ay - ROLLING_RESISTANCE * ballVy) * dt;
+    ballX += ballVx * dt;
+    ballY += ballVy * dt;
+
+    float u, v;
+    toTouch(ballX, ballY, u, v);
+    if (fabsf(u) > PLATE_WIDTH_MM / 2 || fabsf(v) > PLATE_HEIGHT_MM / 2)
+    {
+      onPlate = false;
+      result.fell = true;
+      result.fellUs = now + stepUs - startUs;
+    }
+  }
+
+  hal::native::advanceClock(stepUs);
+  updateTouchPoint();
+
+  // Distance to the setpoint, and how far the ball went past it
+  if (onPlate)
+  {
+    const float dx = ballX - targetX, dy = ballY - targetY;
+    const float error = sqrtf(dx * dx + dy * dy);
+    squaredErrors += error * error;
+    errorSamples++;
+
+    const float initial = sqrtf(initialX * initialX + initialY * initialY);
+    if (initial > 0)
+    {
+      const float past = -(dx * initialX + dy * initialY) / initial;
+      result.overshootMm = max(result.overshootMm, past);
+    }
+    if (error > SETTLE_BAND_MM)
+    {
+      result.settledUs = hal::micros() - startUs;
+    }
+    result.settled = error <= SETTLE_BAND_MM;
+  }
+}
+
+/**
+ * Idle time of the scheduler: the model runs until the next task is due.
+ */
+static void simulateUntil(uint32_t untilUs)
+{
+  int32_t remaining;
+  while ((remaining = (int32_t)(untilUs - hal::micros())) > 0)
+  {
+    stepPhysics(min((uint32_t)remaining, PHYSICS_STEP_US));
+  }
+}
+
+static uint32_t simulatedClock()
+{
+  return hal::micros();
+}
+
+static Result run(const Scenario &scenario, int argc, char **argv)
+{
+  const std::chrono::steady_clock::time_point wallStart = std::chrono::steady_clock::now();
+
+  platform = new core::Platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+  arbiter = new core::PoseArbiter(*platform);
+  rig = new core::Platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+  touchscreen = new drivers::TouchScreenDriver(XP, YP, XM, YM, TS_OHMS);
+  touchscreen->init();
+  if (argc == 4)
+  {
+    touchscreen->setPID('x', atof(argv[1]), atof(argv[2]), atof(argv[3]));
+    touchscreen->setPID('y', atof(argv[1]), atof(argv[2]), atof(argv[3]));
+  }
+
+  // Platform and servos at home, the ball placed on the plate
+  platform->home(servoValues);
+#ifdef SERVO_CONTROLLER_ENABLED
+  servoController.begin(servoValues, hal::micros());
+#else
+  servoOutput.invalidate();
+#endif
+  for (int i = 0; i < 6; i++)
+  {
+    writeServo(i, servoOutput.toMicroseconds(i, servoValues[i]));
+  }
+  memcpy(servoLatched, servoValues, sizeof(servoLatched));
+  memcpy(servoPositions, servoValues, sizeof(servoPositions));
+  nextFrameUs = hal::micros();
+  ballX = scenario.x;
+  ballY = scenario.y;
+  ballVx = scenario.vx;
+  ballVy = scenario.vy;
+  onPlate = true;
+  noise.seed(1);
+  noiseScale = scenario.noiseScale;
+  setpoint.x = scenario.setpointX;
+  setpoint.y = scenario.setpointY;
+  updateTouchPoint();
+
+  // The controller maps the setpoint onto the calibrated area, which the touch area spans
+  const float targetU = scenario.setpointX * PLATE_WIDTH_MM / 2;
+  const float targetV = scenario.setpointY * PLATE_HEIGHT_MM / 2;
+  targetX = targetU * TOUCH_X_AXIS[0] + targetV * TOUCH_Y_AXIS[0];
+  targetY = targetU * TOUCH_X_AXIS[1] + targetV * TOUCH_Y_AXIS[1];
+  initialX = scenario.x - targetX;
+  initialY = scenario.y - targetY;
+  squaredErrors = 0;
+  errorSamples = 0;
+  result = Result();
+
+  core::Scheduler scheduler(TASKS, sizeof(TASKS) / sizeof(TASKS[0]), simulatedClock, simulateUntil);
+  startUs = hal::micros();
+  scheduler.begin();
+  while (onPlate && hal::micros() - startUs < scenario.durationUs)
+  {
+    scheduler.runOnce();
+  }
+
+  result.rmsMm = errorSamples > 0 ? sqrt(squaredErrors / errorSamples) : 0;
+  result.runUs = hal::micros() - startUs;
+  result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+  delete touchscreen;
+  delete rig;
+  delete arbiter;
+  delete platform;
+  return result;
+}
+
+/**
+ * The moves of the demo command, and two moveto commands that translate and rotate at
+ * once, twice, each solved until the arbiter settles.
+ */
+static void runDemo()
+{
+  static const core::Pose POSES[] = {
+      {0, 0, 0, 15, 0, 0},
+      {0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 15, 0},
+      {0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 10, 10, 0},
+      {0, 0, 0, 0, 0, 0},
+      {0, 0, 20, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0},
+      {0, 0, 10, 5, -5, 0},
+      {10, -10, 0, 0, 0, 10},
+      {0, 0, 0, 0, 0, 0},
+  };
+
+  platform = new core::Platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+  arbiter = new core::PoseArbiter(*platform);
+  platform->home(servoValues);
+
+  for (int pass = 0; pass < 2; pass++)
+  {
+    for (const core::Pose &pose : POSES)
+    {
+      arbiter->submit(core::SOURCE_COMMAND_LINE, PRIORITY_COMMAND_LINE, pose);
+      do
+      {
+        arbiter->update(servoValues);
+      } while (!arbiter->isSettled());
+    }
+  }
+
+  delete arbiter;
+  delete platform;
+}
+
+// Poses of the demo command, in order, and the pulse widths of each
+static const core::Pose DEMO_POSES[] = {
+    {0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 10, 10, 0},
+    {0, 0, 0, 0, 0, 0},
+    {0, 0, 20, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0},
+};
+const int DEMO_POSE_COUNT = sizeof(DEMO_POSES) / sizeof(DEMO_POSES[0]);
+static uint16_t demoPulses[DEMO_POSE_COUNT][6];
+static int demoPosesReached;
+
+/**
+ * Hand the setpoints over, for the demo command, and note when the servos get to the next pose of the demo.
+ */
+static void demoUpdateServos()
+{
+  updateServos();
+  if (demoPosesReached == DEMO_POSE_COUNT)
+  {
+    return;
+  }
+  bool reached = true;
+  for (int i = 0; i < 6; i++)
+  {
+    reached &= hal::servoRead(i) == demoPulses[demoPosesReached][i];
+  }
+  demoPosesReached += reached;
+}
+
+/**
+ * The demo command, typed on the shell. It blocks the loop, so it must hand its moves over to the servos itself.
+ *
+ * @return true if the servos got to each pose of the demo before it returned
+ */
+static bool runDemoCommand()
+{
+  platform = new core::Platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+  arbiter = new core::PoseArbiter(*platform);
+
+  // The pulse widths of each pose, from the IK itself
+  const core::IkKernel<core::ik_scalar_t> kernel(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+  for (int k = 0; k < DEMO_POSE_COUNT; k++)
+  {
+    const core::Pose &p = DEMO_POSES[k];
+    float angles[6];
+    int failedLeg;
+    float value;
+    kernel.solve(angles, p.sway, p.surge, p.heave, p.pitch, p.roll, p.yaw, failedLeg, value);
+    for (int i = 0; i < 6; i++)
+    {
+      demoPulses[k][i] = servoOutput.toMicroseconds(i, angles[i]);
+    }
+  }
+
+  // Start away from home, so that getting there is a move too
+  const core::Pose start = {0, 0, -10, 0, 0, 0};
+  arbiter->submit(core::SOURCE_COMMAND_LINE, PRIORITY_COMMAND_LINE, start);
+  do
+  {
+    arbiter->update(servoValues);
+    updateServos();
+    hal::delay(CONTROL_INTERVAL_US / 1000);
+  } while (!arbiter->isSettled());
+  hal::delay(1000);
+
+  demoPosesReached = 0;
+  ui::CommandLine commandLine(nullptr, nullptr, servoValues, demoUpdateServos, arbiter, nullptr, nullptr, nullptr);
+  commandLine.init();
+  hal::native::setSerialInput("demo\n");
+  const uint32_t demoStartUs = hal::micros();
+  commandLine.process();
+  printf("Demo command: the servos got to %d of its %d poses, over %.1f s\n", demoPosesReached, DEMO_POSE_COUNT,
+         (hal::micros() - demoStartUs) * 1e-6);
+
+  delete arbiter;
+  delete platform;
+  return demoPosesReached == DEMO_POSE_COUNT;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 1 && argc != 4)
+  {
+    fprintf(stderr, "Usage: %s [P I D]\n", argv[0]);
+    return 2;
+  }
+
+  // Simulated time, and neither a saved calibration nor a saved geometry: the defaults
+  hal::native::useVirtualClock();
+  hal::native::setStorePath("/dev/null");
+#ifdef SERVO_CONTROLLER_ENABLED
+  hal::timerBegin(servoTimerIsr, SERVO_UPDATE_INTERVAL_US);
+#endif
+  Log.begin(LOG_LEVEL_SILENT, &Serial);
+
+  if (argc == 4)
+  {
+    printf("Gains P=%s I=%s D=%s on both axes", argv[1], argv[2], argv[3]);
+  }
+  else
+  {
+    printf("Firmware gains (resetPID())");
+  }
+  printf(", servo frames %u ms, servos %.0f units/s, touch noise %.1f ADC\n\n", (unsigned)(SERVO_FRAME_US / 1000),
+         SERVO_SLEW, TOUCH_NOISE_ADC);
+  printf("%-20s %12s %14s %10s %12s\n", "scenario", "settling s", "overshoot mm", "RMS mm", "x real time");
+
+  for (const Scenario &scenario : SCENARIOS)
+  {
+    const Result r = run(scenario, argc, argv);
+    char settling[32];
+    if (r.fell)
+    {
+      snprintf(settling, sizeof(settling), "fell at %.2f", r.fellUs * 1e-6);
+    }
+    else if (!r.settled)
+    {
+      snprintf(settling, sizeof(settling), "no");
+    }
+    else
+    {
+      snprintf(settling, sizeof(settling), "%.2f", r.settledUs * 1e-6);
+    }
+    printf("%-20s %12s %14.1f %10.1f %12.0f\n", scenario.name, settling, r.overshootMm, r.rmsMm,
+           r.runUs * 1e-6 / r.wallSeconds);
+  }
+
+  printf("\n(settling: time to stay within %.0f mm of the setpoint, until the end of the run)\n", SETTLE_BAND_MM);
+
+  // The ball scenarios, then shell moves, which come back to poses solved before
+  runDemo();
+  bool failed = false;
+#ifdef IK_LUT_ENABLED
+  const core::PitchRollTable &table = core::Platform::getPitchRollTable();
+  printf("Pitch/roll lookup table: %lu hits, %lu misses\n", table.getHits(), table.getMisses());
+  failed |= table.getHits() == 0;
+#endif
+#ifdef POSE_CACHE_ENABLED
+  const core::PoseCache &cache = core::Platform::getPoseCache();
+  printf("Pose cache: %lu hits, %lu misses\n", cache.getHits(), cache.getMisses());
+  failed |= cache.getHits() == 0;
+#endif
+  if (failed)
+  {
+    printf("FAIL: the arbiter never went through the lookup table or the pose cache\n");
+    return 1;
+  }
+
+  if (!runDemoCommand())
+  {
+    printf("FAIL: the demo command returned before the servos got to its poses\n");
+    return 1;
+  }
+  return 0;
+}
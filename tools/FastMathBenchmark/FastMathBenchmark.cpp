@@ -0,0 +1,180 @@
+/**
+ * @file FastMathBenchmark.cpp
+ * @brief Error bound checks and benchmark for the fast math functions
+ *
+ * This tool sweeps each function in FastMath.h at each accuracy level over
+ * its input domain, compares it with libm in double precision, and checks
+ * the worst-case error against the bounds documented in FastMath.h. It then
+ * times each function against its single precision libm counterpart.
+ *
+ * The exit status is non-zero if any bound is exceeded.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -I include tools/FastMathBenchmark/FastMathBenchmark.cpp -o fast_math_benchmark
+ *   ./fast_math_benchmark
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "core/FastMath.h"
+
+using namespace stewy;
+
+const int SWEEP_POINTS = 1000000;
+
+/**
+ * Documented error bounds, per accuracy level (see the table in FastMath.h).
+ */
+struct Bounds
+{
+  double sinCos;
+  double atan;
+  double asin;
+  double sqrtRelative;
+};
+
+static const Bounds BOUNDS[] = {
+    {7e-5, 9e-5, 1e-3, 2e-3}, // ACCURACY_LOW
+    {8e-7, 2e-6, 4e-6, 5e-6}, // ACCURACY_MEDIUM
+    {3e-7, 4e-7, 5e-7, 3e-7}  // ACCURACY_HIGH
+};
+
+static const char *LEVEL_NAMES[] = {"LOW", "MEDIUM", "HIGH"};
+
+static int failures = 0;
+
+static void check(const char *level, const char *name, double error, double bound)
+{
+  const bool ok = error <= bound;
+  printf("  %-6s %-6s max error %.2e (bound %.0e) %s\n", level, name, error, bound, ok ? "ok" : "FAILED");
+  if (!ok)
+  {
+    failures++;
+  }
+}
+
+template <math::Accuracy A>
+static void checkLevel()
+{
+  const Bounds &b = BOUNDS[A];
+  const char *level = LEVEL_NAMES[A];
+  double errSin = 0, errCos = 0, errAtan = 0, errAtan2 = 0, errAsin = 0, errSqrt = 0;
+
+  for (int i = 0; i <= SWEEP_POINTS; i++)
+  {
+    const double t = (double)i / SWEEP_POINTS; // [0, 1]
+
+    // sin/cos over two full turns, to exercise range reduction
+    const float angle = (float)(-2 * M_PI + 4 * M_PI * t);
+    float s, c;
+    math::sinCos<A>(angle, s, c);
+    errSin = fmax(errSin, fabs(s - ::sin((double)angle)));
+    errCos = fmax(errCos, fabs(c - ::cos((double)angle)));
+
+    // atan over [-100, 100], covering both polynomial branches
+    const float x = (float)(-100 + 200 * t);
+    errAtan = fmax(errAtan, fabs(math::atan<A>(x) - ::atan((double)x)));
+
+    // atan2 around the unit circle
+    const float ax = (float)::cos(2 * M_PI * t), ay = (float)::sin(2 * M_PI * t);
+    errAtan2 = fmax(errAtan2, fabs(math::atan2<A>(ay, ax) - ::atan2((double)ay, (double)ax)));
+
+    // asin over [-1, 1]
+    const float v = (float)(-1 + 2 * t);
+    errAsin = fmax(errAsin, fabs(math::asin<A>(v) - ::asin((double)v)));
+
+    // sqrt, relative error over 12 decades
+    const double r = ::pow(10.0, -6 + 12 * t);
+    errSqrt = fmax(errSqrt, fabs(math::sqrt<A>((float)r) - ::sqrt((double)(float)r)) / ::sqrt((double)(float)r));
+  }
+
+  check(level, "sin", errSin, b.sinCos);
+  check(level, "cos", errCos, b.sinCos);
+  check(level, "atan", errAtan, b.atan);
+  check(level, "atan2", errAtan2, b.atan);
+  check(level, "asin", errAsin, b.asin);
+  check(level, "sqrt", errSqrt, b.sqrtRelative);
+}
+
+static volatile float sink;
+
+template <typename F>
+static double timeIt(const std::vector<float> &inputs, F f)
+{
+  float acc = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < inputs.size(); i++)
+  {
+    acc += f(inputs[i]);
+  }
+  auto end = std::chrono::steady_clock::now();
+  sink = acc;
+  return std::chrono::duration<double, std::nano>(end - start).count() / inputs.size();
+}
+
+static void benchmark(const char *name, const std::vector<float> &inputs, float (*libm)(float),
+                      float (*low)(float), float (*medium)(float), float (*high)(float))
+{
+  printf("  %-6s %8.2f %8.2f %8.2f %8.2f\n", name,
+         timeIt(inputs, libm), timeIt(inputs, low), timeIt(inputs, medium), timeIt(inputs, high));
+}
+
+static float libmAtan2(float x) { return ::atan2f(x, 1.0f - x); }
+template <math::Accuracy A>
+static float fastAtan2(float x) { return math::atan2<A>(x, 1.0f - x); }
+
+int main()
+{
+  printf("Error bounds (sweep of %d points per function)\n", SWEEP_POINTS);
+  checkLevel<math::ACCURACY_LOW>();
+  checkLevel<math::ACCURACY_MEDIUM>();
+  checkLevel<math::ACCURACY_HIGH>();
+
+  const int n = 1000000;
+  std::vector<float> angles(n), unit(n), positive(n);
+  srand(1);
+  for (int i = 0; i < n; i++)
+  {
+    const float t = (float)rand() / (float)RAND_MAX;
+    angles[i] = (float)(-M_PI + 2 * M_PI * t);
+    unit[i] = -1 + 2 * t;
+    positive[i] = 1000 * t;
+  }
+
+  printf("\nTiming (ns/call)\n");
+  printf("  %-6s %8s %8s %8s %8s\n", "", "libm", "LOW", "MEDIUM", "HIGH");
+  benchmark("sin", angles, ::sinf, math::sin<math::ACCURACY_LOW>, math::sin<math::ACCURACY_MEDIUM>, math::sin<math::ACCURACY_HIGH>);
+  benchmark("cos", angles, ::cosf, math::cos<math::ACCURACY_LOW>, math::cos<math::ACCURACY_MEDIUM>, math::cos<math::ACCURACY_HIGH>);
+  benchmark("atan", unit, ::atanf, math::atan<math::ACCURACY_LOW>, math::atan<math::ACCURACY_MEDIUM>, math::atan<math::ACCURACY_HIGH>);
+  benchmark("atan2", unit, libmAtan2, fastAtan2<math::ACCURACY_LOW>, fastAtan2<math::ACCURACY_MEDIUM>, fastAtan2<math::ACCURACY_HIGH>);
+  benchmark("asin", unit, ::asinf, math::asin<math::ACCURACY_LOW>, math::asin<math::ACCURACY_MEDIUM>, math::asin<math::ACCURACY_HIGH>);
+  benchmark("sqrt", positive, ::sqrtf, math::sqrt<math::ACCURACY_LOW>, math::sqrt<math::ACCURACY_MEDIUM>, math::sqrt<math::ACCURACY_HIGH>);
+
+  if (failures > 0)
+  {
+    printf("\n%d error bound(s) exceeded\n", failures);
+    return 1;
+  }
+  printf("\nAll error bounds met\n");
+  return 0;
+}
@@ -0,0 +1,261 @@
+/**
+ * @file ForwardKinematicsBenchmark.cpp
+ * @brief Host benchmark and accuracy report for the forward kinematics
+ *
+ * This tool runs the pose estimate as main.cpp does, one tick per
+ * ESTIMATE_INTERVAL_US: each tick solves the IK for the next pose of a
+ * trajectory, moves the servos towards it with the ServoProfile of
+ * updateServos(), and estimates the pose from the slewed servo angles with
+ * ForwardKinematics. It reports convergence, iterations and kernel solves
+ * per tick, the servo angle residual, and the pose error on ticks where the
+ * servos have settled on their targets (the only ticks where the true pose
+ * is known).
+ *
+ * Host timings do not carry over to the Teensy, so the budget of the
+ * estimate task is counted in kernel solves: the worst observed tick and the
+ * worst-case bound (IK plus FK, as if the control task ran in the same
+ * tick). Given the cost of one solve on the device, they are checked
+ * against ESTIMATE_INTERVAL_US. To measure that cost, run the rig and divide
+ * the mean of the estimate stage of the `stats` command by the solves per
+ * estimate of the `dump` command.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -D USE_FAST_MATH -I include tools/ForwardKinematicsBenchmark/ForwardKinematicsBenchmark.cpp src/core/ForwardKinematics.cpp src/core/ServoProfile.cpp -o forward_kinematics_benchmark
+ *   ./forward_kinematics_benchmark [seconds] [measured us per solve on the device]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "core/ForwardKinematics.h"
+#include "core/ServoProfile.h"
+
+using namespace stewy::core;
+
+// Firmware settings (see Config.h)
+const int SERVO_MIN = 0;
+const int SERVO_MAX = 360;
+const float TICK_S = 0.020f;            // ESTIMATE_INTERVAL_US
+const float BUDGET_US = 20000;          // ESTIMATE_INTERVAL_US
+const float SERVO_MAX_SPEED_DEG = 500.0f;
+const float SERVO_MAX_ACCEL_DEG = 750.0f;
+const float SERVO_MAX_JERK_DEG = 15000.0f;
+const int FK_MAX_ITERATIONS = 2;
+const float FK_TOLERANCE = 0.01f;
+const float FK_STEP = 0.5f;
+
+struct Waypoint
+{
+  float v[6]; // sway, surge, heave, pitch, roll, yaw
+};
+
+static float randomIn(float lo, float hi)
+{
+  return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+/**
+ * Tilt only, with a new random target every 3 seconds, approached at the
+ * rate of the PD balance controller.
+ */
+static std::vector<Waypoint> balanceTrajectory(int ticks)
+{
+  std::vector<Waypoint> poses;
+  float pitch = 0, roll = 0, targetPitch = 0, targetRoll = 0;
+  for (int t = 0; t < ticks; t++)
+  {
+    if (t % 150 == 0)
+    {
+      targetPitch = randomIn(-15, 15);
+      targetRoll = randomIn(-15, 15);
+    }
+    pitch += 0.1f * (targetPitch - pitch) + randomIn(-0.2f, 0.2f);
+    roll += 0.1f * (targetRoll - roll) + randomIn(-0.2f, 0.2f);
+    Waypoint p = {{0, 0, 0, pitch, roll, 0}};
+    poses.push_back(p);
+  }
+  return poses;
+}
+
+/**
+ * Slow six-axis sweep within the platform envelope.
+ */
+static std::vector<Waypoint> joystickTrajectory(int ticks)
+{
+  std::vector<Waypoint> poses;
+  for (int t = 0; t < ticks; t++)
+  {
+    const float s = t * TICK_S;
+    Waypoint p = {{20 * sinf(0.7f * s), 20 * sinf(0.5f * s + 1), 10 * sinf(0.3f * s),
+               10 * sinf(0.9f * s + 2), 10 * sinf(0.8f * s), 15 * sinf(0.4f * s + 3)}};
+    poses.push_back(p);
+  }
+  return poses;
+}
+
+/**
+ * Random jumps across the envelope, held for a second. The servos spend
+ * most of the time slewing, far from any pose the IK was asked for.
+ */
+static std::vector<Waypoint> stepTrajectory(int ticks)
+{
+  std::vector<Waypoint> poses;
+  Waypoint p = {{0, 0, 0, 0, 0, 0}};
+  for (int t = 0; t < ticks; t++)
+  {
+    if (t % 50 == 0)
+    {
+      Waypoint next = {{randomIn(-25, 25), randomIn(-25, 25), randomIn(-15, 15),
+                    randomIn(-12, 12), randomIn(-12, 12), randomIn(-20, 20)}};
+      p = next;
+    }
+    poses.push_back(p);
+  }
+  return poses;
+}
+
+/**
+ * One tick of updateServos() in main.cpp (SERVO_ACCELERATION_ENABLED): the
+ * servos follow their profiles towards the setpoints.
+ * Returns true if every servo is on its target.
+ */
+static bool slew(const float *target, std::vector<ServoProfile> &profiles, uint32_t nowUs, float *position)
+{
+  bool settled = true;
+  for (int i = 0; i < 6; i++)
+  {
+    profiles[i].setTarget(target[i], nowUs);
+    position[i] = profiles[i].update(nowUs);
+    settled = settled && profiles[i].isSettled();
+  }
+  return settled;
+}
+
+static void report(const char *name, const std::vector<Waypoint> &poses, float usPerSolve)
+{
+  IkKernel<ik_scalar_t> kernel(SERVO_MIN, SERVO_MAX);
+  ForwardKinematics fk(FK_MAX_ITERATIONS, FK_TOLERANCE, FK_STEP);
+  int failedLeg;
+  float value;
+
+  float target[6], position[6], estimate[6];
+  kernel.solve(position, 0, 0, 0, 0, 0, 0, failedLeg, value);
+  memcpy(target, position, sizeof(target));
+  std::vector<ServoProfile> profiles(6, ServoProfile(SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG));
+  for (int i = 0; i < 6; i++)
+  {
+    profiles[i].reset(position[i], 0);
+  }
+
+  unsigned long maxSolves = 0, settledTicks = 0, clampedTicks = 0;
+  int maxIterations = 0;
+  double maxResidual = 0, maxPoseError = 0, sumPoseError = 0;
+  double fkNs = 0;
+
+  for (size_t t = 0; t < poses.size(); t++)
+  {
+    const float *p = poses[t].v;
+    float next[6];
+    const bool reachable = kernel.solve(next, p[0], p[1], p[2], p[3], p[4], p[5], failedLeg, value) == IK_OK;
+    if (reachable)
+    {
+      memcpy(target, next, sizeof(target));
+    }
+    const bool settled = slew(target, profiles, (uint32_t)(t * TICK_S * 1e6f), position);
+
+    const unsigned long solvesBefore = fk.getStats().solves;
+    auto start = std::chrono::steady_clock::now();
+    fk.estimate(kernel, position, estimate);
+    auto end = std::chrono::steady_clock::now();
+    fkNs += std::chrono::duration<double, std::nano>(end - start).count();
+
+    const FkStats &stats = fk.getStats();
+    const unsigned long solves = stats.solves - solvesBefore;
+    maxSolves = solves > maxSolves ? solves : maxSolves;
+    maxIterations = stats.lastIterations > maxIterations ? stats.lastIterations : maxIterations;
+    maxResidual = stats.lastResidual > maxResidual ? stats.lastResidual : maxResidual;
+
+    bool clamped = false;
+    for (int k = 0; k < 6; k++)
+    {
+      clamped = clamped || target[k] <= SERVO_MIN || target[k] >= SERVO_MAX;
+    }
+
+    // The true pose is only known once the servos have reached the IK solution, and
+    // only unique if no servo was clamped to its limit
+    if (settled && reachable && clamped)
+    {
+      clampedTicks++;
+    }
+    else if (settled && reachable)
+    {
+      settledTicks++;
+      for (int k = 0; k < 6; k++)
+      {
+        const double e = fabs(estimate[k] - p[k]);
+        maxPoseError = e > maxPoseError ? e : maxPoseError;
+        sumPoseError += e;
+      }
+    }
+  }
+
+  const FkStats &stats = fk.getStats();
+
+  // The IK costs 1 solve per tick, or 13 with IK_JACOBIAN_ENABLED when the Jacobian is
+  // refreshed. The FK costs at most 2 + 16 * FK_MAX_ITERATIONS (see ForwardKinematics.h).
+  const unsigned long worstSolves = 13 + maxSolves;
+  const unsigned long boundSolves = 13 + 2 + 16 * FK_MAX_ITERATIONS;
+
+  printf("%-9s %7.1f%% %6.2f %5d %6.2f %5lu %9.4f %7lu %7lu %9.4f %9.5f %8.1f %6lu %6lu", name,
+         100.0 * stats.converged / stats.estimates, (double)stats.iterations / stats.estimates, maxIterations,
+         (double)stats.solves / stats.estimates, maxSolves, maxResidual, settledTicks, clampedTicks,
+         maxPoseError, settledTicks ? sumPoseError / (settledTicks * 6) : 0.0,
+         fkNs / stats.estimates / 1000, worstSolves, boundSolves);
+  if (usPerSolve > 0)
+  {
+    printf(" %8.0f %8.0f %s", worstSolves * usPerSolve, boundSolves * usPerSolve,
+           boundSolves * usPerSolve <= BUDGET_US ? "ok" : "OVER");
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+  const int seconds = argc > 1 ? atoi(argv[1]) : 600;
+  const float usPerSolve = argc > 2 ? (float)atof(argv[2]) : 0.0f;
+  const int ticks = (int)(seconds / TICK_S);
+  srand(1);
+
+  printf("%d ticks (%d s) per trajectory, %d iterations, tolerance %.3f deg", ticks, seconds, FK_MAX_ITERATIONS, FK_TOLERANCE);
+  if (usPerSolve > 0)
+  {
+    printf(", %.0f us per solve on the device", usPerSolve);
+  }
+  printf("\n%-9s %8s %6s %5s %6s %5s %9s %7s %7s %9s %9s %8s %6s %6s", "", "conv.", "iter", "max", "solves", "max",
+         "max resid", "settled", "clamped", "max pose", "mean pose", "host us", "worst", "bound");
+  printf(usPerSolve > 0 ? " %8s %8s\n" : "\n", "worst us", "bound us");
+
+  report("balance", balanceTrajectory(ticks), usPerSolve);
+  report("joystick", joystickTrajectory(ticks), usPerSolve);
+  report("step", stepTrajectory(ticks), usPerSolve);
+  return 0;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file IkBatchBenchmark.cpp
+ * @brief Throughput benchmark of the batch IK
+ *
+ * This tool solves the same random poses one at a time with
+ * IkKernel::solve() and in one pass with IkKernel::solveBatch(), in double,
+ * float and Q16.16 fixed point. It reports the throughput of each in poses
+ * per second, and checks that both give the same angles and feasibility.
+ * The two are expected to run at the same rate, within noise: the batch
+ * only changes the layout of the result.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -D USE_FAST_MATH -I include tools/IkBatchBenchmark/IkBatchBenchmark.cpp -o ik_batch_benchmark
+ *   ./ik_batch_benchmark [poses]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "core/IkKernel.h"
+
+using namespace stewy::core;
+
+// Firmware settings (see Config.h)
+const int SERVO_MIN = 0;
+const int SERVO_MAX = 360;
+
+static float randomIn(float lo, float hi)
+{
+  return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+static int failures = 0;
+
+template <typename T>
+static void benchmark(const char *name, const std::vector<Pose> &poses)
+{
+  IkKernel<T> kernel(SERVO_MIN, SERVO_MAX);
+  const size_t n = poses.size();
+  int failedLeg;
+  float value;
+
+  // One pose at a time, into float[6] frames
+  std::vector<float> single(n * 6);
+  std::vector<int> singleOk(n);
+  auto start = std::chrono::steady_clock::now();
+  for (size_t k = 0; k < n; k++)
+  {
+    const Pose &p = poses[k];
+    singleOk[k] = kernel.solve(&single[k * 6], p.sway, p.surge, p.heave, p.pitch, p.roll, p.yaw, failedLeg, value) == IK_OK;
+  }
+  auto mid = std::chrono::steady_clock::now();
+
+  // One pass, into servo arrays
+  std::vector<float> storage(n * 6);
+  std::vector<uint32_t> bits(FeasibilityMask::wordsFor(n));
+  ServoFrameSoA out(storage.data(), n);
+  FeasibilityMask mask(bits.data(), n);
+  const size_t feasible = kernel.solveBatch(poses.data(), n, out, mask);
+  auto end = std::chrono::steady_clock::now();
+
+  size_t mismatches = 0;
+  double maxDiff = 0;
+  for (size_t k = 0; k < n; k++)
+  {
+    if (mask.test(k) != (singleOk[k] != 0))
+    {
+      mismatches++;
+      continue;
+    }
+    if (!singleOk[k])
+    {
+      continue;
+    }
+    float frame[6];
+    out.getFrame(k, frame);
+    for (int i = 0; i < 6; i++)
+    {
+      maxDiff = fmax(maxDiff, fabs(frame[i] - single[k * 6 + i]));
+    }
+  }
+
+  const double singleS = std::chrono::duration<double>(mid - start).count();
+  const double batchS = std::chrono::duration<double>(end - mid).count();
+  const bool ok = mismatches == 0 && maxDiff == 0;
+  printf("%-7s %12.0f %12.0f %7.2fx %9zu %10zu %10.2g %s\n", name, n / singleS, n / batchS, singleS / batchS,
+         feasible, mismatches, maxDiff, ok ? "ok" : "FAILED");
+  if (!ok)
+  {
+    failures++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const size_t count = argc > 1 ? (size_t)atol(argv[1]) : 1000000;
+
+  // Poses within the envelope of PlatformGeometry.h, about a sixth of them feasible
+  std::vector<Pose> poses(count);
+  srand(1);
+  for (size_t k = 0; k < count; k++)
+  {
+    poses[k].sway = randomIn(SWAY_MIN, SWAY_MAX);
+    poses[k].surge = randomIn(SURGE_MIN, SURGE_MAX);
+    poses[k].heave = randomIn(HEAVE_MIN, HEAVE_MAX);
+    poses[k].pitch = randomIn(PITCH_MIN, PITCH_MAX);
+    poses[k].roll = randomIn(ROLL_MIN, ROLL_MAX);
+    poses[k].yaw = randomIn(YAW_MIN, YAW_MAX);
+  }
+
+  printf("%zu random poses\n", count);
+  printf("%-7s %12s %12s %8s %9s %10s %10s\n", "", "solve/s", "batch/s", "ratio", "feasible", "mismatches", "max diff");
+  benchmark<double>("double", poses);
+  benchmark<float>("float", poses);
+  benchmark<Fixed16>("Q16.16", poses);
+
+  // A long trajectory is mostly feasible, as a precomputed motion would be
+  for (size_t k = 0; k < count; k++)
+  {
+    const float s = k * 0.02f;
+    poses[k].sway = 20 * sinf(0.7f * s);
+    poses[k].surge = 20 * sinf(0.5f * s + 1);
+    poses[k].heave = 10 * sinf(0.3f * s);
+    poses[k].pitch = 10 * sinf(0.9f * s + 2);
+    poses[k].roll = 10 * sinf(0.8f * s);
+    poses[k].yaw = 15 * sinf(0.4f * s + 3);
+  }
+
+  printf("\n%zu trajectory poses\n", count);
+  printf("%-7s %12s %12s %8s %9s %10s %10s\n", "", "solve/s", "batch/s", "ratio", "feasible", "mismatches", "max diff");
+  benchmark<double>("double", poses);
+  benchmark<float>("float", poses);
+  benchmark<Fixed16>("Q16.16", poses);
+
+  return failures ? 1 : 0;
+}
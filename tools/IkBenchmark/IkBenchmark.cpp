@@ -0,0 +1,149 @@
+/**
+ * @file IkBenchmark.cpp
+ * @brief Host benchmark for the IK kernel scalar types
+ *
+ * This tool solves the same set of random poses with the double, float and
+ * Q16.16 fixed-point IK kernels. It reports the per-solve cost of each
+ * variant, and the worst-case servo angle difference against double. The
+ * exit status is non-zero if the difference exceeds the accuracy
+ * documented in IkKernel.h. Build without -D USE_FAST_MATH to check the
+ * float kernel on libm.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -D USE_FAST_MATH -I include tools/IkBenchmark/IkBenchmark.cpp -o ik_benchmark
+ *   ./ik_benchmark [poses]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "core/IkKernel.h"
+
+using namespace stewy::core;
+
+// Servo range used by the firmware (see Config.h)
+const int SERVO_MIN = 0;
+const int SERVO_MAX = 360;
+
+// Accuracy against double documented in IkKernel.h, in degrees of servo angle
+#ifdef USE_FAST_MATH
+const double FLOAT_TOLERANCE = 0.01;
+#else
+const double FLOAT_TOLERANCE = 0.002;
+#endif
+const double FIXED_TOLERANCE = 0.15;
+
+static float randomIn(float lo, float hi)
+{
+  return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+template <typename T>
+static double benchmark(const char *name, const std::vector<Pose> &poses, std::vector<float> &angles, std::vector<int> &ok)
+{
+  IkKernel<T> kernel(SERVO_MIN, SERVO_MAX);
+  int failedLeg;
+  float value;
+
+  angles.assign(poses.size() * 6, 0);
+  ok.assign(poses.size(), 0);
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < poses.size(); i++)
+  {
+    const Pose &p = poses[i];
+    ok[i] = kernel.solve(&angles[i * 6], p.sway, p.surge, p.heave, p.pitch, p.roll, p.yaw, failedLeg, value) == IK_OK;
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double ns = std::chrono::duration<double, std::nano>(end - start).count() / poses.size();
+  printf("%-8s %10.1f ns/solve\n", name, ns);
+  return ns;
+}
+
+static bool compare(const char *name, const std::vector<float> &ref, const std::vector<int> &refOk,
+                    const std::vector<float> &angles, const std::vector<int> &ok, double tolerance)
+{
+  double maxErr = 0;
+  size_t mismatches = 0;
+
+  for (size_t i = 0; i < refOk.size(); i++)
+  {
+    if (refOk[i] != ok[i])
+    {
+      mismatches++;
+      continue;
+    }
+    if (!refOk[i])
+    {
+      continue;
+    }
+    for (int j = 0; j < 6; j++)
+    {
+      double err = fabs(ref[i * 6 + j] - angles[i * 6 + j]);
+      if (err > maxErr)
+      {
+        maxErr = err;
+      }
+    }
+  }
+
+  const bool pass = maxErr <= tolerance;
+  printf("%-8s max servo angle error vs double: %.4f deg (tolerance %.3f) %s, feasibility mismatches: %zu\n",
+         name, maxErr, tolerance, pass ? "ok" : "FAILED", mismatches);
+  return pass;
+}
+
+int main(int argc, char **argv)
+{
+  size_t count = (argc > 1) ? (size_t)atol(argv[1]) : 200000;
+
+  srand(1);
+  std::vector<Pose> poses(count);
+  for (size_t i = 0; i < count; i++)
+  {
+    poses[i].sway = randomIn(SWAY_MIN, SWAY_MAX);
+    poses[i].surge = randomIn(SURGE_MIN, SURGE_MAX);
+    poses[i].heave = randomIn(HEAVE_MIN, HEAVE_MAX);
+    poses[i].pitch = randomIn(PITCH_MIN, PITCH_MAX);
+    poses[i].roll = randomIn(ROLL_MIN, ROLL_MAX);
+    poses[i].yaw = randomIn(YAW_MIN, YAW_MAX);
+  }
+
+  printf("Solving %zu random poses\n", count);
+
+  std::vector<float> refAngles, floatAngles, fixedAngles;
+  std::vector<int> refOk, floatOk, fixedOk;
+
+  benchmark<double>("double", poses, refAngles, refOk);
+  benchmark<float>("float", poses, floatAngles, floatOk);
+  benchmark<Fixed16>("Q16.16", poses, fixedAngles, fixedOk);
+
+  bool pass = compare("float", refAngles, refOk, floatAngles, floatOk, FLOAT_TOLERANCE);
+  pass = compare("Q16.16", refAngles, refOk, fixedAngles, fixedOk, FIXED_TOLERANCE) && pass;
+
+  if (!pass)
+  {
+    printf("\nServo angle error exceeds the accuracy documented in IkKernel.h\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,242 @@
+/**
+ * @file IkSimdBenchmark.cpp
+ * @brief Tolerance check and benchmark of the vectorized batch IK kernel
+ *
+ * This tool solves the same poses with the scalar float batch IK
+ * (IkKernel<float>::solveBatch) and with IkKernelSimd on every backend
+ * compiled in (SSE2, and AVX2 when built with -mavx2), one pose per lane.
+ * It checks that:
+ * - the servo angles agree within ANGLE_TOLERANCE degrees, and
+ * - feasibility only differs for poses within FEASIBILITY_MARGIN of the
+ *   workspace boundary, where the exact square roots of the vector kernel
+ *   can tip a leg either way,
+ * and reports the throughput of each in poses per second, on random poses,
+ * a simulated trajectory, and a lattice sweep as tools/WorkspaceMapGenerator
+ * runs. The exit status is non-zero if a check fails.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -mavx2 -D USE_FAST_MATH -I include tools/IkSimdBenchmark/IkSimdBenchmark.cpp -o ik_simd_benchmark
+ *   ./ik_simd_benchmark [poses]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "core/IkKernelSimd.h"
+
+using namespace stewy::core;
+
+#ifndef USE_FAST_MATH
+#error "IkKernelSimd evaluates the FastMath approximations: build with -D USE_FAST_MATH to compare against them"
+#endif
+
+// Firmware settings (see Config.h)
+const int SERVO_MIN = 0;
+const int SERVO_MAX = 360;
+
+// Largest servo angle difference against the scalar kernel, in degrees (after AGGRO)
+const double ANGLE_TOLERANCE = 1e-3;
+
+// Feasibility may differ within this distance of the boundary, in mm or degrees along any pose component
+const float FEASIBILITY_MARGIN = 1e-3f;
+
+static float randomIn(float lo, float hi)
+{
+  return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+static int failures = 0;
+
+/**
+ * Results of a batch solve.
+ */
+struct Result
+{
+  std::vector<float> storage;
+  std::vector<uint32_t> bits;
+  ServoFrameSoA out;
+  FeasibilityMask mask;
+  double posesPerSecond;
+
+  Result(size_t n)
+      : storage(n * 6), bits(FeasibilityMask::wordsFor(n)), out(storage.data(), n), mask(bits.data(), n),
+        posesPerSecond(0)
+  {
+  }
+};
+
+static bool solvable(const IkKernel<float> &kernel, const Pose &p)
+{
+  float servoValues[6];
+  int failedLeg;
+  float value;
+  return kernel.solveRaw(servoValues, p.sway, p.surge, p.heave, p.pitch, p.roll, p.yaw, failedLeg, value) == IK_OK;
+}
+
+/**
+ * Whether a pose is near the workspace boundary: moving any component by the margin changes its feasibility.
+ */
+static bool nearBoundary(const IkKernel<float> &kernel, const Pose &p)
+{
+  const bool ok = solvable(kernel, p);
+  for (int i = 0; i < 6; i++)
+  {
+    for (int s = -1; s <= 1; s += 2)
+    {
+      Pose q = p;
+      (&q.sway)[i] += s * FEASIBILITY_MARGIN * fmaxf(1.0f, fabsf((&p.sway)[i]));
+      if (solvable(kernel, q) != ok)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+template <typename B>
+static void run(const char *name, const std::vector<Pose> &poses, const Result &ref)
+{
+  const IkKernel<float> scalar(SERVO_MIN, SERVO_MAX);
+  const IkKernelSimd<B> kernel(SERVO_MIN, SERVO_MAX);
+  const size_t n = poses.size();
+  Result result(n);
+
+  auto start = std::chrono::steady_clock::now();
+  kernel.solveBatch(poses.data(), n, result.out, result.mask);
+  auto end = std::chrono::steady_clock::now();
+  const double rate = n / std::chrono::duration<double>(end - start).count();
+
+  size_t mismatches = 0, unexplained = 0;
+  double maxDiff = 0;
+  for (size_t k = 0; k < n; k++)
+  {
+    const bool ok = result.mask.test(k);
+    if (ok != ref.mask.test(k))
+    {
+      mismatches++;
+      unexplained += !nearBoundary(scalar, poses[k]);
+      continue;
+    }
+    if (!ok)
+    {
+      continue;
+    }
+    for (int i = 0; i < 6; i++)
+    {
+      maxDiff = fmax(maxDiff, fabs(result.out.servo[i][k] - ref.out.servo[i][k]));
+    }
+  }
+
+  const bool pass = maxDiff <= ANGLE_TOLERANCE && unexplained == 0;
+  printf("  %-16s %12.0f %7.2fx %10.2g %11zu %s\n", name, rate, rate / ref.posesPerSecond, maxDiff, mismatches,
+         pass ? "ok" : "FAILED");
+  if (!pass)
+  {
+    failures++;
+  }
+}
+
+static void runAll(const char *title, const std::vector<Pose> &poses)
+{
+  const IkKernel<float> kernel(SERVO_MIN, SERVO_MAX);
+  const size_t n = poses.size();
+  Result ref(n);
+
+  auto start = std::chrono::steady_clock::now();
+  const size_t feasible = kernel.solveBatch(poses.data(), n, ref.out, ref.mask);
+  auto end = std::chrono::steady_clock::now();
+  ref.posesPerSecond = n / std::chrono::duration<double>(end - start).count();
+
+  printf("%s (%zu poses, %.0f%% feasible)\n", title, n, 100.0 * feasible / n);
+  printf("  %-16s %12s %8s %10s %11s\n", "", "poses/s", "speedup", "max diff", "feasibility");
+  printf("  %-16s %12.0f %7.2fx\n", "IkKernel<float>", ref.posesPerSecond, 1.0);
+#ifdef SIMD_HAS_SSE2
+  run<SimdSse2>("SSE2", poses, ref);
+#endif
+#ifdef SIMD_HAS_AVX2
+  run<SimdAvx2>("AVX2", poses, ref);
+#endif
+}
+
+int main(int argc, char **argv)
+{
+#ifndef SIMD_HAS_SSE2
+  printf("Neither SSE2 nor AVX2 in this build: nothing to check\n");
+  return 0;
+#endif
+  const size_t count = argc > 1 ? (size_t)atol(argv[1]) : 1000000;
+  std::vector<Pose> poses(count);
+
+  const float envelopeMin[6] = {SWAY_MIN, SURGE_MIN, HEAVE_MIN, PITCH_MIN, ROLL_MIN, YAW_MIN};
+  const float envelopeMax[6] = {SWAY_MAX, SURGE_MAX, HEAVE_MAX, PITCH_MAX, ROLL_MAX, YAW_MAX};
+
+  // Random poses within the envelope of PlatformGeometry.h
+  srand(1);
+  for (size_t k = 0; k < count; k++)
+  {
+    for (int i = 0; i < 6; i++)
+    {
+      (&poses[k].sway)[i] = randomIn(envelopeMin[i], envelopeMax[i]);
+    }
+  }
+  runAll("Random poses", poses);
+
+  // A simulated trajectory, mostly feasible
+  for (size_t k = 0; k < count; k++)
+  {
+    const float s = k * 0.02f;
+    poses[k].sway = 20 * sinf(0.7f * s);
+    poses[k].surge = 20 * sinf(0.5f * s + 1);
+    poses[k].heave = 10 * sinf(0.3f * s);
+    poses[k].pitch = 10 * sinf(0.9f * s + 2);
+    poses[k].roll = 10 * sinf(0.8f * s);
+    poses[k].yaw = 15 * sinf(0.4f * s + 3);
+  }
+  runAll("Trajectory", poses);
+
+  // A regular lattice over the envelope, in the order WorkspaceMapGenerator sweeps it
+  int points = 2;
+  while (pow(points + 1, 6) <= count)
+  {
+    points++;
+  }
+  poses.resize((size_t)pow(points, 6));
+  for (size_t k = 0; k < poses.size(); k++)
+  {
+    size_t rest = k;
+    for (int i = 5; i >= 0; i--)
+    {
+      (&poses[k].sway)[i] = envelopeMin[i] + (envelopeMax[i] - envelopeMin[i]) * (rest % points) / (points - 1);
+      rest /= points;
+    }
+  }
+  runAll("Lattice sweep", poses);
+
+  if (failures > 0)
+  {
+    printf("\n%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("\nAll checks passed (angles within %g deg)\n", ANGLE_TOLERANCE);
+  return 0;
+}
@@ -0,0 +1,240 @@
+/**
+ * @file IncrementalIkBenchmark.cpp
+ * @brief Host benchmark and accuracy report for the incremental IK
+ *
+ * This tool runs IncrementalIk and the exact IK kernel along control loop
+ * trajectories, one pose per CONTROL_INTERVAL_US tick, for a few threshold
+ * settings. It reports how often the linear update and the Jacobian
+ * estimate were used, the cost per pose, and the servo angle error against
+ * the exact solve. The exit status is non-zero if the error exceeds the
+ * maxError of a setting (scaled by AGGRO, as it bounds unshaped angles).
+ *
+ * The trajectories are synthesized, not recorded:
+ * - balance: a ball rolling on the plate, held at a setpoint that jumps
+ *   every few seconds by a PD controller on a noisy, filtered position,
+ *   with its output mapped to pitch/roll as in TouchScreenDriver::process
+ * - joystick: a slow six-axis sweep, as in the Nunchuck CONTROL mode
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -D USE_FAST_MATH -I include tools/IncrementalIkBenchmark/IncrementalIkBenchmark.cpp src/core/IncrementalIk.cpp -o incremental_ik_benchmark
+ *   ./incremental_ik_benchmark [seconds]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "core/IncrementalIk.h"
+
+using namespace stewy::core;
+
+// Firmware settings (see Config.h)
+const int SERVO_MIN = 0;
+const int SERVO_MAX = 360;
+const float TICK_S = 0.010f; // CONTROL_INTERVAL_US
+const float MIN_PITCH = -20, MAX_PITCH = 23;
+const float MIN_ROLL = -23, MAX_ROLL = 20;
+
+struct Waypoint
+{
+  float v[6]; // sway, surge, heave, pitch, roll, yaw
+};
+
+static float randomIn(float lo, float hi)
+{
+  return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+static float clampf(float v, float lo, float hi)
+{
+  return v < lo ? lo : (v > hi ? hi : v);
+}
+
+/**
+ * Ball on a tilting plate under PD control, one axis per tilt direction.
+ */
+static std::vector<Waypoint> balanceTrajectory(int ticks)
+{
+  const float ACCEL_PER_DEG = 9810.0f * 5 / 7 * (float)M_PI / 180; // Rolling ball, mm/s^2 per degree of tilt (small angles)
+  const float KP = 0.13f, KD = 0.046f;                             // deg/mm, deg/(mm/s)
+  const float NOISE_MM = 1.0f;                                     // Touchscreen noise
+  const int FILTER = 5;                                            // TOUCH_FILTER_SAMPLES
+
+  std::vector<Waypoint> poses;
+  float pos[2] = {0, 0}, vel[2] = {0, 0}, setpoint[2] = {0, 0};
+  float history[2][FILTER] = {{0}};
+  float lastFiltered[2] = {0, 0};
+
+  for (int t = 0; t < ticks; t++)
+  {
+    if (t % 150 == 0)
+    {
+      setpoint[0] = randomIn(-60, 60);
+      setpoint[1] = randomIn(-60, 60);
+    }
+
+    float tilt[2];
+    for (int a = 0; a < 2; a++)
+    {
+      history[a][t % FILTER] = pos[a] + randomIn(-NOISE_MM, NOISE_MM);
+      float filtered = 0;
+      for (int k = 0; k < FILTER; k++)
+      {
+        filtered += history[a][k] / FILTER;
+      }
+      const float rate = (filtered - lastFiltered[a]) / TICK_S;
+      lastFiltered[a] = filtered;
+      tilt[a] = -(KP * (filtered - setpoint[a]) + KD * rate);
+    }
+
+    Waypoint p = {{0, 0, 0, clampf(tilt[1], MIN_PITCH, MAX_PITCH), clampf(tilt[0], MIN_ROLL, MAX_ROLL), 0}};
+    poses.push_back(p);
+
+    for (int a = 0; a < 2; a++)
+    {
+      vel[a] += ACCEL_PER_DEG * p.v[a == 0 ? 4 : 3] * TICK_S;
+      pos[a] = clampf(pos[a] + vel[a] * TICK_S, -100, 100);
+    }
+  }
+  return poses;
+}
+
+/**
+ * Slow six-axis sweep within the platform envelope.
+ */
+static std::vector<Waypoint> joystickTrajectory(int ticks)
+{
+  std::vector<Waypoint> poses;
+  for (int t = 0; t < ticks; t++)
+  {
+    const float s = t * TICK_S;
+    Waypoint p = {{20 * sinf(0.7f * s), 20 * sinf(0.5f * s + 1), 10 * sinf(0.3f * s),
+               10 * sinf(0.9f * s + 2), 10 * sinf(0.8f * s), 15 * sinf(0.4f * s + 3)}};
+    poses.push_back(p);
+  }
+  return poses;
+}
+
+// Kernel solves that one IkKernel::check() costs, about the same on the host in float and in Q16.16
+const double CHECK_COST = 0.5;
+
+// Margin on maxError: the check estimates the error to first order
+const double ERROR_MARGIN = 1.05;
+
+static int failures = 0;
+
+static void report(const char *name, const std::vector<Waypoint> &poses, float maxDelta, float maxDrift, float maxError, float step)
+{
+  IkKernel<ik_scalar_t> kernel(SERVO_MIN, SERVO_MAX);
+  int failedLeg;
+  float value;
+  std::vector<float> exact(poses.size() * 6), approx(poses.size() * 6);
+  std::vector<int> exactOk(poses.size()), approxOk(poses.size());
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < poses.size(); i++)
+  {
+    const float *p = poses[i].v;
+    exactOk[i] = kernel.solve(&exact[i * 6], p[0], p[1], p[2], p[3], p[4], p[5], failedLeg, value) == IK_OK;
+  }
+  auto mid = std::chrono::steady_clock::now();
+  IncrementalIk incremental(maxDelta, maxDrift, maxError, step);
+  for (size_t i = 0; i < poses.size(); i++)
+  {
+    approxOk[i] = incremental.solve(kernel, &approx[i * 6], poses[i].v, failedLeg, value) == IK_OK;
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double maxErr = 0, sumErr = 0;
+  size_t compared = 0, mismatches = 0;
+  for (size_t i = 0; i < poses.size(); i++)
+  {
+    if (exactOk[i] != approxOk[i])
+    {
+      mismatches++;
+      continue;
+    }
+    if (!exactOk[i])
+    {
+      continue;
+    }
+    for (int k = 0; k < 6; k++)
+    {
+      const double e = fabs(exact[i * 6 + k] - approx[i * 6 + k]);
+      maxErr = e > maxErr ? e : maxErr;
+      sumErr += e;
+    }
+    compared++;
+  }
+
+  const double exactNs = std::chrono::duration<double, std::nano>(mid - start).count() / poses.size();
+  const double approxNs = std::chrono::duration<double, std::nano>(end - mid).count() / poses.size();
+  const unsigned long total = incremental.getLinearSolves() + incremental.getFullSolves();
+  const unsigned long checks = incremental.getLinearSolves() + incremental.getRejected();
+
+  // Kernel solves per pose, counting 12 per Jacobian estimate and CHECK_COST per check. On the Teensy,
+  // where a soft-float solve costs far more than the 6x6 multiply, this is roughly the cost relative to
+  // the exact solve.
+  const double solves = (incremental.getFullSolves() + 12.0 * incremental.getRefreshes() + CHECK_COST * checks) / total;
+
+  const bool ok = maxErr <= maxError * AGGRO * ERROR_MARGIN && mismatches == 0;
+  printf("%-9s %5.2f %5.2f %5.2f %5.2f %7.1f%% %7.1f%% %7.1f%% %7.2f %9.1f %9.1f %9.4f %9.5f %6zu %s\n",
+         name, maxDelta, maxDrift, maxError, step,
+         100.0 * incremental.getLinearSolves() / total, 100.0 * incremental.getRejected() / total,
+         100.0 * incremental.getRefreshes() / total, solves,
+         approxNs, exactNs, maxErr, compared ? sumErr / (compared * 6) : 0.0, mismatches, ok ? "ok" : "FAILED");
+  if (!ok)
+  {
+    failures++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const int seconds = argc > 1 ? atoi(argv[1]) : 600;
+  const int ticks = (int)(seconds / TICK_S);
+  srand(1);
+
+  std::vector<Waypoint> balance = balanceTrajectory(ticks);
+  std::vector<Waypoint> joystick = joystickTrajectory(ticks);
+
+  printf("%d ticks (%d s) per trajectory\n", ticks, seconds);
+  printf("%-9s %5s %5s %5s %5s %8s %8s %8s %7s %9s %9s %9s %9s %6s\n", "", "delta", "drift", "error", "step",
+         "linear", "rejected", "refresh", "solves", "ns/pose", "exact ns", "max deg", "mean deg", "mism.");
+
+  // maxDelta, maxDrift, maxError, step
+  const float settings[][4] = {
+      {0.25f, 0.5f, 0.05f, 0.5f},
+      {0.5f, 1.0f, 0.05f, 0.5f},
+      {1.0f, 2.0f, 0.1f, 1.0f},
+      {2.0f, 4.0f, 0.2f, 1.0f}};
+  const size_t count = sizeof(settings) / sizeof(settings[0]);
+
+  for (size_t s = 0; s < count; s++)
+  {
+    report("balance", balance, settings[s][0], settings[s][1], settings[s][2], settings[s][3]);
+  }
+  for (size_t s = 0; s < count; s++)
+  {
+    report("joystick", joystick, settings[s][0], settings[s][1], settings[s][2], settings[s][3]);
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,331 @@
+/**
+ * @file PoseInterpolationBenchmark.cpp
+ * @brief Host comparison of joint-space ramps and pose-space interpolation
+ *
+ * This tool moves the platform between random pairs of reachable poses,
+ * one tick per CONTROL_INTERVAL_US, in two ways:
+ * - joint ramp: the servos are moved from the start angles to the target
+ *   angles by the ServoProfile of updateServos()
+ *   (SERVO_ACCELERATION_ENABLED), each on its own;
+ * - pose interpolation: a PoseInterpolator moves the pose, and the IK is
+ *   solved for the interpolated pose every tick
+ *   (POSE_INTERPOLATION_ENABLED).
+ *
+ * For each, it reports how long moves take, how far apart the legs arrive,
+ * how far the platform strays from the straight path (the segment in
+ * translation, the slerp arc in orientation; the pose is recovered from the
+ * servo angles with ForwardKinematics), and the peak speeds of that pose.
+ * It exits with a non-zero status if the interpolated moves do not keep the
+ * legs in step, leave the straight path, or exceed the speed limits.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -D USE_FAST_MATH -I include tools/PoseInterpolationBenchmark/PoseInterpolationBenchmark.cpp src/core/PoseInterpolator.cpp src/core/ForwardKinematics.cpp src/core/ServoProfile.cpp -o pose_interpolation_benchmark
+ *   ./pose_interpolation_benchmark [moves]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "core/ForwardKinematics.h"
+#include "core/PoseInterpolator.h"
+#include "core/ServoProfile.h"
+
+using namespace stewy::core;
+
+// Firmware settings (see Config.h)
+const int SERVO_MIN = 0;
+const int SERVO_MAX = 360;
+const float TICK_S = 0.010f;           // CONTROL_INTERVAL_US
+const float SERVO_MAX_SPEED_DEG = 500.0f;
+const float SERVO_MAX_ACCEL_DEG = 750.0f;
+const float SERVO_MAX_JERK_DEG = 15000.0f;
+const float POSE_MAX_SPEED_MM = 100.0f;
+const float POSE_MAX_ACCEL_MM = 500.0f;
+const float POSE_MAX_SPEED_DEG = 120.0f;
+const float POSE_MAX_ACCEL_DEG = 1200.0f;
+
+// Pass/fail thresholds for the interpolated moves
+const float STILL_DEG = 1e-3f; // A servo that moves less than this in a tick has stopped
+const int MAX_SPREAD = 1;          // Ticks; a servo that barely moves can stop a tick early
+const float MAX_DEVIATION = 0.05f; // mm, and degrees
+const int MAX_TICKS = 2000;
+const int PATH_SAMPLES = 2000; // Points of the slerp arc the orientation deviation is measured against
+const float RAD_TO_DEG = (float)(180.0 / GEOMETRY_PI);
+
+struct Stats
+{
+  int moves;
+  double ticks;
+  int maxSpread;
+  double spread;
+  float maxDeviationMm;
+  float maxDeviationDeg;
+  float maxSpeedMm;
+  float maxSpeedDeg;
+};
+
+static float randomIn(float lo, float hi)
+{
+  return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+/**
+ * Angle of the rotation between two orientations, in degrees. From the
+ * relative quaternion conj(a) * b rather than the acos of the dot product,
+ * which loses all precision near 1.
+ */
+static float quaternionAngle(const Quaternion &a, const Quaternion &b)
+{
+  const float w = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+  const float x = a.w * b.x - a.x * b.w - a.y * b.z + a.z * b.y;
+  const float y = a.w * b.y + a.x * b.z - a.y * b.w - a.z * b.x;
+  const float z = a.w * b.z - a.x * b.y + a.y * b.x - a.z * b.w;
+  return 2 * atan2f(sqrtf(x * x + y * y + z * z), fabsf(w)) * RAD_TO_DEG;
+}
+
+/**
+ * One tick of updateServos() in main.cpp (SERVO_ACCELERATION_ENABLED): the
+ * servos follow their profiles towards the setpoints.
+ * Returns true if every servo is on its target.
+ */
+static bool slew(const float *target, std::vector<ServoProfile> &profiles, uint32_t nowUs, float *position)
+{
+  bool settled = true;
+  for (int i = 0; i < 6; i++)
+  {
+    profiles[i].setTarget(target[i], nowUs);
+    position[i] = profiles[i].update(nowUs);
+    settled = settled && profiles[i].isSettled();
+  }
+  return settled;
+}
+
+/**
+ * Distance of a pose from the straight path between two poses: from the
+ * segment in translation, and from the slerp arc in orientation.
+ */
+static void deviation(const float *pose, const float *from, const float *to, const Quaternion *arc,
+                      float &mm, float &deg)
+{
+  float d[3], p[3], along = 0, lengthSq = 0;
+  for (int j = 0; j < 3; j++)
+  {
+    d[j] = to[j] - from[j];
+    p[j] = pose[j] - from[j];
+    along += p[j] * d[j];
+    lengthSq += d[j] * d[j];
+  }
+  const float t = lengthSq > 0 ? fminf(fmaxf(along / lengthSq, 0), 1) : 0;
+  mm = 0;
+  for (int j = 0; j < 3; j++)
+  {
+    mm += (p[j] - t * d[j]) * (p[j] - t * d[j]);
+  }
+  mm = sqrtf(mm);
+
+  Quaternion q;
+  orientation::fromEuler(pose[3], pose[4], pose[5], q);
+  deg = 180;
+  for (int k = 0; k <= PATH_SAMPLES; k++)
+  {
+    deg = fminf(deg, quaternionAngle(q, arc[k]));
+  }
+}
+
+/**
+ * Follow one move, given the servo angles of each tick, and update the stats.
+ */
+static void measure(const IkKernel<ik_scalar_t> &kernel, const std::vector<float> &angles, const float *from,
+                    const float *to, const Quaternion *arc, Stats &stats)
+{
+  ForwardKinematics fk(20, 1e-4f, 0.5f);
+  const int ticks = (int)(angles.size() / 6);
+
+  int first = ticks, last = 0;
+  for (int i = 0; i < 6; i++)
+  {
+    int arrival = 0;
+    for (int t = 1; t < ticks; t++)
+    {
+      if (fabsf(angles[t * 6 + i] - angles[(t - 1) * 6 + i]) > STILL_DEG)
+      {
+        arrival = t;
+      }
+    }
+    if (arrival > 0)
+    {
+      first = arrival < first ? arrival : first;
+      last = arrival > last ? arrival : last;
+    }
+  }
+  const int spread = last > first ? last - first : 0;
+
+  float pose[6], previous[6];
+  Quaternion q, previousQ;
+  fk.estimate(kernel, &angles[0], previous); // Warm start at the start pose
+  orientation::fromEuler(previous[3], previous[4], previous[5], previousQ);
+  for (int t = 0; t < ticks; t++)
+  {
+    float mm, deg;
+    fk.estimate(kernel, &angles[t * 6], pose);
+    deviation(pose, from, to, arc, mm, deg);
+    stats.maxDeviationMm = fmaxf(stats.maxDeviationMm, mm);
+    stats.maxDeviationDeg = fmaxf(stats.maxDeviationDeg, deg);
+
+    orientation::fromEuler(pose[3], pose[4], pose[5], q);
+    mm = sqrtf((pose[0] - previous[0]) * (pose[0] - previous[0]) + (pose[1] - previous[1]) * (pose[1] - previous[1]) +
+               (pose[2] - previous[2]) * (pose[2] - previous[2]));
+    stats.maxSpeedMm = fmaxf(stats.maxSpeedMm, mm / TICK_S);
+    stats.maxSpeedDeg = fmaxf(stats.maxSpeedDeg, quaternionAngle(q, previousQ) / TICK_S);
+    memcpy(previous, pose, sizeof(previous));
+    previousQ = q;
+  }
+
+  stats.moves++;
+  stats.ticks += last;
+  stats.spread += spread;
+  stats.maxSpread = spread > stats.maxSpread ? spread : stats.maxSpread;
+}
+
+static bool reachable(const IkKernel<ik_scalar_t> &kernel, const float *p, float *angles)
+{
+  int failedLeg;
+  float value;
+  if (kernel.solve(angles, p[0], p[1], p[2], p[3], p[4], p[5], failedLeg, value) != IK_OK)
+  {
+    return false;
+  }
+  // A clamped servo angle hides the pose from the forward kinematics
+  for (int i = 0; i < 6; i++)
+  {
+    if (angles[i] <= SERVO_MIN || angles[i] >= SERVO_MAX)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void print(const char *name, const Stats &s)
+{
+  printf("%-12s %6d %8.2f %7d %8.2f %9.3f %9.3f %9.1f %9.1f\n", name, s.moves, s.ticks * TICK_S / s.moves,
+         s.maxSpread, s.spread / s.moves, s.maxDeviationMm, s.maxDeviationDeg, s.maxSpeedMm, s.maxSpeedDeg);
+}
+
+int main(int argc, char **argv)
+{
+  const int moves = argc > 1 ? atoi(argv[1]) : 200;
+  IkKernel<ik_scalar_t> kernel(SERVO_MIN, SERVO_MAX);
+  Stats ramp = {}, interpolated = {};
+  int failed = 0;
+
+  srand(1);
+  for (int m = 0; m < moves;)
+  {
+    float from[6], to[6], startAngles[6], targetAngles[6];
+    for (int j = 0; j < 6; j++)
+    {
+      from[j] = j < 3 ? randomIn(-20, 20) : randomIn(-15, 15);
+      to[j] = j < 3 ? randomIn(-20, 20) : randomIn(-15, 15);
+    }
+    if (!reachable(kernel, from, startAngles) || !reachable(kernel, to, targetAngles))
+    {
+      continue;
+    }
+    m++;
+
+    Quaternion fromQ, toQ, arc[PATH_SAMPLES + 1];
+    orientation::fromEuler(from[3], from[4], from[5], fromQ);
+    orientation::fromEuler(to[3], to[4], to[5], toQ);
+    // The slerp arc of the move, against which the orientation deviation is measured
+    float dot = fromQ.w * toQ.w + fromQ.x * toQ.x + fromQ.y * toQ.y + fromQ.z * toQ.z;
+    Quaternion b = toQ;
+    if (dot < 0)
+    {
+      b.w = -b.w, b.x = -b.x, b.y = -b.y, b.z = -b.z, dot = -dot;
+    }
+    const float theta = acosf(fminf(dot, 1));
+    for (int k = 0; k <= PATH_SAMPLES; k++)
+    {
+      const float s = (float)k / PATH_SAMPLES;
+      const float wa = theta > 1e-4f ? sinf((1 - s) * theta) / sinf(theta) : 1 - s;
+      const float wb = theta > 1e-4f ? sinf(s * theta) / sinf(theta) : s;
+      arc[k].w = wa * fromQ.w + wb * b.w;
+      arc[k].x = wa * fromQ.x + wb * b.x;
+      arc[k].y = wa * fromQ.y + wb * b.y;
+      arc[k].z = wa * fromQ.z + wb * b.z;
+    }
+
+    // Joint ramp
+    std::vector<float> angles;
+    std::vector<ServoProfile> profiles(6, ServoProfile(SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG));
+    float position[6];
+    for (int i = 0; i < 6; i++)
+    {
+      profiles[i].reset(startAngles[i], 0);
+    }
+    angles.assign(startAngles, startAngles + 6);
+    for (int t = 1; t < MAX_TICKS && !slew(targetAngles, profiles, (uint32_t)(t * TICK_S * 1e6f), position); t++)
+    {
+      angles.insert(angles.end(), position, position + 6);
+    }
+    angles.insert(angles.end(), targetAngles, targetAngles + 6);
+    measure(kernel, angles, from, to, arc, ramp);
+
+    // Pose interpolation
+    PoseInterpolator interpolator(POSE_MAX_SPEED_MM, POSE_MAX_ACCEL_MM, POSE_MAX_SPEED_DEG, POSE_MAX_ACCEL_DEG);
+    interpolator.reset(from, fromQ);
+    interpolator.setTarget(to, toQ);
+    angles.assign(startAngles, startAngles + 6);
+    for (int t = 0; t < MAX_TICKS && !interpolator.isSettled(); t++)
+    {
+      float translation[3], solved[6];
+      Quaternion q;
+      RotationMatrix r;
+      int failedLeg;
+      float value;
+      interpolator.step(TICK_S, translation, q);
+      orientation::fromQuaternion(q, r);
+      if (kernel.solve(solved, translation[0], translation[1], translation[2], r, failedLeg, value) != IK_OK)
+      {
+        failed++;
+        break;
+      }
+      angles.insert(angles.end(), solved, solved + 6);
+    }
+    measure(kernel, angles, from, to, arc, interpolated);
+  }
+
+  printf("%d moves between random reachable poses, %.0f ms ticks\n", moves, TICK_S * 1000);
+  printf("%-12s %6s %8s %7s %8s %9s %9s %9s %9s\n", "", "moves", "mean s", "spread", "mean", "dev mm", "dev deg",
+         "mm/s", "deg/s");
+  print("joint ramp", ramp);
+  print("interpolated", interpolated);
+
+  const bool ok = failed == 0 && interpolated.maxSpread <= MAX_SPREAD &&
+                  interpolated.maxDeviationMm <= MAX_DEVIATION && interpolated.maxDeviationDeg <= MAX_DEVIATION &&
+                  interpolated.maxSpeedMm <= POSE_MAX_SPEED_MM * 1.01f &&
+                  interpolated.maxSpeedDeg <= POSE_MAX_SPEED_DEG * 1.01f;
+  printf("\n%s (spread: ticks between the first and last servo to stop; dev: largest distance from the straight path)\n",
+         ok ? "All checks passed" : "FAILED");
+  return ok ? 0 : 1;
+}
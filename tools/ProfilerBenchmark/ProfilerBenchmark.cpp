@@ -0,0 +1,230 @@
+/**
+ * @file ProfilerBenchmark.cpp
+ * @brief Host check of the per-stage profiler, and of its overhead
+ *
+ * This tool checks the bookkeeping of the Profiler against a reference: it
+ * records random durations spread over every power of two, with a
+ * counter that wraps around during a stage, and compares the count,
+ * minimum, mean, maximum and histogram of each stage with values computed
+ * from the same durations.
+ *
+ * It then times, with a std::chrono counter in nanoseconds, the stages
+ * that run on the host (IK solve, forward kinematics, servo pulse widths)
+ * and an empty stage, which is the cost of the profiler itself. The report
+ * has the layout of the stats command. Host timings do not carry over to
+ * the Teensy; the overhead there is two reads of ARM_DWT_CYCCNT and the
+ * bookkeeping of record().
+ *
+ * It exits with a non-zero status if a check fails.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -D USE_FAST_MATH -I include tools/ProfilerBenchmark/ProfilerBenchmark.cpp src/core/Profiler.cpp src/core/ForwardKinematics.cpp src/core/ServoOutput.cpp -o profiler_benchmark
+ *   ./profiler_benchmark [runs]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "core/ForwardKinematics.h"
+#include "core/Profiler.h"
+#include "core/ServoOutput.h"
+
+using namespace stewy::core;
+
+// Firmware settings (see Config.h)
+const int SERVO_MIN_ANGLE = 0;
+const int SERVO_MAX_ANGLE = 360;
+const int SERVO_MIN_US = 755;
+const int SERVO_MAX_US = 2250;
+const int SERVO_REVERSE[6] = {0, 1, 0, 1, 0, 1};
+const int SERVO_TRIM[6] = {0, 20, 0, 135, 0, 120};
+const int FK_MAX_ITERATIONS = 2;
+const float FK_TOLERANCE = 0.01f;
+const float FK_STEP = 0.5f;
+
+static uint32_t simulatedCounter; // Counter of the bookkeeping check
+
+static uint32_t simulatedClock()
+{
+  return simulatedCounter;
+}
+
+static uint32_t chronoClock()
+{
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+static uint32_t randomBits()
+{
+  return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+/**
+ * Record random durations through start() and stop(), and compare the
+ * timings of each stage with a reference computed from the same durations.
+ * Returns true if they match.
+ */
+static bool checkBookkeeping(int runs)
+{
+  Profiler profiler(simulatedClock, 72);
+  StageStats reference[STAGE_COUNT];
+  memset(reference, 0, sizeof(reference));
+  for (int s = 0; s < STAGE_COUNT; s++)
+  {
+    reference[s].minCycles = UINT32_MAX;
+  }
+
+  simulatedCounter = 0xffffffffu - 1000000; // Wraps around early on
+  for (int i = 0; i < runs * STAGE_COUNT; i++)
+  {
+    const ProfileStage stage = (ProfileStage)(i % STAGE_COUNT);
+
+    // A duration of any bit length, including 0 and the extremes
+    const int bits = i == 0 ? 32 : randomBits() % 33;
+    const uint32_t cycles = bits == 0 ? 0 : (randomBits() & (0xffffffffu >> (32 - bits))) | (1u << (bits - 1));
+
+    const uint32_t start = profiler.start();
+    simulatedCounter += cycles;
+    profiler.stop(stage, start);
+    simulatedCounter += randomBits() % 1000;
+
+    StageStats &r = reference[stage];
+    r.count++;
+    r.totalCycles += cycles;
+    r.minCycles = cycles < r.minCycles ? cycles : r.minCycles;
+    r.maxCycles = cycles > r.maxCycles ? cycles : r.maxCycles;
+    r.histogram[bits == 0 ? 0 : bits - 1]++;
+  }
+
+  bool ok = true;
+  for (int s = 0; s < STAGE_COUNT; s++)
+  {
+    const StageStats &stats = profiler.getStats((ProfileStage)s);
+    const StageStats &r = reference[s];
+    const bool same = stats.count == r.count && stats.minCycles == r.minCycles && stats.maxCycles == r.maxCycles &&
+                      stats.totalCycles == r.totalCycles &&
+                      memcmp(stats.histogram, r.histogram, sizeof(r.histogram)) == 0;
+    ok = ok && same;
+    if (!same)
+    {
+      printf("  %s: %u runs, %u-%u cycles, expected %u runs, %u-%u cycles\n",
+             Profiler::getStageString((ProfileStage)s), stats.count, stats.minCycles, stats.maxCycles,
+             reference[s].count, reference[s].minCycles, reference[s].maxCycles);
+    }
+  }
+
+  // A reset profiler reports no runs
+  profiler.reset();
+  for (int s = 0; s < STAGE_COUNT; s++)
+  {
+    const StageStats &stats = profiler.getStats((ProfileStage)s);
+    ok = ok && stats.count == 0 && stats.totalCycles == 0 && stats.maxCycles == 0 && stats.minCycles == UINT32_MAX;
+  }
+
+  printf("bookkeeping: %d runs per stage, counter wrapping: %s\n", runs, ok ? "ok" : "FAIL");
+  return ok;
+}
+
+/**
+ * Print the timings of the stages that ran, as the stats command does.
+ */
+static void report(const Profiler &profiler)
+{
+  printf("Stages (runs: min / mean / max us):\n");
+  for (int s = 0; s < STAGE_COUNT; s++)
+  {
+    const StageStats &stats = profiler.getStats((ProfileStage)s);
+    if (stats.count == 0)
+    {
+      continue;
+    }
+    printf("  %s: %u: %.2f / %.2f / %.2f\n", Profiler::getStageString((ProfileStage)s), stats.count,
+           profiler.toMicroseconds(stats.minCycles), profiler.toMicroseconds((double)stats.totalCycles / stats.count),
+           profiler.toMicroseconds(stats.maxCycles));
+    for (int b = 0; b < PROFILE_BUCKETS; b++)
+    {
+      if (stats.histogram[b] != 0)
+      {
+        printf("    %.2f - %.2f us: %u\n", profiler.toMicroseconds(b == 0 ? 0.0 : (double)(1ul << b)),
+               profiler.toMicroseconds(2.0 * (1ul << b)), stats.histogram[b]);
+      }
+    }
+  }
+}
+
+/**
+ * Time the stages that run on the host, and an empty stage.
+ */
+static void profileStages(int runs)
+{
+  Profiler profiler(chronoClock, 1000);
+  IkKernel<ik_scalar_t> kernel(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+  ForwardKinematics fk(FK_MAX_ITERATIONS, FK_TOLERANCE, FK_STEP);
+  ServoOutput output(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, SERVO_MIN_US, SERVO_MAX_US, SERVO_REVERSE, SERVO_TRIM);
+  float servos[6], estimate[6];
+  int failedLeg;
+  float value;
+  unsigned long writes = 0;
+
+  for (int i = 0; i < runs; i++)
+  {
+    const float t = i * 0.01f;
+
+    uint32_t start = profiler.start();
+    kernel.solve(servos, 10 * sinf(t), 10 * cosf(0.7f * t), 5 * sinf(0.3f * t), 8 * sinf(0.9f * t),
+                 8 * cosf(0.8f * t), 10 * sinf(0.4f * t), failedLeg, value);
+    profiler.stop(STAGE_IK, start);
+
+    start = profiler.start();
+    for (int k = 0; k < 6; k++)
+    {
+      writes += output.update(k, servos[k]) ? 1 : 0;
+    }
+    profiler.stop(STAGE_SERVO_WRITE, start);
+
+    start = profiler.start();
+    fk.estimate(kernel, servos, estimate);
+    profiler.stop(STAGE_ESTIMATE, start);
+
+    // Nothing between start() and stop(): the cost of the profiler
+    start = profiler.start();
+    profiler.stop(STAGE_SHELL, start);
+  }
+
+  printf("\nhost stages, std::chrono counter, %d runs (%lu pulse widths written), shell = empty stage:\n", runs,
+         writes);
+  report(profiler);
+}
+
+int main(int argc, char **argv)
+{
+  const int runs = argc > 1 ? atoi(argv[1]) : 100000;
+  srand(1);
+
+  const bool ok = checkBookkeeping(runs);
+  profileStages(runs);
+
+  printf("\n%s\n", ok ? "ok" : "FAIL");
+  return ok ? 0 : 1;
+}
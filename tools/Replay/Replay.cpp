@@ -0,0 +1,671 @@
+/**
+ * @file Replay.cpp
+ * @brief Replays a record of the loop inputs through the firmware, on the host
+ *
+ * The `record send` command prints the record of the touchscreen samples,
+ * Nunchuck reads and task runs of the loop (see Recorder.h). Saved from the
+ * serial console to a file, this tool feeds it back through the firmware's
+ * TouchScreenDriver, NunchuckDriver, PoseArbiter and Platform, on the native
+ * HAL (src/hal/native/): the clock is on simulated time, set to the recorded
+ * time of each entry, and the touchscreen and Nunchuck return the recorded
+ * readings. Each task runs where the record says it ran, so the controllers
+ * see the same inputs at the same times as they did on the rig.
+ *
+ * The replay starts from the oldest keyframe left in the record: the state
+ * the loop recorded when recording started, and every
+ * RECORDER_KEYFRAME_INTERVAL_MS after (see Recorder.h). It restores the
+ * geometry, the setpoints, the pending pose requests and the interpolator,
+ * the touch filter window and the PID integrators, and the Nunchuck mode
+ * and setpoint, and skips the entries before. A shell command that changes
+ * the loop (geometry, gains, moves, servos) makes the loop record another
+ * keyframe, which the replay restores when it gets to it, as the inputs do
+ * not tell it about the command. At every keyframe, the firmware and the
+ * replay start the solve caches afresh. Without a keyframe, the replay
+ * starts from the state of the firmware at boot.
+ *
+ * Each pose solve is checked against the checksum of the servo setpoints
+ * that the firmware recorded at that tick. The record is replayed twice, and
+ * the two replays must give bit-identical setpoints. It reports:
+ * - the rate and the longest interval of each kind of entry, from the record;
+ * - the setpoint checksum of the whole replay, identical on every run and
+ *   build of the same record and firmware;
+ * - the keyframe it starts from, and the keyframes it restores on the way;
+ * - how many pose solves give the recorded setpoints, and the first that
+ *   does not. A record from the native build matches from its first tick.
+ *   The device rounds some of its math differently (software floating
+ *   point), so a record from the Teensy may not match at all; nor may one
+ *   without a keyframe, until the filters and controllers have caught up;
+ * - how much faster than real time the replay runs.
+ * It exits with a non-zero status if the replays differ, or if the replay
+ * stops matching the record after it started to.
+ *
+ * With a second argument, it also writes the setpoints of each pose solve to
+ * a CSV file, to compare or plot.
+ *
+ * It needs the PID and ArduinoLog libraries, so it is built by PlatformIO,
+ * from the repository root:
+ *   pio run -e replay
+ *   .pio/build/replay/program capture.txt [trace.csv]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Arduino.h>
+#include <ArduinoLog.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "core/Config.h"
+#include "core/Platform.h"
+#include "core/PoseArbiter.h"
+#include "core/Recorder.h"
+#include "drivers/Nunchuck.h"
+#include "drivers/TouchScreen.h"
+#include "hal/Clock.h"
+#include "hal/Native.h"
+#include "hal/Store.h"
+
+using namespace stewy;
+
+/**
+ * @struct Keyframe
+ * @brief State of the loop, recorded with the entries
+ */
+struct Keyframe
+{
+  size_t index;                                          ///< Entry of the RECORD_KEYFRAME
+  core::RecordKeyframeReason reason;                     ///< Why it was recorded
+  std::vector<uint8_t> states[core::RECORD_STATE_COUNT]; ///< Bytes of each state, empty if not recorded
+};
+
+/**
+ * @struct Capture
+ * @brief Record, as sent by the record command
+ */
+struct Capture
+{
+  drivers::TouchCalibration calibration; ///< Touchscreen calibration of the rig
+  double gains[6];                       ///< Roll P, I, D, then pitch P, I, D
+  unsigned long overwritten;             ///< Entries lost before the oldest
+  std::vector<core::RecordEntry> entries; ///< Entries, oldest first
+  std::vector<uint32_t> timesUs;          ///< Time of each entry
+  std::vector<Keyframe> keyframes;        ///< Complete keyframes, oldest first
+};
+
+/**
+ * @struct Firmware
+ * @brief The parts of the loop that the replay runs
+ */
+struct Firmware
+{
+  core::Platform *platform;                ///< Platform, holds the setpoints
+  core::PoseArbiter *arbiter;              ///< Arbiter of the pose requests
+  drivers::TouchScreenDriver *touchscreen; ///< Ball controller
+  drivers::NunchuckDriver *nunchuck;       ///< Nunchuck modes
+  core::xy_coordf setpoint;                ///< Ball setpoint from the Nunchuck
+  float servoValues[6];                    ///< Servo setpoints of the last pose solve
+};
+
+/**
+ * @struct Result
+ * @brief Outcome of one replay
+ */
+struct Result
+{
+  uint32_t digest;               ///< Checksum of the setpoints of every pose solve, in order
+  std::vector<uint32_t> outputs; ///< Checksum of the setpoints of each pose solve
+  unsigned long matched;         ///< Pose solves that give the recorded setpoints
+  long firstMatch;               ///< First pose solve that does, -1 if none
+  long firstMismatchAfterMatch;  ///< First pose solve that does not, after one did, -1 if none
+  double wallSeconds;            ///< Host time of the replay
+};
+
+static int hexValue(char c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f')
+  {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F')
+  {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+/**
+ * Gather the states of each keyframe. A keyframe the buffer wrapped around
+ * over lost its RECORD_KEYFRAME entry, and its leftover states are skipped.
+ */
+static void readKeyframes(Capture &capture)
+{
+  const std::vector<core::RecordEntry> &entries = capture.entries;
+  for (size_t i = 0; i < entries.size(); i++)
+  {
+    if (entries[i].type != core::RECORD_KEYFRAME)
+    {
+      continue;
+    }
+
+    Keyframe keyframe;
+    keyframe.index = i;
+    keyframe.reason = (core::RecordKeyframeReason)entries[i].flags;
+    bool complete = true;
+    size_t next = i + 1;
+    for (int n = 0; n < entries[i].a && complete; n++)
+    {
+      complete = next < entries.size() && entries[next].type == core::RECORD_STATE &&
+                 entries[next].flags < core::RECORD_STATE_COUNT;
+      if (!complete)
+      {
+        continue;
+      }
+      std::vector<uint8_t> &bytes = keyframe.states[entries[next].flags];
+      const size_t size = (uint16_t)entries[next].a;
+      for (next++; bytes.size() < size && complete; next++)
+      {
+        complete = next < entries.size() && entries[next].type == core::RECORD_DATA;
+        if (complete)
+        {
+          const core::RecordEntry &data = entries[next];
+          const uint8_t chunk[core::RECORD_DATA_BYTES] = {data.flags, (uint8_t)data.a, (uint8_t)((uint16_t)data.a >> 8),
+                                                          (uint8_t)data.b, (uint8_t)((uint16_t)data.b >> 8)};
+          for (int j = 0; j < core::RECORD_DATA_BYTES && bytes.size() < size; j++)
+          {
+            bytes.push_back(chunk[j]);
+          }
+        }
+      }
+    }
+
+    // The states are the bytes of structs, which must be laid out as in this build
+    static const size_t STATE_SIZES[core::RECORD_STATE_COUNT] = {
+        sizeof(core::RecordLoopState),  sizeof(core::GeometryRecord),   sizeof(core::PlatformState),
+        sizeof(core::PoseArbiterState), sizeof(drivers::TouchState), sizeof(drivers::NunchuckDriverState)};
+    bool matches = true;
+    for (int state = 0; state < core::RECORD_STATE_COUNT; state++)
+    {
+      matches = matches && (keyframe.states[state].empty() || keyframe.states[state].size() == STATE_SIZES[state]);
+    }
+
+    if (!complete)
+    {
+      fprintf(stderr, "Incomplete keyframe at entry %lu, skipped\n", (unsigned long)i);
+    }
+    else if (!matches)
+    {
+      fprintf(stderr, "The keyframe at entry %lu is from another build of the firmware, skipped\n", (unsigned long)i);
+    }
+    else
+    {
+      capture.keyframes.push_back(keyframe);
+    }
+  }
+}
+
+/**
+ * Read the record from a capture of the serial console. The lines of the
+ * record may come after other output, on the same line or not.
+ */
+static bool readCapture(const char *path, Capture &capture)
+{
+  FILE *file = fopen(path, "r");
+  if (file == nullptr)
+  {
+    fprintf(stderr, "Cannot open %s\n", path);
+    return false;
+  }
+
+  char line[512];
+  int version = 0, count = -1, calibrated = 0;
+  unsigned long firstUs = 0;
+  unsigned long expected = 0;
+  bool ended = false;
+  uint32_t checksum = core::RECORD_CHECKSUM_SEED;
+  while (!ended && fgets(line, sizeof(line), file) != nullptr)
+  {
+    const char *text;
+    if ((text = strstr(line, "STEWY-RECORD ")) != nullptr)
+    {
+      // A later record replaces an earlier one
+      drivers::TouchCalibration &c = capture.calibration;
+      double *g = capture.gains;
+      if (sscanf(text, "STEWY-RECORD %d %d %lu %lu %d %d %d %d %d %lf %lf %lf %lf %lf %lf", &version, &count, &firstUs,
+                 &capture.overwritten, &calibrated, &c.minX, &c.maxX, &c.minY, &c.maxY, &g[0], &g[1], &g[2], &g[3],
+                 &g[4], &g[5]) != 15 ||
+          version != 2)
+      {
+        fprintf(stderr, "Unknown record header: %s", text);
+        fclose(file);
+        return false;
+      }
+      c.isCalibrated = calibrated != 0;
+      capture.entries.clear();
+      checksum = core::RECORD_CHECKSUM_SEED;
+    }
+    else if ((text = strstr(line, "STEWY-DATA ")) != nullptr && count >= 0)
+    {
+      text += strlen("STEWY-DATA ");
+      uint8_t bytes[core::RECORD_ENTRY_BYTES];
+      int n = 0;
+      for (; hexValue(text[0]) >= 0 && hexValue(text[1]) >= 0; text += 2)
+      {
+        bytes[n++] = (uint8_t)(hexValue(text[0]) << 4 | hexValue(text[1]));
+        if (n == core::RECORD_ENTRY_BYTES)
+        {
+          core::RecordEntry entry;
+          core::Recorder::decode(bytes, entry);
+          capture.entries.push_back(entry);
+          checksum = core::Recorder::checksum(checksum, bytes, sizeof(bytes));
+          n = 0;
+        }
+      }
+    }
+    else if ((text = strstr(line, "STEWY-END ")) != nullptr && count >= 0)
+    {
+      sscanf(text, "STEWY-END %lx", &expected);
+      ended = true;
+    }
+  }
+  fclose(file);
+
+  if (count < 0 || !ended)
+  {
+    fprintf(stderr, "No complete record in %s\n", path);
+    return false;
+  }
+  if ((int)capture.entries.size() != count || checksum != expected)
+  {
+    fprintf(stderr, "Corrupt record: %d entries with checksum %08lx sent, %d with checksum %08lx received\n", count,
+            expected, (int)capture.entries.size(), (unsigned long)checksum);
+    return false;
+  }
+
+  // Time of each entry, from the deltas
+  uint32_t timeUs = (uint32_t)firstUs;
+  for (size_t i = 0; i < capture.entries.size(); i++)
+  {
+    const core::RecordEntry &entry = capture.entries[i];
+    if (entry.type == core::RECORD_TIME)
+    {
+      timeUs = ((uint32_t)(uint16_t)entry.a << 16) | (uint16_t)entry.b;
+    }
+    else if (i > 0)
+    {
+      timeUs += entry.deltaUs;
+    }
+    capture.timesUs.push_back(timeUs);
+  }
+
+  readKeyframes(capture);
+  return true;
+}
+
+/**
+ * Rate and longest interval of each kind of entry: the timing of the loop on the rig.
+ */
+static void reportTiming(const Capture &capture)
+{
+  const uint32_t spanUs = capture.timesUs.back() - capture.timesUs.front();
+  printf("%lu entries over %.3f s", (unsigned long)capture.entries.size(), spanUs * 1e-6);
+  if (capture.overwritten > 0)
+  {
+    printf(" (the %lu before were overwritten)", capture.overwritten);
+  }
+  printf(", touchscreen %s, gains x %g/%g/%g y %g/%g/%g\n\n",
+         capture.calibration.isCalibrated ? "calibrated" : "not calibrated", capture.gains[0], capture.gains[1],
+         capture.gains[2], capture.gains[3], capture.gains[4], capture.gains[5]);
+
+  printf("%-14s %8s %10s %16s\n", "entry", "count", "rate Hz", "max interval ms");
+  for (int type = core::RECORD_TOUCH; type <= core::RECORD_KEYFRAME; type++)
+  {
+    unsigned long count = 0;
+    uint32_t lastUs = 0, maxIntervalUs = 0;
+    for (size_t i = 0; i < capture.entries.size(); i++)
+    {
+      if (capture.entries[i].type != type)
+      {
+        continue;
+      }
+      if (count > 0)
+      {
+        maxIntervalUs = max(maxIntervalUs, capture.timesUs[i] - lastUs);
+      }
+      lastUs = capture.timesUs[i];
+      count++;
+    }
+    printf("%-14s %8lu %10.1f %16.2f\n", core::Recorder::getTypeString((core::RecordType)type), count,
+           spanUs > 0 ? count / (spanUs * 1e-6) : 0.0, maxIntervalUs * 1e-3);
+  }
+  printf("\n");
+}
+
+/**
+ * Start the firmware, as at boot, with the calibration and the gains the record was sent with.
+ */
+static void boot(Firmware &firmware, const Capture &capture)
+{
+  firmware.platform = new core::Platform(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE);
+  firmware.arbiter = new core::PoseArbiter(*firmware.platform);
+  firmware.touchscreen = new drivers::TouchScreenDriver(XP, YP, XM, YM, TS_OHMS);
+  firmware.touchscreen->init();
+  if (capture.gains[0] != 0 || capture.gains[3] != 0)
+  {
+    firmware.touchscreen->setPID('x', capture.gains[0], capture.gains[1], capture.gains[2]);
+    firmware.touchscreen->setPID('y', capture.gains[3], capture.gains[4], capture.gains[5]);
+  }
+  firmware.nunchuck = new drivers::NunchuckDriver();
+  firmware.nunchuck->init();
+  firmware.setpoint = core::DEFAULT_SETPOINT;
+  firmware.platform->home(firmware.servoValues);
+}
+
+/**
+ * Copy a state of a keyframe into its struct. readKeyframes() checked the size.
+ */
+template <typename T>
+static bool getState(const Keyframe &keyframe, core::RecordState state, T &value)
+{
+  const std::vector<uint8_t> &bytes = keyframe.states[state];
+  if (bytes.size() != sizeof(T))
+  {
+    return false;
+  }
+  memcpy(&value, bytes.data(), sizeof(T));
+  return true;
+}
+
+/**
+ * Restore the state of a keyframe, recorded at timeUs.
+ */
+static void restore(Firmware &firmware, const Keyframe &keyframe, uint32_t timeUs)
+{
+  core::GeometryRecord geometry, current;
+  core::Platform::getGeometry().toRecord(current);
+  if (getState(keyframe, core::RECORD_STATE_GEOMETRY, geometry) &&
+      memcmp(geometry.values, current.values, sizeof(current.values)) != 0 && !core::Platform::setGeometry(geometry))
+  {
+    fprintf(stderr, "Invalid geometry in the keyframe at entry %lu, not applied\n", (unsigned long)keyframe.index);
+  }
+
+  core::RecordLoopState loop;
+  if (getState(keyframe, core::RECORD_STATE_LOOP, loop))
+  {
+    memcpy(firmware.servoValues, loop.servoValues, sizeof(firmware.servoValues));
+    firmware.setpoint.x = loop.setpointX;
+    firmware.setpoint.y = loop.setpointY;
+  }
+
+  core::PlatformState platform;
+  if (getState(keyframe, core::RECORD_STATE_PLATFORM, platform))
+  {
+    firmware.platform->setState(platform);
+  }
+
+  core::PoseArbiterState arbiter;
+  if (getState(keyframe, core::RECORD_STATE_ARBITER, arbiter))
+  {
+    firmware.arbiter->setState(arbiter);
+  }
+
+  drivers::TouchState touch;
+  if (getState(keyframe, core::RECORD_STATE_TOUCH, touch))
+  {
+    // The PID library takes the time of its last compute from the clock: back to it, then on to the keyframe
+    hal::native::useVirtualClock();
+    hal::native::advanceClock(touch.roll.lastMs * 1000u);
+    firmware.touchscreen->setPIDState('x', touch.roll);
+    hal::native::useVirtualClock();
+    hal::native::advanceClock(touch.pitch.lastMs * 1000u);
+    firmware.touchscreen->setPIDState('y', touch.pitch);
+    hal::native::useVirtualClock();
+    hal::native::advanceClock(timeUs);
+    firmware.touchscreen->setState(touch);
+  }
+
+  drivers::NunchuckDriverState nunchuck;
+  if (getState(keyframe, core::RECORD_STATE_NUNCHUCK, nunchuck))
+  {
+    firmware.nunchuck->setState(nunchuck);
+  }
+
+  core::Platform::invalidateCaches();
+}
+
+/**
+ * Run the record through the firmware, from its oldest keyframe, or from its state at boot.
+ */
+static Result replay(const Capture &capture, FILE *trace)
+{
+  const std::chrono::steady_clock::time_point wallStart = std::chrono::steady_clock::now();
+  hal::native::useVirtualClock();
+  hal::native::setTouchPoint({0, 0, 0});
+
+  Firmware firmware;
+  boot(firmware, capture);
+  float *servoValues = firmware.servoValues;
+
+  size_t start = 0;
+  size_t nextKeyframe = 0;
+  if (!capture.keyframes.empty())
+  {
+    start = capture.keyframes[0].index;
+    restore(firmware, capture.keyframes[0], capture.timesUs[start]);
+    nextKeyframe = 1;
+  }
+
+  Result result = Result();
+  result.digest = core::RECORD_CHECKSUM_SEED;
+  result.firstMatch = -1;
+  result.firstMismatchAfterMatch = -1;
+  for (size_t i = start; i < capture.entries.size(); i++)
+  {
+    const core::RecordEntry &entry = capture.entries[i];
+    hal::native::advanceClock(capture.timesUs[i] - hal::micros());
+
+    switch (entry.type)
+    {
+    case core::RECORD_TOUCH:
+      hal::native::setTouchPoint({entry.a, entry.b, entry.flags});
+      firmware.touchscreen->sample();
+      break;
+
+    case core::RECORD_NUNCHUCK:
+      hal::native::setNunchuckState({entry.a, entry.b, (entry.flags & core::RECORD_NUNCHUCK_Z) != 0,
+                                     (entry.flags & core::RECORD_NUNCHUCK_C) != 0});
+      firmware.setpoint = firmware.nunchuck->process(*firmware.arbiter);
+      break;
+
+    case core::RECORD_BALL_CONTROL:
+      firmware.touchscreen->control(firmware.setpoint.x, firmware.setpoint.y, *firmware.arbiter);
+      break;
+
+    case core::RECORD_KEYFRAME:
+      if (nextKeyframe < capture.keyframes.size() && capture.keyframes[nextKeyframe].index == i)
+      {
+        // A shell command changed the loop behind the inputs: take its state from the keyframe
+        const Keyframe &keyframe = capture.keyframes[nextKeyframe++];
+        if (keyframe.reason == core::RECORD_KEYFRAME_CHANGE)
+        {
+          restore(firmware, keyframe, capture.timesUs[i]);
+          break;
+        }
+      }
+      // The firmware started the solve caches afresh
+      core::Platform::invalidateCaches();
+      break;
+
+    case core::RECORD_CONTROL:
+    {
+      firmware.arbiter->update(servoValues);
+      const uint32_t output =
+          core::Recorder::checksum(core::RECORD_CHECKSUM_SEED, (const uint8_t *)servoValues, 6 * sizeof(float));
+      const uint32_t recorded = ((uint32_t)(uint16_t)entry.a << 16) | (uint16_t)entry.b;
+      const long tick = (long)result.outputs.size();
+      result.outputs.push_back(output);
+      result.digest = core::Recorder::checksum(result.digest, (const uint8_t *)servoValues, 6 * sizeof(float));
+      if (output == recorded)
+      {
+        result.matched++;
+        if (result.firstMatch < 0)
+        {
+          result.firstMatch = tick;
+        }
+      }
+      else if (result.firstMatch >= 0 && result.firstMismatchAfterMatch < 0)
+      {
+        result.firstMismatchAfterMatch = tick;
+      }
+
+      if (trace != nullptr)
+      {
+        fprintf(trace, "%lu,%d", (unsigned long)capture.timesUs[i], output == recorded ? 1 : 0);
+        for (int servo = 0; servo < 6; servo++)
+        {
+          fprintf(trace, ",%.9g", servoValues[servo]);
+        }
+        fprintf(trace, "\n");
+      }
+      break;
+    }
+
+    default:
+      // Time entries only move the clock, and the states were read with their keyframe. The pose estimate has no
+      // effect on the setpoints
+      break;
+    }
+  }
+
+  delete firmware.nunchuck;
+  delete firmware.touchscreen;
+  delete firmware.arbiter;
+  delete firmware.platform;
+  result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+  return result;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 2 && argc != 3)
+  {
+    fprintf(stderr, "Usage: %s <capture> [trace.csv]\n", argv[0]);
+    return 2;
+  }
+
+  Capture capture;
+  if (!readCapture(argv[1], capture))
+  {
+    return 2;
+  }
+  if (capture.entries.empty())
+  {
+    printf("The record is empty\n");
+    return 0;
+  }
+
+  // The calibration of the rig, where the touchscreen driver loads it from, and the default geometry
+  Log.begin(LOG_LEVEL_SILENT, &Serial);
+  hal::native::setStorePath("/dev/null");
+  if (capture.calibration.isCalibrated)
+  {
+    hal::storePut(TOUCH_CALIBRATION_ADDR, capture.calibration);
+  }
+
+  reportTiming(capture);
+
+  if (capture.keyframes.empty())
+  {
+    printf("No keyframe: the replay starts from the state of the firmware at boot\n\n");
+  }
+  else
+  {
+    const Keyframe &oldest = capture.keyframes.front();
+    unsigned long changes = 0;
+    for (size_t k = 1; k < capture.keyframes.size(); k++)
+    {
+      changes += capture.keyframes[k].reason == core::RECORD_KEYFRAME_CHANGE ? 1 : 0;
+    }
+    printf("The replay starts from the %s keyframe at %.3f s (the %lu entries before are skipped), and restores the "
+           "%lu keyframes after shell commands\n\n",
+           core::Recorder::getKeyframeReasonString(oldest.reason),
+           (capture.timesUs[oldest.index] - capture.timesUs.front()) * 1e-6, (unsigned long)oldest.index, changes);
+  }
+
+  FILE *trace = nullptr;
+  if (argc == 3)
+  {
+    trace = fopen(argv[2], "w");
+    if (trace == nullptr)
+    {
+      fprintf(stderr, "Cannot write %s\n", argv[2]);
+      return 2;
+    }
+    fprintf(trace, "time_us,matches_record,servo0,servo1,servo2,servo3,servo4,servo5\n");
+  }
+  const Result first = replay(capture, trace);
+  if (trace != nullptr)
+  {
+    fclose(trace);
+  }
+  const Result second = replay(capture, nullptr);
+
+  bool ok = true;
+  const uint32_t spanUs = capture.timesUs.back() - capture.timesUs.front();
+  printf("Replay: %lu pose solves, setpoint checksum %08lx, %.0fx real time\n", (unsigned long)first.outputs.size(),
+         (unsigned long)first.digest, spanUs * 1e-6 / min(first.wallSeconds, second.wallSeconds));
+
+  if (first.outputs != second.outputs)
+  {
+    size_t tick = 0;
+    while (tick < first.outputs.size() && first.outputs[tick] == second.outputs[tick])
+    {
+      tick++;
+    }
+    printf("FAILED: the second replay differs from the first, from pose solve %lu\n", (unsigned long)tick);
+    ok = false;
+  }
+  else
+  {
+    printf("Second replay: bit-identical setpoints\n");
+  }
+
+  printf("Against the record: %lu of %lu pose solves give the recorded setpoints", first.matched,
+         (unsigned long)first.outputs.size());
+  if (first.firstMatch > 0)
+  {
+    printf(", from pose solve %ld", first.firstMatch);
+  }
+  printf("\n");
+  if (first.firstMismatchAfterMatch >= 0)
+  {
+    printf("FAILED: pose solve %ld no longer gives the recorded setpoints\n", first.firstMismatchAfterMatch);
+    ok = false;
+  }
+  else if (first.firstMatch < 0)
+  {
+    printf("(none match: a record from another build, or from a state the replay does not start from)\n");
+  }
+
+  return ok ? 0 : 1;
+}
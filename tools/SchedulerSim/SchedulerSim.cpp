@@ -0,0 +1,370 @@
+/**
+ * @file SchedulerSim.cpp
+ * @brief Host check of the multi-rate scheduler, on a virtual clock
+ *
+ * This tool runs a Scheduler with the task table of main.cpp against a
+ * virtual microsecond clock, which starts just short of its wrap around.
+ * Each task advances the clock by a simulated run time, with the IK and
+ * FK varying from tick to tick, and the command line now and then stalls
+ * for a second, as the demo command does with delay(). Waiting for the
+ * next release advances the clock to it, or spins on it.
+ *
+ * It checks that:
+ * - each task starts within its worst-case latency (one blocking task, plus
+ *   the higher priority tasks released meanwhile), outside of the stalls;
+ * - releases are only skipped across a stall, and the scheduler counts
+ *   exactly those as overruns;
+ * - the ball controller runs on the touch sample of its frame, and the pose
+ *   solve on the ball controller output of its frame;
+ * - the scheduler only waits until a release.
+ *
+ * For comparison, it reports the control period of the previous loop(),
+ * which ran every subsystem and then called delay(MAIN_LOOP_INTERVAL_MS).
+ * It runs with an idle function and with a spin wait, and exits with a
+ * non-zero status if a check fails.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -I include tools/SchedulerSim/SchedulerSim.cpp src/core/Scheduler.cpp -o scheduler_sim
+ *   ./scheduler_sim [seconds]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "core/Scheduler.h"
+
+using namespace stewy::core;
+
+// Firmware settings (see Config.h and the task table of main.cpp)
+const uint32_t TOUCH_SAMPLE_INTERVAL_US = 5000;
+const uint32_t BALL_CONTROL_INTERVAL_US = 10000;
+const uint32_t CONTROL_INTERVAL_US = 10000;
+const uint32_t NUNCHUCK_INTERVAL_US = 20000;
+const uint32_t ESTIMATE_INTERVAL_US = 20000;
+const uint32_t MAIN_LOOP_INTERVAL_MS = 20; // Before the scheduler
+
+// Simulated run times, in microseconds
+const uint32_t TOUCH_US = 300;
+const uint32_t BALL_US = 600;
+const uint32_t CONTROL_MIN_US = 1000, CONTROL_MAX_US = 3500; // IK, 1 to 13 solves, and the servos
+const uint32_t NUNCHUCK_US = 400;
+const uint32_t ESTIMATE_MIN_US = 500, ESTIMATE_MAX_US = 3750; // FK, 2 to 15 solves
+const uint32_t SHELL_US = 50;
+const uint32_t STALL_US = 1000000;  // delay() of the demo command
+const uint32_t CLOCK_READ_US = 1;   // Each read of the clock costs a microsecond
+const uint32_t OVERHEAD_US = 20;    // Allowance for the clock reads of one pass
+
+enum
+{
+  TOUCH,
+  BALL,
+  CONTROL,
+  NUNCHUCK,
+  ESTIMATE,
+  SHELL,
+  TASKS
+};
+
+static uint32_t now;           // Virtual clock
+static uint32_t origin;        // Time of begin()
+static uint32_t stallEnd;      // End of the last stall of the command line
+static uint32_t nextStall;
+static unsigned long stalls;
+static uint32_t lcg = 1;
+
+static uint32_t randomIn(uint32_t lo, uint32_t hi)
+{
+  lcg = lcg * 1664525u + 1013904223u;
+  return lo + (lcg >> 8) % (hi - lo + 1);
+}
+
+static uint32_t virtualClock()
+{
+  now += CLOCK_READ_US;
+  return now;
+}
+
+static void idle(uint32_t untilUs);
+
+static void touchTask();
+static void ballTask();
+static void controlTask();
+static void nunchuckTask();
+static void estimateTask();
+static void shellTask();
+
+static const SchedulerTask tasks[] = {
+    {"touch", touchTask, TOUCH_SAMPLE_INTERVAL_US, 0, 5},
+    {"ball", ballTask, BALL_CONTROL_INTERVAL_US, 1500, 4},
+    {"control", controlTask, CONTROL_INTERVAL_US, 3000, 3},
+    {"nunchuck", nunchuckTask, NUNCHUCK_INTERVAL_US, 4000, 2},
+    {"estimate", estimateTask, ESTIMATE_INTERVAL_US, 6000, 1},
+    {"shell", shellTask, 0, 0, 0},
+};
+
+struct Observed
+{
+  bool started;
+  long lastRelease;       // Index of the release of the last run
+  uint32_t lastStart;     // Start of the last run
+  unsigned long skipped;  // Releases that never ran
+  unsigned long lateRuns; // Runs that started after their worst-case latency
+  uint32_t maxLatency;    // Outside of the stalls
+};
+
+static Observed observed[TASKS];
+static unsigned long errors, idles, badIdles;
+static uint32_t bound[TASKS];
+
+/**
+ * Record a run of a periodic task, against its grid of releases.
+ */
+static void observe(int task)
+{
+  const SchedulerTask &t = tasks[task];
+  Observed &o = observed[task];
+  const uint32_t sinceFirst = now - origin - t.phaseUs;
+  const long release = (long)(sinceFirst / t.periodUs);
+  const uint32_t latency = sinceFirst - (uint32_t)release * t.periodUs;
+
+  // A stall that ended after the previous run of the task
+  const bool stalled = stalls > 0 && o.started && (int32_t)(stallEnd - o.lastStart) > 0;
+  const long skipped = o.started ? release - o.lastRelease - 1 : release;
+  if (skipped < 0 || (skipped > 0 && !stalled))
+  {
+    if (errors++ < 10)
+    {
+      printf("  %s: release %ld run after release %ld, without a stall\n", t.name, release, o.lastRelease);
+    }
+  }
+  o.skipped += skipped > 0 ? skipped : 0;
+
+  // The first run after a stall waits for the stall, and for the backlog of the other tasks
+  if (!stalled && (int32_t)(now - stallEnd) > (int32_t)t.periodUs)
+  {
+    o.maxLatency = latency > o.maxLatency ? latency : o.maxLatency;
+    if (latency > bound[task])
+    {
+      o.lateRuns++;
+    }
+  }
+
+  o.started = true;
+  o.lastRelease = release;
+  o.lastStart = now;
+}
+
+/**
+ * Check that a task runs on the output of another, released `offsetUs` before it in the same frame.
+ */
+static void checkOrder(int task, int input, uint32_t offsetUs)
+{
+  const Observed &o = observed[task];
+  const Observed &in = observed[input];
+  const uint32_t release = origin + tasks[task].phaseUs + (uint32_t)o.lastRelease * tasks[task].periodUs;
+  if ((int32_t)(now - stallEnd) > (int32_t)tasks[task].periodUs &&
+      (!in.started || (int32_t)(in.lastStart - (release - offsetUs)) < 0))
+  {
+    if (errors++ < 10)
+    {
+      printf("  %s: ran without the %s of its frame\n", tasks[task].name, tasks[input].name);
+    }
+  }
+}
+
+static void touchTask()
+{
+  observe(TOUCH);
+  now += TOUCH_US;
+}
+
+static void ballTask()
+{
+  observe(BALL);
+  checkOrder(BALL, TOUCH, tasks[BALL].phaseUs - tasks[TOUCH].phaseUs);
+  now += BALL_US;
+}
+
+static void controlTask()
+{
+  observe(CONTROL);
+  checkOrder(CONTROL, BALL, tasks[CONTROL].phaseUs - tasks[BALL].phaseUs);
+  now += randomIn(CONTROL_MIN_US, CONTROL_MAX_US);
+}
+
+static void nunchuckTask()
+{
+  observe(NUNCHUCK);
+  now += NUNCHUCK_US;
+}
+
+static void estimateTask()
+{
+  observe(ESTIMATE);
+  now += randomIn(ESTIMATE_MIN_US, ESTIMATE_MAX_US);
+}
+
+static void shellTask()
+{
+  now += SHELL_US;
+  if ((int32_t)(now - nextStall) >= 0)
+  {
+    now += STALL_US;
+    stallEnd = now;
+    stalls++;
+    nextStall = now + randomIn(3000000, 7000000);
+  }
+}
+
+static void idle(uint32_t untilUs)
+{
+  // The scheduler only waits until the next release of some task
+  bool release = false;
+  for (int i = 0; i < TASKS; i++)
+  {
+    if (tasks[i].periodUs != 0 && (untilUs - origin - tasks[i].phaseUs) % tasks[i].periodUs == 0)
+    {
+      release = true;
+    }
+  }
+  badIdles += release && (int32_t)(untilUs - now) > 0 ? 0 : 1;
+  idles++;
+  now = untilUs;
+}
+
+/**
+ * Worst-case latency of each periodic task, without preemption: the longest
+ * run of any task, that may have started just before the release, plus the
+ * higher priority tasks released until the task starts.
+ */
+static void computeBounds()
+{
+  const uint32_t runUs[TASKS] = {TOUCH_US, BALL_US, CONTROL_MAX_US, NUNCHUCK_US, ESTIMATE_MAX_US, SHELL_US};
+  uint32_t blocking = 0;
+  for (int i = 0; i < TASKS; i++)
+  {
+    blocking = runUs[i] + OVERHEAD_US > blocking ? runUs[i] + OVERHEAD_US : blocking;
+  }
+  for (int i = 0; i < TASKS; i++)
+  {
+    uint32_t latency = blocking, previous = 0;
+    while (latency != previous && tasks[i].periodUs != 0)
+    {
+      previous = latency;
+      latency = blocking;
+      for (int h = 0; h < TASKS; h++)
+      {
+        if (tasks[h].periodUs != 0 && tasks[h].priority > tasks[i].priority)
+        {
+          latency += (previous / tasks[h].periodUs + 1) * (runUs[h] + OVERHEAD_US);
+        }
+      }
+    }
+    bound[i] = latency;
+  }
+}
+
+/**
+ * Run the scheduler for a number of seconds.
+ * Returns true if every check passes.
+ */
+static bool simulate(const char *name, void (*wait)(uint32_t), int seconds)
+{
+  now = 0xffffffffu - 1500000u; // Wraps around after 1.5 s
+  lcg = 1;
+  stalls = 0;
+  stallEnd = now;
+  nextStall = now + 2000000;
+  errors = idles = badIdles = 0;
+  for (int i = 0; i < TASKS; i++)
+  {
+    observed[i] = Observed();
+  }
+
+  Scheduler scheduler(tasks, TASKS, virtualClock, wait);
+  origin = now + CLOCK_READ_US; // begin() reads the clock once
+  scheduler.begin();
+  const uint32_t end = origin + (uint32_t)seconds * 1000000u;
+  while ((int32_t)(now - end) < 0)
+  {
+    scheduler.runOnce();
+  }
+
+  bool ok = errors == 0 && badIdles == 0;
+  printf("%s: %lu stalls, %lu waits\n", name, stalls, idles);
+  printf("  %-9s %7s %8s %9s %9s %9s %8s %6s\n", "task", "runs", "rate Hz", "overruns", "skipped", "max lat", "bound", "late");
+  for (int i = 0; i < TASKS; i++)
+  {
+    const TaskStats &stats = scheduler.getStats(i);
+    const Observed &o = observed[i];
+    const bool periodic = tasks[i].periodUs != 0;
+
+    // Every release before the last run either ran or was counted as an overrun
+    const bool counted = !periodic || (stats.overruns == o.skipped && stats.runs + stats.overruns == (unsigned long)o.lastRelease + 1);
+    ok = ok && counted && o.lateRuns == 0;
+    printf("  %-9s %7lu %8.1f %9lu %9lu %9u %8u %6lu %s\n", tasks[i].name, stats.runs, (double)stats.runs / seconds,
+           stats.overruns, o.skipped, (unsigned)o.maxLatency, (unsigned)bound[i], o.lateRuns,
+           counted && o.lateRuns == 0 ? "ok" : "FAIL");
+  }
+  if (badIdles)
+  {
+    printf("  %lu waits until a time that is not a release\n", badIdles);
+  }
+  return ok;
+}
+
+/**
+ * The previous loop(): every subsystem in turn, then delay(MAIN_LOOP_INTERVAL_MS),
+ * so the period is the run time of the subsystems plus the delay.
+ */
+static void previousLoop(int seconds)
+{
+  lcg = 1;
+  uint32_t t = 0, minPeriod = 0xffffffffu, maxPeriod = 0;
+  unsigned long loops = 0;
+  while (t < (uint32_t)seconds * 1000000u)
+  {
+    uint32_t run = TOUCH_US + BALL_US + NUNCHUCK_US + SHELL_US;
+    run += randomIn(CONTROL_MIN_US, CONTROL_MAX_US);
+    run += randomIn(ESTIMATE_MIN_US, ESTIMATE_MAX_US);
+    const uint32_t period = run + MAIN_LOOP_INTERVAL_MS * 1000;
+    minPeriod = period < minPeriod ? period : minPeriod;
+    maxPeriod = period > maxPeriod ? period : maxPeriod;
+    t += period;
+    loops++;
+  }
+  printf("previous loop, without stalls: %lu loops, %.1f Hz, control period %u to %u us\n", loops,
+         (double)loops / seconds, (unsigned)minPeriod, (unsigned)maxPeriod);
+}
+
+int main(int argc, char **argv)
+{
+  const int seconds = argc > 1 ? atoi(argv[1]) : 60;
+  computeBounds();
+
+  printf("%d s of scheduler, virtual clock wrapping after 1.5 s, %u ms command line stalls\n\n", seconds,
+         (unsigned)(STALL_US / 1000));
+  bool ok = simulate("idle", idle, seconds);
+  ok = simulate("spin", nullptr, seconds) && ok;
+  printf("\n");
+  previousLoop(seconds);
+
+  printf("\n%s\n", ok ? "ok" : "FAIL");
+  return ok ? 0 : 1;
+}
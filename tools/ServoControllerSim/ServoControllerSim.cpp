@@ -0,0 +1,269 @@
+/**
+ * @file ServoControllerSim.cpp
+ * @brief Host check of the timer-driven servo update, on a simulated timer
+ *
+ * This tool runs a ServoController the way main.cpp does, with the timer
+ * interrupt simulated: the control loop hands setpoints over every
+ * iteration, and the timer ticks every SERVO_UPDATE_INTERVAL_US in between,
+ * at whatever point the loop is. The loop runs every CONTROL_INTERVAL_US with
+ * some jitter, and now and then stalls for a second, as the demo command
+ * does with delay().
+ *
+ * It checks that:
+ * - every tick moves the servos exactly as a ServoProfile driven at the tick
+ *   times would, with the setpoints last handed over;
+ * - a servo is only written when its pulse width changes, and the last
+ *   pulse written is that of its angle;
+ * - the positions the loop reads are those of the last tick;
+ * - the servos keep moving while the loop stalls.
+ *
+ * For comparison, the same loop is run with the servos moved from the loop
+ * (updateServos() without SERVO_CONTROLLER_ENABLED), and the tool reports the
+ * longest time a moving servo goes without a new pulse width in each case.
+ * It runs with and without a motion profile, and exits with a non-zero
+ * status if a check fails.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -I include tools/ServoControllerSim/ServoControllerSim.cpp src/core/ServoController.cpp src/core/ServoOutput.cpp src/core/ServoProfile.cpp -o servo_controller_sim
+ *   ./servo_controller_sim [seconds]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "core/ServoController.h"
+
+using namespace stewy::core;
+
+// Firmware settings (see Config.h)
+const float SERVO_MAX_SPEED_DEG = 500.0f;
+const float SERVO_MAX_ACCEL_DEG = 750.0f;
+const float SERVO_MAX_JERK_DEG = 15000.0f;
+const uint32_t SERVO_UPDATE_INTERVAL_US = 2000;
+const uint32_t LOOP_US = 10000; // CONTROL_INTERVAL_US
+const int SERVO_MIN_ANGLE = 0;
+const int SERVO_MAX_ANGLE = 360;
+const int SERVO_MIN_US = 755;
+const int SERVO_MAX_US = 2250;
+const int SERVO_REVERSE[6] = {0, 1, 0, 1, 0, 1};
+const int SERVO_TRIM[6] = {0, 0, 0, 0, 0, 0};
+const float SERVO_MID_ANGLE = 90.0f;
+
+const uint32_t STALL_US = 1000000; // A demo step, delay(1000)
+const float STALL_CHANCE = 0.02f;   // Chance that a loop iteration stalls
+const uint32_t START_US = 0xffffffffu - 1500000; // Close to the wrap of micros()
+
+/**
+ * Setpoint of a servo at a time: a jump every 1.5 s, on a slow sine.
+ */
+static float setpoint(int servo, uint32_t elapsedUs)
+{
+  const uint32_t step = elapsedUs / 1500000;
+  const uint32_t h = (step * 7 + servo) * 2654435761u;
+  return 40.0f + 100.0f * (h >> 8) / 16777216.0f + 10 * sinf(elapsedUs * 1e-6f + servo);
+}
+
+// What the simulated servos were last written, and the checks on it
+static uint16_t written[6];
+static unsigned long repeatedWrites;
+
+static void writeServo(int servo, uint16_t us)
+{
+  if (us == written[servo])
+  {
+    repeatedWrites++;
+  }
+  written[servo] = us;
+}
+
+/**
+ * Longest time a servo goes without a new pulse width, while its setpoint is
+ * not yet reached.
+ */
+struct Gap
+{
+  uint32_t changedUs[6];
+  uint16_t pulse[6];
+  uint32_t longestUs;
+
+  void reset(uint32_t nowUs)
+  {
+    for (int i = 0; i < 6; i++)
+    {
+      changedUs[i] = nowUs;
+      pulse[i] = 0;
+    }
+    longestUs = 0;
+  }
+
+  void sample(int servo, uint16_t us, uint16_t targetUs, uint32_t nowUs)
+  {
+    if (us != pulse[servo] || us == targetUs)
+    {
+      pulse[servo] = us;
+      changedUs[servo] = nowUs;
+    }
+    else if (nowUs - changedUs[servo] > longestUs)
+    {
+      longestUs = nowUs - changedUs[servo];
+    }
+  }
+};
+
+struct Result
+{
+  unsigned long loops, ticks, targets, writes, mismatches, stalls;
+  uint32_t timerGapUs, loopGapUs;
+};
+
+/**
+ * Run the loop against the controller, and the same loop moving the servos
+ * itself.
+ */
+static Result run(const ServoProfile *profile, uint32_t durationUs)
+{
+  Result result = {0, 0, 0, 0, 0, 0, 0, 0};
+  const ServoOutput output(SERVO_MIN_ANGLE, SERVO_MAX_ANGLE, SERVO_MIN_US, SERVO_MAX_US, SERVO_REVERSE, SERVO_TRIM);
+  ServoController controller(output, writeServo, profile);
+  const ServoProfile unprofiled(0, 0, 0);
+  const ServoProfile &prototype = profile != nullptr ? *profile : unprofiled;
+
+  // Reference, ticked alongside the controller; and the servos moved from the loop
+  ServoProfile reference[6] = {prototype, prototype, prototype, prototype, prototype, prototype};
+  ServoProfile fromLoop[6] = {prototype, prototype, prototype, prototype, prototype, prototype};
+  ServoOutput referenceOutput = output;
+  ServoOutput loopOutput = output;
+  float targets[6], positions[6], ticked[6];
+  Gap timerGap, loopGap;
+
+  for (int i = 0; i < 6; i++)
+  {
+    positions[i] = SERVO_MID_ANGLE;
+    ticked[i] = SERVO_MID_ANGLE;
+    targets[i] = SERVO_MID_ANGLE;
+    reference[i].reset(SERVO_MID_ANGLE, START_US);
+    fromLoop[i].reset(SERVO_MID_ANGLE, START_US);
+    written[i] = 0;
+  }
+  repeatedWrites = 0;
+  controller.begin(positions, START_US);
+  timerGap.reset(START_US);
+  loopGap.reset(START_US);
+
+  uint32_t now = START_US;
+  uint32_t nextTick = START_US + SERVO_UPDATE_INTERVAL_US;
+  while (now - START_US < durationUs)
+  {
+    // One loop iteration: new setpoints, handed over, and the positions read back
+    result.loops++;
+    for (int i = 0; i < 6; i++)
+    {
+      targets[i] = setpoint(i, now - START_US);
+    }
+    controller.setTargets(targets);
+    controller.getPositions(positions);
+    for (int i = 0; i < 6; i++)
+    {
+      if (positions[i] != ticked[i])
+      {
+        result.mismatches++;
+      }
+
+      // The same iteration, moving the servos from the loop
+      float angle = targets[i];
+      if (profile != nullptr)
+      {
+        fromLoop[i].setTarget(angle, now);
+        angle = fromLoop[i].update(now);
+      }
+      loopOutput.update(i, angle);
+      loopGap.sample(i, loopOutput.getMicroseconds(i), output.toMicroseconds(i, targets[i]), now);
+    }
+
+    // The rest of the iteration, during which the timer interrupts it
+    uint32_t period = LOOP_US - 2000 + (uint32_t)(4000 * (rand() / (RAND_MAX + 1.0)));
+    if ((float)rand() / RAND_MAX < STALL_CHANCE)
+    {
+      period = STALL_US;
+      result.stalls++;
+    }
+    const uint32_t end = now + period;
+    while ((int32_t)(end - nextTick) > 0)
+    {
+      controller.tick(nextTick);
+
+      for (int i = 0; i < 6; i++)
+      {
+        float angle = targets[i];
+        if (profile != nullptr)
+        {
+          reference[i].setTarget(angle, nextTick);
+          angle = reference[i].update(nextTick);
+        }
+        ticked[i] = angle;
+        referenceOutput.update(i, angle);
+        if (written[i] != referenceOutput.getMicroseconds(i))
+        {
+          result.mismatches++;
+        }
+        timerGap.sample(i, written[i], output.toMicroseconds(i, targets[i]), nextTick);
+      }
+      nextTick += SERVO_UPDATE_INTERVAL_US;
+    }
+    now = end;
+  }
+
+  const ServoControllerStats stats = controller.getStats();
+  result.ticks = stats.ticks;
+  result.targets = stats.targets;
+  result.writes = stats.writes;
+  result.mismatches += repeatedWrites;
+  result.timerGapUs = timerGap.longestUs;
+  result.loopGapUs = loopGap.longestUs;
+  return result;
+}
+
+int main(int argc, char **argv)
+{
+  const float seconds = argc > 1 ? (float)atof(argv[1]) : 60;
+  const uint32_t durationUs = (uint32_t)(seconds * 1e6f);
+  const ServoProfile profile(SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG);
+
+  printf("%d s of loop at %u ms with %u ms stalls, servo timer every %u us\n\n", (int)seconds,
+         (unsigned)(LOOP_US / 1000), (unsigned)(STALL_US / 1000), (unsigned)SERVO_UPDATE_INTERVAL_US);
+  printf("%-12s %6s %6s %7s %8s %7s %11s %13s %13s\n", "profile", "loops", "stalls", "ticks", "targets", "writes",
+         "mismatches", "timer gap ms", "loop gap ms");
+
+  bool ok = true;
+  srand(1);
+  for (int p = 0; p < 2; p++)
+  {
+    const Result r = run(p == 0 ? &profile : nullptr, durationUs);
+    printf("%-12s %6lu %6lu %7lu %8lu %7lu %11lu %13.1f %13.1f\n", p == 0 ? "S-curve" : "none", r.loops, r.stalls,
+           r.ticks, r.targets, r.writes, r.mismatches, r.timerGapUs / 1000.0f, r.loopGapUs / 1000.0f);
+
+    // A moving servo must not wait for the loop: its pulse changes at least every few ticks
+    ok = ok && r.mismatches == 0 && r.targets == r.loops && r.timerGapUs < STALL_US / 10;
+  }
+
+  printf("\n%s (gap: longest time a servo short of its setpoint went without a new pulse width)\n",
+         ok ? "All checks passed" : "FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,246 @@
+/**
+ * @file ServoProfileReplay.cpp
+ * @brief Host check that servo motion does not depend on loop timing
+ *
+ * This tool replays the same setpoints for six servos under several loop
+ * schedules, as updateServos() would see them: a steady CONTROL_INTERVAL_US
+ * loop, a 1 ms loop, random periods with overruns, and a loop that stalls
+ * now and then. The setpoints change at fixed times (every checkpoint), as
+ * a mix of jumps and a slowly moving target.
+ *
+ * Every angle any schedule produces is compared with the reference
+ * trajectory at the same time, and must be identical. For comparison, the
+ * per-iteration ramp that updateServos() used before (limits in degrees per
+ * loop iteration) is replayed under the same schedules, and the tool
+ * reports how far its trajectories drift apart. It also reports the peak
+ * speed, acceleration and jerk against the limits.
+ *
+ * It exits with a non-zero status if a trajectory differs or a limit is
+ * exceeded.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -I include tools/ServoProfileReplay/ServoProfileReplay.cpp src/core/ServoProfile.cpp -o servo_profile_replay
+ *   ./servo_profile_replay [seconds]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "core/ServoProfile.h"
+
+using namespace stewy::core;
+
+// Firmware settings (see Config.h)
+const float SERVO_MAX_SPEED_DEG = 500.0f;
+const float SERVO_MAX_ACCEL_DEG = 750.0f;
+const float SERVO_MAX_JERK_DEG = 15000.0f;
+const uint32_t LOOP_US = 10000; // CONTROL_INTERVAL_US
+const float SERVO_MID_ANGLE = 90.0f;
+
+// The per-iteration ramp replaced by ServoProfile, tuned for LOOP_US
+const float RAMP_MAX_SPEED = 10.0f;   // Degrees per loop iteration
+const float RAMP_ACCELERATION = 0.3f; // Degrees per loop iteration squared
+
+const uint32_t CHECKPOINT_US = 100000; // Setpoints change, and every schedule passes, every this often
+const uint32_t START_US = 0xffffffffu - 1500000; // Close to the wrap of micros()
+
+/**
+ * A loop schedule: the period of the next iteration, given a random draw.
+ */
+struct Schedule
+{
+  const char *name;
+  uint32_t minUs; ///< Shortest period
+  uint32_t maxUs; ///< Longest period
+  float stall;    ///< Chance that an iteration stalls for CHECKPOINT_US instead
+};
+
+const Schedule SCHEDULES[] = {
+    {"steady 10 ms", LOOP_US, LOOP_US, 0},
+    {"steady 1 ms", 1000, 1000, 0},
+    {"random 3-45 ms", 3000, 45000, 0},
+    {"random, stalls", 1000, 30000, 0.05f},
+};
+const int SCHEDULE_COUNT = sizeof(SCHEDULES) / sizeof(SCHEDULES[0]);
+
+/**
+ * Setpoint of a servo from checkpoint k on: jumps for the first half, a
+ * target that moves a little every checkpoint for the second.
+ */
+static float setpoint(int servo, int k, int checkpoints)
+{
+  if (k < checkpoints / 2)
+  {
+    // A hash rather than rand(), which draws the loop periods
+    const uint32_t h = (uint32_t)(k * 7 + servo) * 2654435761u;
+    return (k % 4 == 0) ? SERVO_MID_ANGLE : 20.0f + 140.0f * (h >> 8) / 16777216.0f;
+  }
+  return SERVO_MID_ANGLE + 40 * sinf(0.3f * k + servo);
+}
+
+/**
+ * One iteration of the per-iteration ramp of the previous updateServos().
+ */
+static void ramp(float target, float &position, float &velocity)
+{
+  const float distance = target - position;
+  if (fabsf(distance) > 0.01f)
+  {
+    const float direction = distance > 0 ? 1.0f : -1.0f;
+    const float desired = direction * fminf(fabsf(distance), RAMP_MAX_SPEED);
+    if (velocity < desired)
+    {
+      velocity = fminf(velocity + RAMP_ACCELERATION, desired);
+    }
+    else if (velocity > desired)
+    {
+      velocity = fmaxf(velocity - RAMP_ACCELERATION, desired);
+    }
+    position += velocity;
+    if ((direction > 0 && position >= target) || (direction < 0 && position <= target))
+    {
+      position = target;
+      velocity = 0;
+    }
+  }
+  else
+  {
+    velocity = 0;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const float seconds = argc > 1 ? (float)atof(argv[1]) : 20;
+  const int checkpoints = (int)(seconds * 1e6f / CHECKPOINT_US);
+
+  // Reference: updated at every step of the profile, with the state at each
+  // checkpoint kept, so that the angle at any time can be evaluated from it
+  std::vector<ServoProfile> reference;
+  float maxSpeed = 0, maxAccel = 0, maxJerk = 0;
+  std::vector<float> rampReference;
+  {
+    std::vector<ServoProfile> profiles(6, ServoProfile(SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG));
+    float accel[6] = {0};
+    for (int i = 0; i < 6; i++)
+    {
+      profiles[i].reset(SERVO_MID_ANGLE, START_US);
+    }
+    for (int k = 0; k < checkpoints; k++)
+    {
+      const uint32_t checkpointUs = START_US + k * CHECKPOINT_US;
+      for (int i = 0; i < 6; i++)
+      {
+        profiles[i].setTarget(setpoint(i, k, checkpoints), checkpointUs);
+        reference.push_back(profiles[i]);
+      }
+      for (uint32_t us = SERVO_PROFILE_STEP_US; us <= CHECKPOINT_US; us += SERVO_PROFILE_STEP_US)
+      {
+        for (int i = 0; i < 6; i++)
+        {
+          profiles[i].update(checkpointUs + us);
+          maxSpeed = fmaxf(maxSpeed, fabsf(profiles[i].getSpeed()));
+          maxAccel = fmaxf(maxAccel, fabsf(profiles[i].getAcceleration()));
+          maxJerk = fmaxf(maxJerk, fabsf(profiles[i].getAcceleration() - accel[i]) / (SERVO_PROFILE_STEP_US * 1e-6f));
+          accel[i] = profiles[i].getAcceleration();
+        }
+      }
+    }
+  }
+
+  printf("%d s of setpoints for 6 servos, replayed under %d loop schedules\n\n", (int)seconds, SCHEDULE_COUNT);
+  printf("%-16s %7s %9s %11s %15s\n", "schedule", "loops", "samples", "mismatches", "ramp drift deg");
+
+  bool ok = true;
+  srand(1);
+  for (int s = 0; s < SCHEDULE_COUNT; s++)
+  {
+    const Schedule &schedule = SCHEDULES[s];
+    std::vector<ServoProfile> profiles(6, ServoProfile(SERVO_MAX_SPEED_DEG, SERVO_MAX_ACCEL_DEG, SERVO_MAX_JERK_DEG));
+    float rampPosition[6], rampVelocity[6] = {0};
+    unsigned long loops = 0, samples = 0, mismatches = 0;
+    float drift = 0;
+
+    for (int i = 0; i < 6; i++)
+    {
+      profiles[i].reset(SERVO_MID_ANGLE, START_US);
+      rampPosition[i] = SERVO_MID_ANGLE;
+    }
+
+    // Every schedule passes through each checkpoint, where the setpoints change
+    for (int k = 0; k < checkpoints; k++)
+    {
+      const uint32_t checkpointUs = START_US + k * CHECKPOINT_US;
+      for (uint32_t us = 0; us < CHECKPOINT_US;)
+      {
+        const uint32_t now = checkpointUs + us;
+        loops++;
+        for (int i = 0; i < 6; i++)
+        {
+          // As in updateServos(): the setpoint of this loop, then the angle now
+          const float target = setpoint(i, k, checkpoints);
+          profiles[i].setTarget(target, now);
+          const float angle = profiles[i].update(now);
+          ramp(target, rampPosition[i], rampVelocity[i]);
+
+          ServoProfile expected = reference[k * 6 + i];
+          samples++;
+          if (angle != expected.update(now))
+          {
+            mismatches++;
+          }
+        }
+
+        uint32_t period = schedule.minUs + (uint32_t)((schedule.maxUs - schedule.minUs) * (rand() / (RAND_MAX + 1.0)));
+        if ((float)rand() / RAND_MAX < schedule.stall)
+        {
+          period = CHECKPOINT_US;
+        }
+        us = us + period < CHECKPOINT_US ? us + period : CHECKPOINT_US;
+      }
+
+      // The ramp moves by loop iterations, so it only agrees with itself under the steady schedule
+      if (s == 0)
+      {
+        for (int i = 0; i < 6; i++)
+        {
+          rampReference.push_back(rampPosition[i]);
+        }
+      }
+      for (int i = 0; i < 6; i++)
+      {
+        drift = fmaxf(drift, fabsf(rampPosition[i] - rampReference[k * 6 + i]));
+      }
+    }
+
+    printf("%-16s %7lu %9lu %11lu %15.2f\n", schedule.name, loops, samples, mismatches, drift);
+    ok = ok && mismatches == 0;
+  }
+
+  const bool withinLimits = maxSpeed <= SERVO_MAX_SPEED_DEG * 1.0001f && maxAccel <= SERVO_MAX_ACCEL_DEG * 1.0001f &&
+                            maxJerk <= SERVO_MAX_JERK_DEG * 1.0001f;
+  printf("\npeak speed %.1f deg/s (limit %.0f), acceleration %.1f deg/s^2 (limit %.0f), jerk %.0f deg/s^3 (limit %.0f)\n",
+         maxSpeed, SERVO_MAX_SPEED_DEG, maxAccel, SERVO_MAX_ACCEL_DEG, maxJerk, SERVO_MAX_JERK_DEG);
+  ok = ok && withinLimits;
+  printf("%s (ramp drift: largest difference at a checkpoint from the same ramp in the steady 10 ms loop)\n",
+         ok ? "All checks passed" : "FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,383 @@
+/**
+ * @file ServoPwmSim.cpp
+ * @brief Host check of the FTM0 servo PWM frame timing, on a simulated timer
+ *
+ * This tool runs FtmServoPwm against a simulated FlexTimer: a register
+ * block that the driver writes, and a model of the counter that reads it.
+ * The model counts the bus clock through the prescaler, starts a frame each
+ * time the counter wraps from MOD, drives each channel high from the start
+ * of the frame to its CnV, and only loads the CnV written by the driver at
+ * the end of a frame with a software trigger pending, as the hardware does
+ * with synchronized updates.
+ *
+ * It checks, for several bus clocks and frame rates, that:
+ * - the frame period is that of the frame rate;
+ * - every pulse width from 500 to 2500 us comes out within half a timer
+ *   count, and each microsecond gives a different pulse;
+ * - with new pulse widths every SERVO_UPDATE_INTERVAL_US, as the servo timer
+ *   writes them, every frame carries the six pulses of one update, never a
+ *   mix of two, never an older update than the frame before, and that
+ *   each update is carried, or replaced by a later one, within a frame and
+ *   a tick.
+ *
+ * It reports the delay from an update to the frame that carries it, and
+ * exits with a non-zero status if a check fails.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -I include tools/ServoPwmSim/ServoPwmSim.cpp src/drivers/FtmServoPwm.cpp -o servo_pwm_sim
+ *   ./servo_pwm_sim [seconds]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "drivers/FtmServoPwm.h"
+
+using namespace stewy::drivers;
+
+// The register block must match the hardware layout, up to PWMLOAD at 0x98
+static_assert(offsetof(FtmRegisters, C) == 0x0c && offsetof(FtmRegisters, CNTIN) == 0x4c &&
+                  offsetof(FtmRegisters, SYNCONF) == 0x8c && offsetof(FtmRegisters, PWMLOAD) == 0x98,
+              "FtmRegisters does not match the FTM register map");
+
+const int SERVO_PINS[6] = {22, 23, 9, 10, 6, 20}; // FTM0 channels 0-5
+const uint32_t SERVO_UPDATE_INTERVAL_US = 2000;   // See Config.h
+
+/**
+ * A FlexTimer, as far as edge-aligned PWM with software-triggered
+ * synchronization goes. Time is in bus clock cycles.
+ */
+class SimulatedFtm
+{
+public:
+  FtmRegisters regs;
+
+  SimulatedFtm() : _running(false), _mod(0), _frameStart(0)
+  {
+    memset((void *)&regs, 0, sizeof(regs));
+  }
+
+  /**
+   * Prescaled counts in a frame, as loaded in the counter.
+   */
+  uint32_t period() const { return _mod + 1; }
+
+  /**
+   * Bus cycles per timer count.
+   */
+  uint32_t divider() const { return 1u << (regs.SC & ftm::SC_PS_MASK); }
+
+  /**
+   * Bus cycle at which the next frame starts.
+   */
+  uint64_t nextFrame() const { return _frameStart + (uint64_t)period() * divider(); }
+
+  /**
+   * Start the counter, once the driver has set it up (with the clock stopped,
+   * MOD and CnV take the values written at once).
+   */
+  void start(uint64_t now)
+  {
+    _running = (regs.SC & ftm::SC_CLKS_BUS) != 0;
+    _mod = regs.MOD;
+    for (int c = 0; c < 8; c++)
+    {
+      _value[c] = regs.C[c].V;
+    }
+    _frameStart = now;
+  }
+
+  /**
+   * Wrap the counter into the next frame, loading the buffered values if a
+   * software trigger is pending. Returns the channel values of the new frame.
+   */
+  const uint32_t *wrap()
+  {
+    _frameStart = nextFrame();
+    if ((regs.SYNC & ftm::SYNC_SWSYNC) && (regs.SYNC & ftm::SYNC_CNTMAX) && (regs.MODE & ftm::MODE_FTMEN) &&
+        regs.SYNCONF == (ftm::SYNCONF_SYNCMODE | ftm::SYNCONF_SWWRBUF))
+    {
+      _mod = regs.MOD;
+      for (int c = 0; c < 8; c++)
+      {
+        // Only the channel pairs with SYNCEN take buffered values
+        if (regs.COMBINE & (ftm::COMBINE_SYNCEN & (0xffu << (8 * (c / 2)))))
+        {
+          _value[c] = regs.C[c].V;
+        }
+      }
+      regs.SYNC &= ~ftm::SYNC_SWSYNC;
+    }
+    return _value;
+  }
+
+  /**
+   * Bring the counter to a time within the current frame.
+   */
+  void advance(uint64_t now) { regs.CNT = (uint32_t)((now - _frameStart) / divider()); }
+
+  uint64_t frameStart() const { return _frameStart; }
+  bool running() const { return _running; }
+
+private:
+  bool _running;
+  uint32_t _mod;
+  uint32_t _value[8];
+  uint64_t _frameStart;
+};
+
+/**
+ * Pulse width in microseconds of a channel value, high from the start of the
+ * frame to CnV (the whole frame when CnV is past MOD).
+ */
+static double pulseUs(uint32_t value, const SimulatedFtm &timer, uint32_t busHz)
+{
+  const uint32_t counts = value < timer.period() ? value : timer.period();
+  return counts * (double)timer.divider() * 1e6 / busHz;
+}
+
+/**
+ * Frame period and pulse widths, for every microsecond from 500 to 2500 us.
+ */
+static bool checkTiming(uint32_t busHz, uint16_t frameHz, double &periodError, double &widthError)
+{
+  SimulatedFtm timer;
+  FtmServoPwm pwm(timer.regs, busHz);
+  if (!pwm.begin(SERVO_PINS, frameHz))
+  {
+    return false;
+  }
+  timer.start(0);
+
+  const double periodUs = (double)timer.period() * timer.divider() * 1e6 / busHz;
+  periodError = fabs(periodUs - 1e6 / frameHz);
+  widthError = 0;
+  bool ok = timer.running() && timer.period() == pwm.getFrameCounts() && timer.period() <= 65536;
+  double previous = -1;
+  for (uint16_t us = 500; us <= 2500; us++)
+  {
+    for (int i = 0; i < 6; i++)
+    {
+      pwm.write(i, us);
+    }
+    ok = ok && pwm.flush();
+    const uint32_t *value = timer.wrap();
+    for (int i = 0; i < 6; i++)
+    {
+      const double width = pulseUs(value[i], timer, busHz);
+      widthError = fmax(widthError, fabs(width - us));
+      ok = ok && width == pulseUs(value[0], timer, busHz);
+    }
+    ok = ok && pulseUs(value[0], timer, busHz) > previous;
+    previous = pulseUs(value[0], timer, busHz);
+  }
+  const double halfCount = 0.5 * timer.divider() * 1e6 / busHz;
+  return ok && periodError < 1.0 && widthError <= halfCount + 1e-3;
+}
+
+struct Update
+{
+  uint64_t time;       ///< Bus cycle of the write
+  uint32_t counts[6];  ///< Channel values it asks for
+};
+
+struct StreamResult
+{
+  unsigned long updates, frames, mixed, stale, lost, accepted;
+  double meanDelayUs, maxDelayUs;
+};
+
+/**
+ * New pulse widths from a 500 Hz servo timer, some servos at a time, against
+ * the frames that come out.
+ */
+static StreamResult checkStream(uint32_t busHz, uint16_t frameHz, float seconds)
+{
+  StreamResult result = {0, 0, 0, 0, 0, 0, 0, 0};
+  SimulatedFtm timer;
+  FtmServoPwm pwm(timer.regs, busHz);
+  pwm.begin(SERVO_PINS, frameHz);
+  timer.start(0);
+
+  const double cyclesPerUs = busHz / 1e6;
+  const double countsPerUs = busHz / 1e6 / timer.divider();
+  const uint64_t end = (uint64_t)(seconds * busHz);
+  std::vector<Update> updates;
+  Update current = {0, {0, 0, 0, 0, 0, 0}};
+  updates.push_back(current);
+  size_t shown = 0; // Latest update a frame carried
+  double delaySum = 0;
+  unsigned long delayed = 0;
+
+  // The servo timer jitters by a few microseconds, so it drifts across frame boundaries
+  uint64_t nextTick = (uint64_t)(SERVO_UPDATE_INTERVAL_US * cyclesPerUs);
+  while (timer.nextFrame() < end)
+  {
+    if (nextTick < timer.nextFrame())
+    {
+      // A tick of the servo timer: some servos move, then the pulses are flushed
+      timer.advance(nextTick);
+      bool changed = false;
+      for (int i = 0; i < 6; i++)
+      {
+        if (rand() % 3 == 0)
+        {
+          const uint16_t us = 800 + rand() % 1400;
+          pwm.write(i, us);
+          current.counts[i] = (uint32_t)lround(us * countsPerUs);
+          changed = true;
+        }
+      }
+      if (changed)
+      {
+        current.time = nextTick;
+        updates.push_back(current);
+        result.updates++;
+      }
+      if (pwm.flush() && changed)
+      {
+        result.accepted++;
+      }
+      nextTick += (uint64_t)((SERVO_UPDATE_INTERVAL_US + rand() % 11 - 5) * cyclesPerUs);
+    }
+    else
+    {
+      // A new frame: its six pulses must be those of one update, at least as recent as the last frame's
+      const uint32_t *value = timer.wrap();
+      result.frames++;
+      size_t match = updates.size();
+      for (size_t u = updates.size(); u-- > shown;)
+      {
+        bool same = true;
+        for (int i = 0; i < 6; i++)
+        {
+          same = same && abs((int)value[i] - (int)updates[u].counts[i]) <= 1;
+        }
+        if (same)
+        {
+          match = u;
+          break;
+        }
+      }
+      if (match == updates.size())
+      {
+        // Either a mix of updates, or an update older than the last frame's
+        bool older = false;
+        for (size_t u = 0; u < shown && !older; u++)
+        {
+          bool same = true;
+          for (int i = 0; i < 6; i++)
+          {
+            same = same && abs((int)value[i] - (int)updates[u].counts[i]) <= 1;
+          }
+          older = same;
+        }
+        if (older)
+        {
+          result.stale++;
+        }
+        else
+        {
+          result.mixed++;
+        }
+        continue;
+      }
+
+      // Delay of each update first carried by this frame, skipped ones included
+      for (size_t u = shown + 1; u <= match; u++)
+      {
+        const double delay = (timer.frameStart() - updates[u].time) / cyclesPerUs;
+        delaySum += delay;
+        delayed++;
+        result.maxDelayUs = fmax(result.maxDelayUs, delay);
+      }
+      shown = match;
+    }
+  }
+  // Updates no frame carried, long enough before the end that one should have
+  const uint64_t bound = (uint64_t)((1e6 / frameHz + SERVO_UPDATE_INTERVAL_US + 10) * cyclesPerUs);
+  for (size_t u = shown + 1; u < updates.size(); u++)
+  {
+    if (updates[u].time + bound < timer.frameStart())
+    {
+      result.lost++;
+    }
+  }
+  result.meanDelayUs = delayed > 0 ? delaySum / delayed : 0;
+  return result;
+}
+
+int main(int argc, char **argv)
+{
+  const float seconds = argc > 1 ? (float)atof(argv[1]) : 10;
+  const uint32_t BUS_HZ[] = {36000000, 48000000, 60000000}; // F_BUS at 72, 96 and 120 MHz
+  const uint16_t FRAME_HZ[] = {50, 100, 200, 333};
+  bool ok = true;
+
+  printf("Frame timing\n\n%8s %6s %9s %13s %16s %16s\n", "bus MHz", "Hz", "counts", "counts/us", "period err us",
+         "width err us");
+  for (uint32_t busHz : BUS_HZ)
+  {
+    for (uint16_t frameHz : FRAME_HZ)
+    {
+      double periodError = 0, widthError = 0;
+      const bool passed = checkTiming(busHz, frameHz, periodError, widthError);
+      SimulatedFtm timer;
+      FtmServoPwm pwm(timer.regs, busHz);
+      pwm.begin(SERVO_PINS, frameHz);
+      printf("%8u %6u %9u %13.2f %16.3f %16.3f%s\n", (unsigned)(busHz / 1000000), frameHz,
+             (unsigned)pwm.getFrameCounts(), pwm.getCountsPerMicrosecond(), periodError, widthError,
+             passed ? "" : "  FAILED");
+      ok = ok && passed;
+    }
+  }
+
+  // Out of range setups must be refused
+  {
+    SimulatedFtm timer;
+    FtmServoPwm pwm(timer.regs, 48000000);
+    const int wrongPins[6] = {0, 1, 2, 3, 4, 5};
+    const bool refused = !pwm.begin(SERVO_PINS, 49) && !pwm.begin(SERVO_PINS, 334) && !pwm.begin(wrongPins, 50);
+    printf("\nOut of range frame rates and non-FTM0 pins refused: %s\n", refused ? "yes" : "NO");
+    ok = ok && refused;
+  }
+
+  printf("\n%d s of updates every %u us, 48 MHz bus\n\n%6s %8s %8s %8s %6s %6s %6s %15s %14s\n", (int)seconds,
+         (unsigned)SERVO_UPDATE_INTERVAL_US, "Hz", "updates", "flushed", "frames", "mixed", "stale", "lost", "mean delay ms",
+         "max delay ms");
+  srand(1);
+  for (uint16_t frameHz : FRAME_HZ)
+  {
+    const StreamResult r = checkStream(48000000, frameHz, seconds);
+    const double frameUs = 1e6 / frameHz;
+    // An update waits for the end of the frame, or for the next tick if that is too close
+    const bool passed = r.mixed == 0 && r.stale == 0 && r.lost == 0 && r.maxDelayUs <= frameUs + SERVO_UPDATE_INTERVAL_US + 10;
+    printf("%6u %8lu %8lu %8lu %6lu %6lu %6lu %15.2f %14.2f%s\n", frameHz, r.updates, r.accepted, r.frames, r.mixed,
+           r.stale, r.lost, r.meanDelayUs / 1000, r.maxDelayUs / 1000, passed ? "" : "  FAILED");
+    ok = ok && passed;
+  }
+
+  printf("\n%s (delay: from a write to the start of the first frame that carries it)\n",
+         ok ? "All checks passed" : "FAILED");
+  return ok ? 0 : 1;
+}
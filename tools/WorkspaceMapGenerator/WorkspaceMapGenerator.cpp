@@ -0,0 +1,450 @@
+/**
+ * @file WorkspaceMapGenerator.cpp
+ * @brief Generates the workspace reachability map
+ *
+ * This tool sweeps the pose envelope of PlatformGeometry.h (SWAY_MIN ..
+ * YAW_MAX) on a regular lattice, solving the IK at every point with the same
+ * kernel, scalar type and geometry as the firmware, on all cores. With the
+ * float kernel, on a host with SSE2 or AVX2, the lattice is solved in
+ * batches by IkKernelSimd, which matches IkKernel<float> (see
+ * tools/IkSimdBenchmark); add -mavx2 to the build for the widest lanes. It then
+ * classifies each cell of a coarser grid as reachable, unreachable or mixed,
+ * picks probe poses that let the firmware detect a stale map, and writes the
+ * result as a C++ source file (src/core/WorkspaceMapData.cpp by default).
+ * Finally, it checks the map through WorkspaceMap::query against the IK at
+ * random poses, and reports how often it rejects or misclassifies a pose.
+ *
+ * Regenerate the map whenever the geometry, the envelope or SLAM changes.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++11 -O2 -D USE_FAST_MATH -pthread -I include tools/WorkspaceMapGenerator/WorkspaceMapGenerator.cpp src/core/WorkspaceMap.cpp -o workspace_map_generator
+ *   ./workspace_map_generator [-o output] [-c cells per axis] [-s lattice points per cell] [-j threads]
+ *
+ * @author Philippe Desrosiers
+ * @copyright Copyright (C) 2018 Philippe Desrosiers
+ * @license GPL-3.0
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/IkKernel.h"
+#include "core/IkKernelSimd.h"
+#include "core/WorkspaceMap.h"
+
+using namespace stewy::core;
+
+// Firmware settings (see Config.h)
+const int SERVO_MIN = 0;
+const int SERVO_MAX = 360;
+
+// Probe poses written to the map (WorkspaceMapLayout::probeCount is a uint8_t)
+const int MAX_PROBES = 32;
+
+// Random poses used to check the generated map
+const int CHECK_POSES = 1000000;
+
+// Lattice points per batch solve
+const size_t BATCH_POSES = 1024;
+
+// The vector kernel evaluates the float kernel, with the FastMath approximations
+#if defined(SIMD_HAS_SSE2) && defined(IK_SCALAR_FLOAT) && defined(USE_FAST_MATH)
+#define SWEEP_SIMD
+#endif
+
+static const float ENVELOPE_MIN[6] = {SWAY_MIN, SURGE_MIN, HEAVE_MIN, PITCH_MIN, ROLL_MIN, YAW_MIN};
+static const float ENVELOPE_MAX[6] = {SWAY_MAX, SURGE_MAX, HEAVE_MAX, PITCH_MAX, ROLL_MAX, YAW_MAX};
+static const char *AXIS_NAMES[6] = {"sway", "surge", "heave", "pitch", "roll", "yaw"};
+
+/**
+ * Regular lattice over the envelope, samples - 1 lattice steps per cell.
+ */
+struct Lattice
+{
+  int cells[6];
+  int steps;       // Lattice steps per cell
+  int points[6];   // Lattice points per axis
+  size_t stride[6];
+  size_t size;
+
+  Lattice(const int *c, int s) : steps(s), size(1)
+  {
+    for (int i = 5; i >= 0; i--)
+    {
+      cells[i] = c[i];
+      points[i] = c[i] * s + 1;
+      stride[i] = size;
+      size *= points[i];
+    }
+  }
+
+  void pose(size_t index, float *p) const
+  {
+    for (int i = 0; i < 6; i++)
+    {
+      const int k = (int)((index / stride[i]) % points[i]);
+      p[i] = ENVELOPE_MIN[i] + (ENVELOPE_MAX[i] - ENVELOPE_MIN[i]) * k / (points[i] - 1);
+    }
+  }
+};
+
+static bool accepted(const IkKernel<ik_scalar_t> &kernel, const float *p)
+{
+  float servoValues[6];
+  int failedLeg;
+  float value;
+  const IkStatus status = kernel.solveRaw(servoValues, p[0], p[1], p[2], p[3], p[4], p[5], failedLeg, value);
+#ifdef SLAM
+  return status == IK_OK || status == IK_ASYMPTOTIC;
+#else
+  return status == IK_OK;
+#endif
+}
+
+/**
+ * Whether a lattice point and all its lattice neighbours along each axis have the same outcome,
+ * so that a probe at that point is not sensitive to rounding differences between host and device.
+ */
+static bool interior(const Lattice &lattice, const std::vector<uint8_t> &ok, size_t index)
+{
+  for (int i = 0; i < 6; i++)
+  {
+    const int k = (int)((index / lattice.stride[i]) % lattice.points[i]);
+    if ((k > 0 && ok[index - lattice.stride[i]] != ok[index]) ||
+        (k < lattice.points[i] - 1 && ok[index + lattice.stride[i]] != ok[index]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Calls f(index) for each lattice point of a cell.
+ */
+template <typename F>
+static void forEachPoint(const Lattice &lattice, size_t cell, F f)
+{
+  size_t base = 0, rest = cell;
+  for (int i = 5; i >= 0; i--)
+  {
+    base += (rest % lattice.cells[i]) * lattice.steps * lattice.stride[i];
+    rest /= lattice.cells[i];
+  }
+
+  const int n = lattice.steps + 1;
+  int total = 1;
+  for (int i = 0; i < 6; i++)
+  {
+    total *= n;
+  }
+  for (int j = 0; j < total; j++)
+  {
+    size_t index = base;
+    int r = j;
+    for (int i = 0; i < 6; i++)
+    {
+      index += (r % n) * lattice.stride[i];
+      r /= n;
+    }
+    f(index);
+  }
+}
+
+/**
+ * Formats a float as a C++ literal that reads back to the same value.
+ */
+static std::string literal(float v)
+{
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.9g", v);
+  std::string text(buf);
+  if (text.find_first_of(".e") == std::string::npos)
+  {
+    text += ".0";
+  }
+  return text + "f";
+}
+
+/**
+ * Formats 6 floats as a C++ array initializer.
+ */
+static std::string literals(const float *v)
+{
+  std::string text = "{";
+  for (int i = 0; i < 6; i++)
+  {
+    text += (i ? ", " : "") + literal(v[i]);
+  }
+  return text + "}";
+}
+
+static void usage(const char *name)
+{
+  fprintf(stderr, "usage: %s [-o output] [-c cells per axis] [-s lattice steps per cell] [-j threads]\n", name);
+  exit(2);
+}
+
+int main(int argc, char **argv)
+{
+  const char *output = "src/core/WorkspaceMapData.cpp";
+  int cellsPerAxis = 6;
+  int steps = 3;
+  int threads = (int)std::thread::hardware_concurrency();
+
+  int opt;
+  while ((opt = getopt(argc, argv, "o:c:s:j:")) != -1)
+  {
+    switch (opt)
+    {
+    case 'o':
+      output = optarg;
+      break;
+    case 'c':
+      cellsPerAxis = atoi(optarg);
+      break;
+    case 's':
+      steps = atoi(optarg);
+      break;
+    case 'j':
+      threads = atoi(optarg);
+      break;
+    default:
+      usage(argv[0]);
+    }
+  }
+  if (cellsPerAxis < 1 || cellsPerAxis > 255 || steps < 1 || threads < 1)
+  {
+    usage(argv[0]);
+  }
+
+  const int cells[6] = {cellsPerAxis, cellsPerAxis, cellsPerAxis, cellsPerAxis, cellsPerAxis, cellsPerAxis};
+  const Lattice lattice(cells, steps);
+  IkKernel<ik_scalar_t> kernel(SERVO_MIN, SERVO_MAX);
+
+#ifdef SWEEP_SIMD
+  const IkKernelSimd<SimdNative> batchKernel(SERVO_MIN, SERVO_MAX);
+  printf("Solving %zu lattice points on %d threads, %d poses per vector\n", lattice.size, threads, SimdNative::WIDTH);
+#else
+  printf("Solving %zu lattice points on %d threads\n", lattice.size, threads);
+#endif
+  auto start = std::chrono::steady_clock::now();
+
+  // Each thread solves an interleaved share of the lattice, a batch at a time
+  std::vector<uint8_t> ok(lattice.size);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++)
+  {
+    workers.push_back(std::thread([&, t]() {
+      std::vector<Pose> poses(BATCH_POSES);
+#ifdef SWEEP_SIMD
+      std::vector<float> storage(BATCH_POSES * 6);
+      std::vector<uint32_t> bits(FeasibilityMask::wordsFor(BATCH_POSES));
+      ServoFrameSoA out(storage.data(), BATCH_POSES);
+      FeasibilityMask mask(bits.data(), BATCH_POSES);
+#endif
+      for (size_t begin = t * BATCH_POSES; begin < lattice.size; begin += threads * BATCH_POSES)
+      {
+        const size_t n = lattice.size - begin < BATCH_POSES ? lattice.size - begin : BATCH_POSES;
+        for (size_t k = 0; k < n; k++)
+        {
+          lattice.pose(begin + k, &poses[k].sway);
+        }
+#ifdef SWEEP_SIMD
+        batchKernel.solveBatch(poses.data(), n, out, mask);
+        for (size_t k = 0; k < n; k++)
+        {
+#ifdef SLAM
+          // The batch counts a slammed leg as a failure, which the firmware accepts
+          ok[begin + k] = mask.test(k) || accepted(kernel, &poses[k].sway);
+#else
+          ok[begin + k] = mask.test(k);
+#endif
+        }
+#else
+        for (size_t k = 0; k < n; k++)
+        {
+          ok[begin + k] = accepted(kernel, &poses[k].sway);
+        }
+#endif
+      }
+    }));
+  }
+  for (size_t t = 0; t < workers.size(); t++)
+  {
+    workers[t].join();
+  }
+
+  auto end = std::chrono::steady_clock::now();
+  printf("Solved in %.1f s\n", std::chrono::duration<double>(end - start).count());
+
+  // Classify cells
+  size_t cellCount = 1;
+  for (int i = 0; i < 6; i++)
+  {
+    cellCount *= cells[i];
+  }
+  std::vector<uint8_t> bits((cellCount + 3) / 4);
+  std::vector<size_t> mixed;
+  size_t counts[3] = {0, 0, 0};
+  for (size_t c = 0; c < cellCount; c++)
+  {
+    size_t reachable = 0, total = 0;
+    forEachPoint(lattice, c, [&](size_t index) {
+      reachable += ok[index];
+      total++;
+    });
+
+    const WorkspaceStatus status = reachable == total ? WORKSPACE_REACHABLE
+                                   : reachable == 0  ? WORKSPACE_UNREACHABLE
+                                                     : WORKSPACE_UNKNOWN;
+    bits[c >> 2] |= status << ((c & 3) * 2);
+    counts[status]++;
+    if (status == WORKSPACE_UNKNOWN)
+    {
+      mixed.push_back(c);
+    }
+  }
+
+  printf("%zu cells: %zu reachable (%.1f%%), %zu unreachable (%.1f%%), %zu mixed (%.1f%%)\n", cellCount,
+         counts[WORKSPACE_REACHABLE], 100.0 * counts[WORKSPACE_REACHABLE] / cellCount,
+         counts[WORKSPACE_UNREACHABLE], 100.0 * counts[WORKSPACE_UNREACHABLE] / cellCount,
+         counts[WORKSPACE_UNKNOWN], 100.0 * counts[WORKSPACE_UNKNOWN] / cellCount);
+
+  // Probes: a reachable and an unreachable lattice point, away from the boundary, from mixed cells spread over the map
+  std::vector<size_t> probes;
+  for (size_t m = 0; m < mixed.size() && probes.size() < (size_t)MAX_PROBES; m += mixed.size() / (MAX_PROBES / 2) + 1)
+  {
+    bool found[2] = {false, false};
+    forEachPoint(lattice, mixed[m], [&](size_t index) {
+      if (!found[ok[index]] && interior(lattice, ok, index))
+      {
+        found[ok[index]] = true;
+        probes.push_back(index);
+      }
+    });
+  }
+
+  FILE *f = fopen(output, "w");
+  if (!f)
+  {
+    perror(output);
+    return 1;
+  }
+
+  fprintf(f, "/**\n");
+  fprintf(f, " * @file WorkspaceMapData.cpp\n");
+  fprintf(f, " * @brief Workspace reachability map\n");
+  fprintf(f, " *\n");
+  fprintf(f, " * Generated by tools/WorkspaceMapGenerator from PlatformGeometry.h. Do not edit.\n");
+  fprintf(f, " *\n");
+  fprintf(f, " * %d cells per axis, %d lattice steps per cell, %zu lattice points.\n", cellsPerAxis, steps, lattice.size);
+  fprintf(f, " * %zu cells: %zu reachable, %zu unreachable, %zu mixed.\n", cellCount,
+          counts[WORKSPACE_REACHABLE], counts[WORKSPACE_UNREACHABLE], counts[WORKSPACE_UNKNOWN]);
+  fprintf(f, " *\n");
+  fprintf(f, " * @author Philippe Desrosiers\n");
+  fprintf(f, " * @copyright Copyright (C) 2018 Philippe Desrosiers\n");
+  fprintf(f, " * @license GPL-3.0\n");
+  fprintf(f, " */\n\n");
+  fprintf(f, "#include \"core/WorkspaceMap.h\"\n\n");
+  fprintf(f, "namespace stewy\n{\n  namespace core\n  {\n\n");
+
+  fprintf(f, "    static const WorkspaceProbe PROBES[] = {\n");
+  for (size_t i = 0; i < probes.size(); i++)
+  {
+    float p[6];
+    lattice.pose(probes[i], p);
+    fprintf(f, "        {%s, %s},\n", literals(p).c_str(), ok[probes[i]] ? "true" : "false");
+  }
+  fprintf(f, "    };\n\n");
+
+  fprintf(f, "    static const uint8_t BITS[] = {");
+  for (size_t i = 0; i < bits.size(); i++)
+  {
+    fprintf(f, "%s0x%02x%s", i % 16 == 0 ? "\n        " : " ", bits[i], i + 1 < bits.size() ? "," : "");
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "    const WorkspaceMapLayout WORKSPACE_MAP = {\n");
+  fprintf(f, "        {%d, %d, %d, %d, %d, %d},\n", cells[0], cells[1], cells[2], cells[3], cells[4], cells[5]);
+  fprintf(f, "        %s,\n", literals(ENVELOPE_MIN).c_str());
+  fprintf(f, "        %s,\n", literals(ENVELOPE_MAX).c_str());
+#ifdef SLAM
+  fprintf(f, "        true,\n");
+#else
+  fprintf(f, "        false,\n");
+#endif
+  fprintf(f, "        PROBES,\n");
+  fprintf(f, "        %zu,\n", probes.size());
+  fprintf(f, "        BITS};\n\n");
+  fprintf(f, "  } // namespace core\n} // namespace stewy\n");
+  fclose(f);
+
+  printf("Wrote %s: %zu bytes of cells, %zu probes\n", output, bits.size(), probes.size());
+  for (int i = 0; i < 6; i++)
+  {
+    printf("  %-5s [%g, %g], cell %.2f, lattice step %.2f\n", AXIS_NAMES[i], ENVELOPE_MIN[i], ENVELOPE_MAX[i],
+           (ENVELOPE_MAX[i] - ENVELOPE_MIN[i]) / cells[i], (ENVELOPE_MAX[i] - ENVELOPE_MIN[i]) / (lattice.points[i] - 1));
+  }
+
+  // Check the map, as the firmware will use it
+  std::vector<WorkspaceProbe> probePoses(probes.size());
+  for (size_t i = 0; i < probes.size(); i++)
+  {
+    lattice.pose(probes[i], probePoses[i].pose);
+    probePoses[i].reachable = ok[probes[i]];
+  }
+  WorkspaceMapLayout layout = {{0}, {0}, {0}, false, probePoses.data(), (uint8_t)probes.size(), bits.data()};
+  for (int i = 0; i < 6; i++)
+  {
+    layout.cells[i] = (uint8_t)cells[i];
+    layout.min[i] = ENVELOPE_MIN[i];
+    layout.max[i] = ENVELOPE_MAX[i];
+  }
+#ifdef SLAM
+  layout.slam = true;
+#endif
+  WorkspaceMap map(layout);
+  if (!map.verify(kernel))
+  {
+    printf("Generated map failed its own probes\n");
+    return 1;
+  }
+
+  size_t infeasible = 0, rejected = 0, wrong = 0;
+  srand(1);
+  for (int n = 0; n < CHECK_POSES; n++)
+  {
+    float p[6];
+    for (int i = 0; i < 6; i++)
+    {
+      p[i] = ENVELOPE_MIN[i] + (ENVELOPE_MAX[i] - ENVELOPE_MIN[i]) * (float)rand() / (float)RAND_MAX;
+    }
+    const bool reachable = accepted(kernel, p);
+    const WorkspaceStatus status = map.query(p);
+    infeasible += !reachable;
+    rejected += !reachable && status == WORKSPACE_UNREACHABLE;
+    wrong += (reachable && status == WORKSPACE_UNREACHABLE) || (!reachable && status == WORKSPACE_REACHABLE);
+  }
+  printf("%d random poses: %.1f%% unreachable, %.1f%% of those rejected by the map, %zu misclassified\n",
+         CHECK_POSES, 100.0 * infeasible / CHECK_POSES, 100.0 * rejected / infeasible, wrong);
+  return 0;
+}